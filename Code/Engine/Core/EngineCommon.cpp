@@ -1,3 +1,3 @@
-#include "Engine/Core/EngineCommon.hpp"
-
-NamedStrings g_gameConfigBlackboard;
+#include "Engine/Core/EngineCommon.hpp"
+
+NamedStrings g_gameConfigBlackboard;
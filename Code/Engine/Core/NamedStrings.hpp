@@ -1,31 +1,31 @@
-#pragma once
-#include <map>
-#include <string>
-#include "Engine/Core/XmlUtils.hpp"
-#include "Engine/Core/Rgba8.hpp"
-#include "Engine/Math/IntVec2.hpp"
-#include "Engine/Math/Vec2.hpp"
-#include "Engine/Math/EulerAngles.hpp"
-
-class NamedStrings
-{
-//public member variables
-public:
-	std::map<std::string, std::string> m_keyValuePairs;
-
-//public member functions
-public:
-	void		 PopulateFromXmlElementAttributes(XmlElement const& element);
-	void		 SetValue(std::string const& keyName, std::string const& newValue);
-	std::string  GetValue(std::string const& keyName, std::string const& defaultValue) const;
-	bool		 GetValue(std::string const& keyName, bool defaultValue) const;
-	int			 GetValue(std::string const& keyName, int defaultValue) const;
-	unsigned int GetValue(std::string const& keyName, unsigned int defaultValue) const;
-	float		 GetValue(std::string const& keyName, float defaultValue) const;
-	std::string	 GetValue(std::string const& keyName, char const* defaultValue) const;
-	Rgba8		 GetValue(std::string const& keyName, Rgba8 const& defaultValue) const;
-	Vec2		 GetValue(std::string const& keyName, Vec2 const& defaultValue) const;
-	Vec3		 GetValue(std::string const& keyName, Vec3 const& defaultValue) const;
-	IntVec2		 GetValue(std::string const& keyName, IntVec2 const& defaultValue) const;
-	EulerAngles  GetValue(std::string const& keyName, EulerAngles const& defaultValue) const;
-};
+#pragma once
+#include <map>
+#include <string>
+#include "Engine/Core/XmlUtils.hpp"
+#include "Engine/Core/Rgba8.hpp"
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/EulerAngles.hpp"
+
+class NamedStrings
+{
+//public member variables
+public:
+	std::map<std::string, std::string> m_keyValuePairs;
+
+//public member functions
+public:
+	void		 PopulateFromXmlElementAttributes(XmlElement const& element);
+	void		 SetValue(std::string const& keyName, std::string const& newValue);
+	std::string  GetValue(std::string const& keyName, std::string const& defaultValue) const;
+	bool		 GetValue(std::string const& keyName, bool defaultValue) const;
+	int			 GetValue(std::string const& keyName, int defaultValue) const;
+	unsigned int GetValue(std::string const& keyName, unsigned int defaultValue) const;
+	float		 GetValue(std::string const& keyName, float defaultValue) const;
+	std::string	 GetValue(std::string const& keyName, char const* defaultValue) const;
+	Rgba8		 GetValue(std::string const& keyName, Rgba8 const& defaultValue) const;
+	Vec2		 GetValue(std::string const& keyName, Vec2 const& defaultValue) const;
+	Vec3		 GetValue(std::string const& keyName, Vec3 const& defaultValue) const;
+	IntVec2		 GetValue(std::string const& keyName, IntVec2 const& defaultValue) const;
+	EulerAngles  GetValue(std::string const& keyName, EulerAngles const& defaultValue) const;
+};
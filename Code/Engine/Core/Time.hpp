@@ -1,10 +1,10 @@
-//-----------------------------------------------------------------------------------------------
-// Time.hpp
-//
-#pragma once
-
-
-//-----------------------------------------------------------------------------------------------
-double GetCurrentTimeSeconds();
-
+//-----------------------------------------------------------------------------------------------
+// Time.hpp
+//
+#pragma once
+
+
+//-----------------------------------------------------------------------------------------------
+double GetCurrentTimeSeconds();
+
 	
\ No newline at end of file
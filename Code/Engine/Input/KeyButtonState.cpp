@@ -1,2 +1,2 @@
-#include "Engine/Input/InputSystem.hpp"
-
+#include "Engine/Input/InputSystem.hpp"
+
@@ -1,8 +1,8 @@
-#pragma once
-
-
-struct KeyButtonState
-{
-	bool m_isPressed = false;
-	bool m_wasPressedLastFrame = false;
-};
+#pragma once
+
+
+struct KeyButtonState
+{
+	bool m_isPressed = false;
+	bool m_wasPressedLastFrame = false;
+};
@@ -0,0 +1,100 @@
+#include "Engine/JobSystem/Job.hpp"
+#include "Engine/JobSystem/JobCounter.hpp"
+#include "Engine/JobSystem/JobCancellationToken.hpp"
+#include "Engine/JobSystem/JobSystem.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+
+
+//
+//dependent list functions
+//
+bool JobDependentList::TryAddDependent(Job* dependentJob)
+{
+	m_mutex.lock();
+	bool wasAdded = !m_isReleased;
+	if (wasAdded)
+	{
+		m_dependentJobs.emplace_back(dependentJob);
+	}
+	m_mutex.unlock();
+
+	return wasAdded;
+}
+
+
+void JobDependentList::ReleaseDependents(std::vector<Job*>& out_dependentJobs)
+{
+	m_mutex.lock();
+	m_isReleased = true;
+	out_dependentJobs.swap(m_dependentJobs);
+	m_dependentJobs.clear();
+	m_mutex.unlock();
+}
+
+
+void JobDependentList::Reset()
+{
+	m_mutex.lock();
+	m_isReleased = false;
+	m_mutex.unlock();
+}
+
+
+//
+//dependency functions
+//
+void Job::AddPrerequisite(Job* prerequisiteJob)
+{
+	//count it first so the prerequisite finishing right after the add can't drop us below zero
+	m_numUnfinishedPrerequisites++;
+	if (!prerequisiteJob->m_dependents.TryAddDependent(this))
+	{
+		m_numUnfinishedPrerequisites--;
+	}
+}
+
+
+void Job::AddPrerequisite(JobCounter* prerequisiteCounter)
+{
+	m_numUnfinishedPrerequisites++;
+	if (!prerequisiteCounter->m_dependents.TryAddDependent(this))
+	{
+		m_numUnfinishedPrerequisites--;
+	}
+}
+
+
+//
+//yield functions
+//
+void Job::YieldUntil(JobCounter* counter)
+{
+	GUARANTEE_OR_DIE(m_status.load() == JobStatus::EXECUTING, "Jobs can only yield from inside Execute!");
+	GUARANTEE_OR_DIE(m_yieldCounter == nullptr && m_yieldJob == nullptr, "Job yielded twice in one Execute!");
+
+	//only recorded here, the job can't start waiting until Execute has returned and nothing else is touching it
+	m_yieldCounter = counter;
+}
+
+
+void Job::YieldUntil(Job* job)
+{
+	GUARANTEE_OR_DIE(m_status.load() == JobStatus::EXECUTING, "Jobs can only yield from inside Execute!");
+	GUARANTEE_OR_DIE(m_yieldCounter == nullptr && m_yieldJob == nullptr, "Job yielded twice in one Execute!");
+
+	m_yieldJob = job;
+}
+
+
+//
+//cancellation functions
+//
+bool Job::IsCancelled() const
+{
+	if (m_cancellationToken != nullptr && m_cancellationToken->IsCancelled())
+	{
+		return true;
+	}
+
+	return g_theJobSystem->GetCancelGeneration(m_category) != m_cancelGeneration;
+}
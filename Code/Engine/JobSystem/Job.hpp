@@ -1,11 +1,136 @@
-#pragma once
-
-
-class Job
-{
-//public member functions
-public:
-	virtual ~Job() {}
-
-	virtual void Execute() = 0;
-};
+#pragma once
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+
+//forward declarations
+class Job;
+class JobCounter;
+class JobCancellationToken;
+
+
+//jobs waiting on a job or counter, handed back exactly once when it finishes
+class JobDependentList
+{
+//public member functions
+public:
+	bool TryAddDependent(Job* dependentJob);
+	void ReleaseDependents(std::vector<Job*>& out_dependentJobs);
+	void Reset();
+
+//private member variables
+private:
+	std::mutex		  m_mutex;
+	std::vector<Job*> m_dependentJobs;
+	bool			  m_isReleased = false;
+};
+
+
+//order jobs are picked up in, a worker always drains higher priorities first
+enum class JobPriority
+{
+	HIGH,		//frame-critical work the game is about to wait on (culling, ParallelFor helpers)
+	NORMAL,
+	LOW,		//background work that can slip a few frames
+	COUNT
+};
+
+
+//kind of work a job does, workers can be dedicated to one category so slow work can't starve the rest
+enum class JobCategory
+{
+	GENERAL,	//short compute jobs
+	BACKGROUND,	//long-running compute such as pathfinding
+	IO,			//file and asset loading, mostly blocked on the disk
+	COUNT
+};
+
+
+//where a job is in its lifetime, only ever moves forward until the job is posted again
+enum class JobStatus
+{
+	NEW,
+	WAITING,	//posted, but still has unfinished prerequisites
+	QUEUED,
+	EXECUTING,
+	COMPLETED,	//finished or skipped after being cancelled, claimable jobs now wait in the completed list
+	CLAIMED,
+	COUNT
+};
+
+
+//who is responsible for a job once it finishes
+enum class JobOwnership
+{
+	CLAIMED_BY_CALLER,	//goes to the completed list, caller gets it back from ClaimCompletedJob and deletes it
+	OWNED_BY_POSTER,	//job system forgets about it, poster tracks completion itself (e.g. ParallelFor helpers)
+	POOLED,				//reference counted and freed back to the job pool by the job system (Submit)
+};
+
+
+class Job
+{
+	friend class JobSystem;
+	friend class JobCounter;
+
+//public member functions
+public:
+	virtual ~Job() {}
+
+	virtual void Execute() = 0;
+
+	//dependency functions, must be called before the job is posted
+	void AddPrerequisite(Job* prerequisiteJob);
+	void AddPrerequisite(JobCounter* prerequisiteCounter);
+	void SetCompletionCounter(JobCounter* completionCounter) { m_completionCounter = completionCounter; }
+
+	//scheduling functions, must be called before the job is posted
+	void SetPriority(JobPriority priority) { m_priority = priority; }
+	void SetCategory(JobCategory category) { m_category = category; }
+	JobPriority GetPriority() const { return m_priority; }
+	JobCategory GetCategory() const { return m_category; }
+	JobStatus	GetStatus() const { return m_status.load(); }
+
+	//cancellation functions, queued jobs that are cancelled get skipped and long jobs should poll IsCancelled
+	void SetCancellationToken(JobCancellationToken* cancellationToken) { m_cancellationToken = cancellationToken; }
+	bool IsCancelled() const;
+	bool WasCancelled() const { return m_wasCancelled; }	//true once a finished job was skipped instead of executed
+
+	//how many times Execute has been re-entered after a YieldUntil since the job was posted
+	int GetResumeCount() const { return m_resumeCount; }
+
+//protected member functions
+protected:
+	//yield functions, call from Execute and then return: the worker is handed back and Execute runs again once the wait is over
+	//this is a stackless restart, not a coroutine or fiber suspension: Execute starts again from the top and nothing on the stack survives
+	//so jobs that yield must be idempotent up to the yield, keep whatever the next run needs in members (GetResumeCount tells the runs apart)
+	void YieldUntil(JobCounter* counter);
+	void YieldUntil(Job* job);
+
+//protected member variables
+protected:
+	JobOwnership	 m_ownership = JobOwnership::CLAIMED_BY_CALLER;
+
+//private member variables
+private:
+	//starts at one for the hold PostNewJob releases, so a job never runs before it's posted
+	std::atomic<int> m_numUnfinishedPrerequisites = 1;
+	JobDependentList m_dependents;
+	JobCounter*		 m_completionCounter = nullptr;
+	JobPriority		 m_priority = JobPriority::NORMAL;
+	JobCategory		 m_category = JobCategory::GENERAL;
+
+	std::atomic<JobStatus> m_status = JobStatus::NEW;
+	Job*				   m_nextCompletedJob = nullptr;	//intrusive link for the completed list
+	double				   m_queuedTime = 0.0;				//for queue latency telemetry
+
+	JobCancellationToken* m_cancellationToken = nullptr;
+	unsigned int		  m_cancelGeneration = 0;		//category's generation when posted, see JobSystem::CancelQueuedJobs
+	bool				  m_wasCancelled = false;
+
+	//set by YieldUntil, JobSystem re-queues the job on them after Execute returns instead of finishing it
+	JobCounter* m_yieldCounter = nullptr;
+	Job*		m_yieldJob = nullptr;
+	int			m_resumeCount = 0;
+};
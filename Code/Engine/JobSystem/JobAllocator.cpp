@@ -0,0 +1,137 @@
+#include "Engine/JobSystem/JobAllocator.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <malloc.h>
+
+
+//
+//destructor
+//
+JobAllocator::~JobAllocator()
+{
+	int numPages = m_numPages.load();
+	for (int pageIndex = 0; pageIndex < numPages; pageIndex++)
+	{
+		_aligned_free(m_pages[pageIndex]->m_blocks);
+		delete m_pages[pageIndex];
+	}
+}
+
+
+//
+//block functions
+//
+void* JobAllocator::AllocateBlock()
+{
+	uint64_t head = m_freeListHead.load(std::memory_order_acquire);
+
+	while (true)
+	{
+		uint32_t firstFreeBlock = static_cast<uint32_t>(head);
+		if (firstFreeBlock == 0)
+		{
+			AddPage();
+			head = m_freeListHead.load(std::memory_order_acquire);
+			continue;
+		}
+
+		//the link may be stale if another thread popped this block first, the tag makes the exchange fail in that case
+		uint32_t blockIndex = firstFreeBlock - 1;
+		uint32_t nextFreeBlock = GetNextFreeBlock(blockIndex).load(std::memory_order_relaxed);
+		uint64_t newHead = (((head >> 32) + 1) << 32) | nextFreeBlock;
+
+		if (m_freeListHead.compare_exchange_weak(head, newHead, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			m_numBlocksInUse++;
+			return GetBlock(blockIndex) + BLOCK_HEADER_SIZE;
+		}
+	}
+}
+
+
+void JobAllocator::FreeBlock(void* blockData)
+{
+	unsigned char* block = static_cast<unsigned char*>(blockData) - BLOCK_HEADER_SIZE;
+	uint32_t blockIndex = *reinterpret_cast<uint32_t*>(block);
+
+	uint64_t head = m_freeListHead.load(std::memory_order_relaxed);
+	uint64_t newHead = 0;
+	do
+	{
+		GetNextFreeBlock(blockIndex).store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+		newHead = (((head >> 32) + 1) << 32) | (blockIndex + 1);
+	}
+	while (!m_freeListHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+
+	m_numBlocksInUse--;
+}
+
+
+//
+//accessors
+//
+int JobAllocator::GetNumBlocks() const
+{
+	return m_numPages.load() * BLOCKS_PER_PAGE;
+}
+
+
+//
+//private functions
+//
+void JobAllocator::AddPage()
+{
+	m_addPageMutex.lock();
+
+	//another thread may have already grown the pool while we waited
+	if (static_cast<uint32_t>(m_freeListHead.load()) != 0)
+	{
+		m_addPageMutex.unlock();
+		return;
+	}
+
+	int pageIndex = m_numPages.load();
+	GUARANTEE_OR_DIE(pageIndex < MAX_PAGES, "Ran out of job pool pages, too many pooled jobs in flight!");
+
+	JobAllocatorPage* page = new JobAllocatorPage();
+
+	//new[] only promises 8 byte alignment on Win32, jobs with SIMD members need the full BLOCK_ALIGNMENT
+	page->m_blocks = static_cast<unsigned char*>(_aligned_malloc(BLOCKS_PER_PAGE * BLOCK_SIZE, BLOCK_ALIGNMENT));
+	GUARANTEE_OR_DIE(page->m_blocks != nullptr, "Failed to allocate a job pool page!");
+
+	//write each block's index into its header once, and chain the page's blocks together
+	uint32_t firstBlockIndex = static_cast<uint32_t>(pageIndex * BLOCKS_PER_PAGE);
+	for (int blockIndexInPage = 0; blockIndexInPage < BLOCKS_PER_PAGE; blockIndexInPage++)
+	{
+		uint32_t blockIndex = firstBlockIndex + blockIndexInPage;
+		*reinterpret_cast<uint32_t*>(page->m_blocks + blockIndexInPage * BLOCK_SIZE) = blockIndex;
+		page->m_nextFreeBlock[blockIndexInPage].store(blockIndex + 2, std::memory_order_relaxed);
+	}
+
+	m_pages[pageIndex] = page;
+	m_numPages = pageIndex + 1;
+
+	//splice the whole page onto the free list
+	std::atomic<uint32_t>& lastNextFreeBlock = page->m_nextFreeBlock[BLOCKS_PER_PAGE - 1];
+	uint64_t head = m_freeListHead.load(std::memory_order_relaxed);
+	uint64_t newHead = 0;
+	do
+	{
+		lastNextFreeBlock.store(static_cast<uint32_t>(head), std::memory_order_relaxed);
+		newHead = (((head >> 32) + 1) << 32) | (firstBlockIndex + 1);
+	}
+	while (!m_freeListHead.compare_exchange_weak(head, newHead, std::memory_order_release, std::memory_order_relaxed));
+
+	m_addPageMutex.unlock();
+}
+
+
+std::atomic<uint32_t>& JobAllocator::GetNextFreeBlock(uint32_t blockIndex)
+{
+	return m_pages[blockIndex / BLOCKS_PER_PAGE]->m_nextFreeBlock[blockIndex % BLOCKS_PER_PAGE];
+}
+
+
+unsigned char* JobAllocator::GetBlock(uint32_t blockIndex)
+{
+	return m_pages[blockIndex / BLOCKS_PER_PAGE]->m_blocks + (blockIndex % BLOCKS_PER_PAGE) * BLOCK_SIZE;
+}
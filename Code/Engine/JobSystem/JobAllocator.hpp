@@ -0,0 +1,54 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+
+
+//lock-free pool of fixed-size blocks for short-lived jobs, blocks are only freed when the allocator is destroyed
+class JobAllocator
+{
+//public member functions
+public:
+	static constexpr size_t BLOCK_SIZE = 256;
+	static constexpr size_t BLOCK_HEADER_SIZE = 16;
+	static constexpr size_t BLOCK_ALIGNMENT = 16;
+	static constexpr size_t MAX_BLOCK_DATA_SIZE = BLOCK_SIZE - BLOCK_HEADER_SIZE;
+
+	//constructor and destructor
+	JobAllocator() {}
+	JobAllocator(JobAllocator const& copy) = delete;
+	~JobAllocator();
+
+	//block functions
+	void* AllocateBlock();
+	void  FreeBlock(void* blockData);
+
+	//accessors
+	int GetNumBlocks() const;
+	int GetNumBlocksInUse() const { return m_numBlocksInUse.load(); }
+
+//private member functions
+private:
+	static constexpr int BLOCKS_PER_PAGE = 1024;
+	static constexpr int MAX_PAGES = 1024;
+
+	struct JobAllocatorPage
+	{
+		unsigned char*		  m_blocks = nullptr;
+		std::atomic<uint32_t> m_nextFreeBlock[BLOCKS_PER_PAGE];	//block index + 1 of the next free block, 0 ends the list
+	};
+
+	void AddPage();
+	std::atomic<uint32_t>& GetNextFreeBlock(uint32_t blockIndex);
+	unsigned char* GetBlock(uint32_t blockIndex);
+
+//private member variables
+private:
+	JobAllocatorPage* m_pages[MAX_PAGES] = {};
+	std::atomic<int>  m_numPages = 0;
+	std::mutex		  m_addPageMutex;
+
+	//low 32 bits are the first free block index + 1, high 32 bits are a tag bumped on every change to avoid ABA
+	std::atomic<uint64_t> m_freeListHead = 0;
+	std::atomic<int>	  m_numBlocksInUse = 0;
+};
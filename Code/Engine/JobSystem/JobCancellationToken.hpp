@@ -0,0 +1,23 @@
+#pragma once
+#include <atomic>
+
+
+//shared flag for cancelling a job or a whole group of jobs, must outlive every job that uses it
+class JobCancellationToken
+{
+//public member functions
+public:
+	//constructor and destructor
+	JobCancellationToken() {}
+	JobCancellationToken(JobCancellationToken const& copy) = delete;
+	~JobCancellationToken() {}
+
+	//token functions
+	void Cancel() { m_isCancelled = true; }
+	void Reset() { m_isCancelled = false; }
+	bool IsCancelled() const { return m_isCancelled.load(std::memory_order_relaxed); }
+
+//private member variables
+private:
+	std::atomic<bool> m_isCancelled = false;
+};
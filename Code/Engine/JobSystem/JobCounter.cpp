@@ -0,0 +1,50 @@
+#include "Engine/JobSystem/JobCounter.hpp"
+#include "Engine/JobSystem/JobSystem.hpp"
+
+
+//
+//constructor
+//
+JobCounter::JobCounter(int initialCount)
+	: m_count(initialCount)
+{
+	if (initialCount <= 0)
+	{
+		std::vector<Job*> noDependents;
+		m_dependents.ReleaseDependents(noDependents);
+		m_isComplete = true;
+	}
+}
+
+
+//
+//counter functions
+//
+void JobCounter::Increment(int amount)
+{
+	//reopen a counter that already hit zero so it can be waited on again
+	if (m_count.fetch_add(amount) == 0)
+	{
+		m_isComplete = false;
+		m_dependents.Reset();
+	}
+}
+
+
+void JobCounter::Decrement()
+{
+	if (m_count.fetch_sub(1) != 1)
+	{
+		return;
+	}
+
+	std::vector<Job*> dependentJobs;
+	m_dependents.ReleaseDependents(dependentJobs);
+	m_isComplete = true;
+
+	//counter may be destroyed from here on, only touch the local list
+	for (int jobIndex = 0; jobIndex < static_cast<int>(dependentJobs.size()); jobIndex++)
+	{
+		g_theJobSystem->ReleasePrerequisite(dependentJobs[jobIndex]);
+	}
+}
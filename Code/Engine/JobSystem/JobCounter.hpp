@@ -0,0 +1,32 @@
+#pragma once
+#include "Engine/JobSystem/Job.hpp"
+
+
+//shared count of outstanding jobs, jobs waiting on it get scheduled as soon as it reaches zero
+class JobCounter
+{
+	friend class Job;
+
+//public member functions
+public:
+	//constructor and destructor
+	explicit JobCounter(int initialCount = 0);
+	JobCounter(JobCounter const& copy) = delete;
+	~JobCounter() {}
+
+	//counter functions
+	void Increment(int amount = 1);
+	void Decrement();
+
+	//accessors
+	int  GetCount() const { return m_count.load(); }
+	bool IsComplete() const { return m_isComplete.load(); }
+
+//private member variables
+private:
+	std::atomic<int>  m_count = 0;
+	JobDependentList  m_dependents;
+
+	//set only after dependents are handed off, so it's safe to destroy the counter once this is true
+	std::atomic<bool> m_isComplete = false;
+};
@@ -0,0 +1,127 @@
+#include "Engine/JobSystem/JobDeque.hpp"
+#include "Engine/JobSystem/Job.hpp"
+
+
+//
+//constructor and destructor
+//
+JobDeque::JobDeque(int capacity)
+{
+	//round capacity up to a power of two so indices can wrap with a mask
+	int64_t powerOfTwoCapacity = 1;
+	while (powerOfTwoCapacity < capacity)
+	{
+		powerOfTwoCapacity <<= 1;
+	}
+
+	m_capacityMask = powerOfTwoCapacity - 1;
+	m_buffer = new std::atomic<Job*>[powerOfTwoCapacity];
+
+	for (int64_t slotIndex = 0; slotIndex < powerOfTwoCapacity; slotIndex++)
+	{
+		m_buffer[slotIndex].store(nullptr, std::memory_order_relaxed);
+	}
+}
+
+
+JobDeque::~JobDeque()
+{
+	delete[] m_buffer;
+}
+
+
+//
+//owner functions
+//
+bool JobDeque::Push(Job* job)
+{
+	int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+	int64_t top = m_top.load(std::memory_order_acquire);
+
+	//full, caller has to put the job somewhere else
+	if (bottom - top > m_capacityMask)
+	{
+		return false;
+	}
+
+	//release publishes the job to thieves that acquire bottom
+	m_buffer[bottom & m_capacityMask].store(job, std::memory_order_relaxed);
+	m_bottom.store(bottom + 1, std::memory_order_release);
+
+	return true;
+}
+
+
+Job* JobDeque::Pop()
+{
+	int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+	m_bottom.store(bottom, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t top = m_top.load(std::memory_order_relaxed);
+
+	//deque was already empty, restore bottom
+	if (top > bottom)
+	{
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	Job* job = m_buffer[bottom & m_capacityMask].load(std::memory_order_relaxed);
+
+	//last job in the deque, race any thieves for it
+	if (top == bottom)
+	{
+		if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+		{
+			job = nullptr;
+		}
+
+		m_bottom.store(bottom + 1, std::memory_order_relaxed);
+	}
+
+	return job;
+}
+
+
+//
+//thief functions
+//
+Job* JobDeque::Steal()
+{
+	int64_t top = m_top.load(std::memory_order_acquire);
+	std::atomic_thread_fence(std::memory_order_seq_cst);
+	int64_t bottom = m_bottom.load(std::memory_order_acquire);
+
+	if (top >= bottom)
+	{
+		return nullptr;
+	}
+
+	Job* job = m_buffer[top & m_capacityMask].load(std::memory_order_relaxed);
+
+	//lost the race to the owner or another thief
+	if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+	{
+		return nullptr;
+	}
+
+	return job;
+}
+
+
+//
+//accessors
+//
+bool JobDeque::IsEmpty() const
+{
+	return GetApproximateSize() <= 0;
+}
+
+
+int JobDeque::GetApproximateSize() const
+{
+	int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+	int64_t top = m_top.load(std::memory_order_relaxed);
+
+	return static_cast<int>(bottom - top);
+}
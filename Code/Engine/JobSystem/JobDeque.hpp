@@ -0,0 +1,41 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+
+//forward declarations
+class Job;
+
+
+//fixed-capacity Chase-Lev work-stealing deque
+//only the owning worker may call Push and Pop (LIFO end), any thread may call Steal (FIFO end)
+class JobDeque
+{
+//public member functions
+public:
+	//constructor and destructor
+	explicit JobDeque(int capacity);
+	JobDeque(JobDeque const& copy) = delete;
+	~JobDeque();
+
+	//owner functions
+	bool Push(Job* job);
+	Job* Pop();
+
+	//thief functions
+	Job* Steal();
+
+	//accessors
+	bool IsEmpty() const;
+	int	 GetApproximateSize() const;
+
+//private member variables
+private:
+	std::atomic<Job*>*	 m_buffer = nullptr;
+	int64_t				 m_capacityMask = 0;
+
+	//thieves hit top and the owner hits bottom, keep them on separate cache lines
+	std::atomic<int64_t> m_top = 0;
+	char				 m_cacheLinePadding[64] = {};
+	std::atomic<int64_t> m_bottom = 0;
+};
@@ -0,0 +1,47 @@
+#include "Engine/JobSystem/JobFuture.hpp"
+#include "Engine/JobSystem/JobSystem.hpp"
+
+
+//
+//constructor
+//
+PooledJob::PooledJob(bool isInJobPool)
+	: m_isInJobPool(isInJobPool)
+{
+	m_ownership = JobOwnership::POOLED;
+}
+
+
+//
+//reference functions
+//
+void PooledJob::ReleaseReference()
+{
+	if (m_referenceCount.fetch_sub(1) != 1)
+	{
+		return;
+	}
+
+	//destroy through the virtual destructor, then hand the memory back to wherever it came from
+	bool isInJobPool = m_isInJobPool;
+	void* jobMemory = this;
+	this->~PooledJob();
+
+	if (isInJobPool)
+	{
+		g_theJobSystem->FreeJobBlock(jobMemory);
+	}
+	else
+	{
+		::operator delete(jobMemory);
+	}
+}
+
+
+//
+//accessors
+//
+void PooledJob::WaitUntilFinished() const
+{
+	g_theJobSystem->WaitForJobs(this);
+}
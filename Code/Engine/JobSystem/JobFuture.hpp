@@ -0,0 +1,190 @@
+#pragma once
+#include "Engine/JobSystem/Job.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+
+//reference counted job that lives in a job pool block (or on the heap if it didn't fit), freed by whoever drops the last reference
+class PooledJob : public Job
+{
+//public member functions
+public:
+	explicit PooledJob(bool isInJobPool);
+
+	//reference functions
+	void AddReference() { m_referenceCount++; }
+	void ReleaseReference();
+
+	//accessors, a job that was cancelled counts as finished but has no result
+	bool IsFinished() const { return GetStatus() == JobStatus::COMPLETED; }
+	void WaitUntilFinished() const;
+
+//protected member variables
+protected:
+	std::atomic<int>  m_referenceCount = 1;
+	bool			  m_isInJobPool = true;
+};
+
+
+//storage for a job's return value, specialized below so void functions need no storage
+template<typename T_Result>
+class JobResultStorage
+{
+//public member functions
+public:
+	typedef T_Result const& GetType;
+
+	~JobResultStorage()
+	{
+		if (m_hasValue)
+		{
+			reinterpret_cast<T_Result*>(&m_value)->~T_Result();
+		}
+	}
+
+	template<typename T_Function>
+	void StoreResultOf(T_Function& function)
+	{
+		new (&m_value) T_Result(function());
+		m_hasValue = true;
+	}
+
+	GetType Get() const { return *reinterpret_cast<T_Result const*>(&m_value); }
+
+//private member variables
+private:
+	typename std::aligned_storage<sizeof(T_Result), alignof(T_Result)>::type m_value;
+	bool m_hasValue = false;
+};
+
+
+template<>
+class JobResultStorage<void>
+{
+//public member functions
+public:
+	typedef void GetType;
+
+	template<typename T_Function>
+	void StoreResultOf(T_Function& function)
+	{
+		function();
+	}
+
+	GetType Get() const {}
+};
+
+
+//pooled job that produces a value of type T_Result
+template<typename T_Result>
+class ResultJob : public PooledJob
+{
+//public member functions
+public:
+	explicit ResultJob(bool isInJobPool)
+		: PooledJob(isInJobPool)
+	{}
+
+	typename JobResultStorage<T_Result>::GetType GetResult() const { return m_result.Get(); }
+
+//protected member variables
+protected:
+	JobResultStorage<T_Result> m_result;
+};
+
+
+//job wrapping any function object, created by JobSystem::Submit
+template<typename T_Result, typename T_Function>
+class LambdaJob : public ResultJob<T_Result>
+{
+//public member functions
+public:
+	template<typename T_FunctionArg>
+	LambdaJob(T_FunctionArg&& function, bool isInJobPool)
+		: ResultJob<T_Result>(isInJobPool)
+		, m_function(std::forward<T_FunctionArg>(function))
+	{}
+
+	virtual void Execute() override
+	{
+		this->m_result.StoreResultOf(m_function);
+	}
+
+//private member variables
+private:
+	T_Function m_function;
+};
+
+
+//move-only handle to a submitted job's result, the job's memory is recycled once both the job and the future are done with it
+template<typename T_Result>
+class JobFuture
+{
+//public member functions
+public:
+	//constructors and destructor
+	JobFuture() {}
+	explicit JobFuture(ResultJob<T_Result>* job)
+		: m_job(job)
+	{}
+	JobFuture(JobFuture const& copy) = delete;
+	JobFuture(JobFuture&& moveFrom)
+		: m_job(moveFrom.m_job)
+	{
+		moveFrom.m_job = nullptr;
+	}
+	~JobFuture()
+	{
+		Reset();
+	}
+
+	JobFuture& operator=(JobFuture const& copyFrom) = delete;
+	JobFuture& operator=(JobFuture&& moveFrom)
+	{
+		if (this != &moveFrom)
+		{
+			Reset();
+			m_job = moveFrom.m_job;
+			moveFrom.m_job = nullptr;
+		}
+		return *this;
+	}
+
+	//future functions
+	bool IsValid() const { return m_job != nullptr; }
+	bool IsReady() const { return m_job != nullptr && m_job->IsFinished(); }
+	bool WasCancelled() const { return IsReady() && m_job->WasCancelled(); }
+	void Wait() const
+	{
+		if (m_job != nullptr)
+		{
+			m_job->WaitUntilFinished();
+		}
+	}
+
+	//waits if needed, the returned reference is valid as long as this future is
+	typename JobResultStorage<T_Result>::GetType Get() const
+	{
+		Wait();
+		GUARANTEE_OR_DIE(!m_job->WasCancelled(), "Tried to get the result of a cancelled job!");
+		return m_job->GetResult();
+	}
+
+	//underlying job, usable as a prerequisite for other jobs while this future is alive
+	Job* GetJob() const { return m_job; }
+
+	void Reset()
+	{
+		if (m_job != nullptr)
+		{
+			m_job->ReleaseReference();
+			m_job = nullptr;
+		}
+	}
+
+//private member variables
+private:
+	ResultJob<T_Result>* m_job = nullptr;
+};
@@ -1,177 +1,807 @@
-#include "Engine/JobSystem/JobSystem.hpp"
-#include "Engine/JobSystem/Job.hpp"
-
-
-//global variable declaration
-JobSystem* g_theJobSystem = nullptr;
-
-
-//
-//static functions
-//
-void JobSystem::ThreadMain(int threadID)
-{
-	UNUSED(threadID);
-
-	while (!g_theJobSystem->m_isQuitting)
-	{
-		//look for available job
-		Job* claimedJob = g_theJobSystem->GetNewJobToWorkOn();
-
-		//if found, claim job and move job from unclaimed list to claimed list in thread safe way
-		if (claimedJob != nullptr)
-		{
-			//move job to claimed list in thread safe way
-			g_theJobSystem->m_claimedJobsMutex.lock();
-			g_theJobSystem->m_claimedJobs.emplace_back(claimedJob);
-			g_theJobSystem->m_claimedJobsMutex.unlock();
-
-			//call execute on claimed job
-			claimedJob->Execute();
-
-			//move to out of claimed list and into completed list in thread safe way
-			g_theJobSystem->m_claimedJobsMutex.lock();
-
-			//erase-remove idiom to remove job from vector
-			g_theJobSystem->m_claimedJobs.erase(std::remove_if(
-				g_theJobSystem->m_claimedJobs.begin(),
-				g_theJobSystem->m_claimedJobs.end(),
-				[=](auto const& element)
-				{
-					return element == claimedJob;
-				}),
-				g_theJobSystem->m_claimedJobs.end()
-			);
-
-			g_theJobSystem->m_claimedJobsMutex.unlock();
-
-			g_theJobSystem->m_completedJobsMutex.lock();
-			g_theJobSystem->m_completedJobs.emplace(claimedJob);
-			g_theJobSystem->m_completedJobsMutex.unlock();
-		}
-		else
-		{
-			//if not found, sleep for ten microseconds
-			std::this_thread::sleep_for(std::chrono::microseconds(10));
-		}
-	}
-}
-
-
-//
-//game flow functions
-//
-void JobSystem::Startup()
-{
-}
-
-
-void JobSystem::Shutdown()
-{
-	//backup in case game doesn't destroy all workers on its own (game would want to do it on its own if it restarts without app restarting)
-	if (m_workerThreads.size() > 0)
-	{
-		ClearJobSystem();
-	}
-}
-
-//
-//worker management functions
-//
-void JobSystem::CreateWorkers(int numWorkers)
-{
-	for (int threadIndex = 0; threadIndex < numWorkers; threadIndex++)
-	{
-		std::thread* thread = new std::thread(JobSystem::ThreadMain, threadIndex);
-		m_workerThreads.emplace_back(new JobWorkerThread(thread, threadIndex));
-	}
-}
-
-
-void JobSystem::ClearJobSystem()
-{
-	m_isQuitting = true;
-
-	for (int threadIndex = 0; threadIndex < m_workerThreads.size(); threadIndex++)
-	{
-		JobWorkerThread*& workerThread = m_workerThreads[threadIndex];
-
-		if (workerThread != nullptr)
-		{
-			workerThread->m_thread->join();
-			delete workerThread;
-		}
-	}
-
-	m_workerThreads.clear();
-
-	//lock completed jobs mutex and delete all completed jobs that weren't already retrieved
-	m_completedJobsMutex.lock();
-	while (m_completedJobs.size() > 0)
-	{
-		Job* uncompletedJob = m_completedJobs.front();
-		m_completedJobs.pop();
-		delete uncompletedJob;
-	}
-	m_completedJobsMutex.unlock();
-
-	//I don't think you have to delete unclaimed or claimed jobs list because they'll definitely get done before worker threads join
-}
-
-
-//
-//job management functions
-//
-void JobSystem::PostNewJob(Job* job)
-{
-	m_unclaimedJobsMutex.lock();
-	m_unclaimedJobs.emplace(job);
-	m_unclaimedJobsMutex.unlock();
-}
-
-
-Job* JobSystem::GetNewJobToWorkOn()
-{
-	Job* newJob = nullptr;
-	
-	m_unclaimedJobsMutex.lock();
-	if (!m_unclaimedJobs.empty())
-	{
-		newJob = m_unclaimedJobs.front();
-		m_unclaimedJobs.pop();
-	}
-	m_unclaimedJobsMutex.unlock();
-
-	return newJob;
-}
-
-
-Job* JobSystem::ClaimCompletedJob()
-{
-	Job* completedJob = nullptr;
-	
-	m_completedJobsMutex.lock();
-	if (!m_completedJobs.empty())
-	{
-		completedJob = m_completedJobs.front();
-		m_completedJobs.pop();
-	}
-	m_completedJobsMutex.unlock();
-
-	return completedJob;
-}
-
-
-bool JobSystem::AreThereCompletedJobs()
-{
-	bool isCompletedQueueFull = true;
-	
-	m_completedJobsMutex.lock();
-	if(m_completedJobs.empty())
-	{
-		isCompletedQueueFull = false;
-	}
-	m_completedJobsMutex.unlock();
-
-	return isCompletedQueueFull;
-}
+#include "Engine/JobSystem/JobSystem.hpp"
+#include "Engine/JobSystem/Job.hpp"
+#include "Engine/JobSystem/JobCounter.hpp"
+#include "Engine/JobSystem/JobFuture.hpp"
+#include "Engine/Core/Time.hpp"
+#include "Engine/Core/DevConsole.hpp"
+#include "Engine/Core/StringUtils.hpp"
+
+
+//global variable declaration
+JobSystem* g_theJobSystem = nullptr;
+
+//index into m_workerThreads for worker threads, -1 for any other thread
+static thread_local int s_currentWorkerIndex = -1;
+
+static char const* const s_jobCategoryNames[(int)JobCategory::COUNT] = { "General", "Background", "IO" };
+
+
+//
+//static functions
+//
+void JobSystem::ThreadMain(int threadID)
+{
+	s_currentWorkerIndex = threadID;
+
+	while (!g_theJobSystem->m_isQuitting)
+	{
+		//look for available job
+		Job* claimedJob = g_theJobSystem->GetNewJobToWorkOn();
+
+		//if found, run it and hand it off to the completed list
+		if (claimedJob != nullptr)
+		{
+			g_theJobSystem->ExecuteJob(claimedJob);
+		}
+		else
+		{
+			//if not found, park until a new job gets posted
+			g_theJobSystem->WaitForNewJobs(threadID);
+		}
+	}
+}
+
+
+bool JobSystem::Command_JobStats(EventArgs& args)
+{
+	if (g_theJobSystem == nullptr || g_theDevConsole == nullptr)
+	{
+		return false;
+	}
+
+	g_theJobSystem->PrintTelemetryToDevConsole();
+
+	if (args.GetValue("Reset", false))
+	{
+		g_theJobSystem->ResetTelemetry();
+	}
+
+	return true;
+}
+
+
+//
+//game flow functions
+//
+void JobSystem::Startup()
+{
+	SubscribeEventCallbackFunction("jobstats", Command_JobStats);
+
+	for (int categoryIndex = 0; categoryIndex < (int)JobCategory::COUNT; categoryIndex++)
+	{
+		if (m_config.m_numWorkersPerCategory[categoryIndex] > 0)
+		{
+			CreateWorkers(m_config.m_numWorkersPerCategory[categoryIndex], (JobCategory)categoryIndex);
+		}
+	}
+}
+
+
+void JobSystem::Shutdown()
+{
+	//backup in case game doesn't destroy all workers on its own (game would want to do it on its own if it restarts without app restarting)
+	if (m_workerThreads.size() > 0)
+	{
+		ClearJobSystem();
+	}
+}
+
+//
+//worker management functions
+//
+void JobSystem::CreateWorkers(int numWorkers, JobCategory category)
+{
+	//reserve up front so thieves can index the vector while more workers are being added
+	if (m_workerThreads.capacity() < static_cast<size_t>(m_config.m_maxWorkers))
+	{
+		GUARANTEE_OR_DIE(m_workerThreads.empty(), "Can't grow worker list while workers are running!");
+		m_workerThreads.reserve(m_config.m_maxWorkers);
+	}
+
+	int firstThreadIndex = static_cast<int>(m_workerThreads.size());
+	GUARANTEE_OR_DIE(firstThreadIndex + numWorkers <= m_config.m_maxWorkers, "Tried to create more job workers than JobSystemConfig allows!");
+
+	//each worker's deque has to exist before any thread can try to steal from it
+	double currentTime = GetCurrentTimeSeconds();
+	for (int threadIndex = firstThreadIndex; threadIndex < firstThreadIndex + numWorkers; threadIndex++)
+	{
+		m_workerThreads.emplace_back(new JobWorkerThread(threadIndex, category, m_config.m_workerQueueCapacity));
+		m_workerThreads[threadIndex]->m_stats.m_startTimeSeconds = currentTime;
+	}
+	m_numWorkers = firstThreadIndex + numWorkers;
+	m_numWorkersInCategory[(int)category] += numWorkers;
+
+	for (int threadIndex = firstThreadIndex; threadIndex < firstThreadIndex + numWorkers; threadIndex++)
+	{
+		m_workerThreads[threadIndex]->m_thread = new std::thread(JobSystem::ThreadMain, threadIndex);
+	}
+}
+
+
+void JobSystem::ClearJobSystem(double maxDrainSeconds)
+{
+	//give queued work a bounded amount of time to finish, helping out from this thread meanwhile
+	double drainEndTime = GetCurrentTimeSeconds() + maxDrainSeconds;
+	while (m_numUnfinishedJobs.load() > 0 && GetCurrentTimeSeconds() < drainEndTime)
+	{
+		HelpWhileWaiting();
+	}
+
+	//anything still queued gets skipped instead of executed, running jobs can poll IsCancelled to bail out early
+	CancelAllQueuedJobs();
+	m_isQuitting = true;
+
+	//wake every parked worker so it can see the quit flag
+	for (int categoryIndex = 0; categoryIndex < (int)JobCategory::COUNT; categoryIndex++)
+	{
+		WorkerSleepState& sleepState = m_sleepStates[categoryIndex];
+		sleepState.m_mutex.lock();
+		sleepState.m_condition.notify_all();
+		sleepState.m_mutex.unlock();
+	}
+
+	for (int threadIndex = 0; threadIndex < m_workerThreads.size(); threadIndex++)
+	{
+		JobWorkerThread*& workerThread = m_workerThreads[threadIndex];
+
+		if (workerThread != nullptr)
+		{
+			workerThread->m_thread->join();
+		}
+	}
+
+	//finish off whatever the workers left behind as cancelled, so futures, counters and dependents all resolve
+	Job* leftoverJob = PopAnyQueuedJob();
+	while (leftoverJob != nullptr)
+	{
+		RemoveQueuedJob(leftoverJob, 0.0);
+		m_categoryStats[(int)leftoverJob->m_category].m_numJobsCancelled.fetch_add(1, std::memory_order_relaxed);
+		leftoverJob->m_wasCancelled = true;
+		FinishJob(leftoverJob);
+		leftoverJob = PopAnyQueuedJob();
+	}
+
+	for (int threadIndex = 0; threadIndex < m_workerThreads.size(); threadIndex++)
+	{
+		delete m_workerThreads[threadIndex];
+	}
+
+	m_workerThreads.clear();
+	m_numWorkers = 0;
+	for (int categoryIndex = 0; categoryIndex < (int)JobCategory::COUNT; categoryIndex++)
+	{
+		m_numWorkersInCategory[categoryIndex] = 0;
+	}
+	m_isQuitting = false;
+
+	//delete all completed jobs that weren't already retrieved
+	Job* uncompletedJob = ClaimCompletedJob();
+	while (uncompletedJob != nullptr)
+	{
+		delete uncompletedJob;
+		uncompletedJob = ClaimCompletedJob();
+	}
+
+	//jobs still waiting on prerequisites that will never finish (e.g. a counter nobody decrements) are left to their owners
+}
+
+
+//
+//job pool functions
+//
+void* JobSystem::AllocateJobBlock()
+{
+	return m_jobAllocator.AllocateBlock();
+}
+
+
+void JobSystem::FreeJobBlock(void* block)
+{
+	m_jobAllocator.FreeBlock(block);
+}
+
+
+//
+//job management functions
+//
+void JobSystem::PostNewJob(Job* job)
+{
+	//allow a finished job object to be posted again
+	job->m_dependents.Reset();
+
+	job->m_wasCancelled = false;
+	job->m_resumeCount = 0;
+	job->m_cancelGeneration = GetCancelGeneration(job->m_category);
+
+	//drop the posting hold, the job only gets queued once all of its prerequisites are done too
+	job->m_status = JobStatus::WAITING;
+	ReleasePrerequisite(job);
+}
+
+
+void JobSystem::QueueJob(Job* job)
+{
+	JobCategory category = GetQueueCategory(job->m_category);
+	int priorityIndex = (int)job->m_priority;
+	job->m_status = JobStatus::QUEUED;
+	m_numUnfinishedJobs++;
+
+	JobCategoryStats& categoryStats = m_categoryStats[(int)job->m_category];
+	categoryStats.m_numJobsQueued.fetch_add(1, std::memory_order_relaxed);
+	int numJobsInQueue = categoryStats.m_numJobsInQueue.fetch_add(1, std::memory_order_relaxed) + 1;
+	int peakJobsInQueue = categoryStats.m_peakJobsInQueue.load(std::memory_order_relaxed);
+	while (numJobsInQueue > peakJobsInQueue && !categoryStats.m_peakJobsInQueue.compare_exchange_weak(peakJobsInQueue, numJobsInQueue, std::memory_order_relaxed))
+	{
+	}
+
+	if (m_config.m_isTelemetryEnabled)
+	{
+		job->m_queuedTime = GetCurrentTimeSeconds();
+	}
+
+	//workers push onto their own deque so other workers can steal from it without a shared lock
+	bool wasPushedLocally = false;
+	int workerIndex = GetCurrentWorkerIndex();
+	if (workerIndex >= 0 && m_workerThreads[workerIndex]->m_category == category)
+	{
+		wasPushedLocally = m_workerThreads[workerIndex]->m_localJobs[priorityIndex]->Push(job);
+	}
+
+	if (!wasPushedLocally)
+	{
+		SharedJobQueue& sharedQueue = m_unclaimedJobs[(int)category][priorityIndex];
+		sharedQueue.m_mutex.lock();
+		sharedQueue.m_jobs.emplace(job);
+		sharedQueue.m_numJobs++;
+		sharedQueue.m_mutex.unlock();
+	}
+
+	WakeSleepingWorker(category);
+}
+
+
+Job* JobSystem::GetNewJobToWorkOn()
+{
+	Job* newJob = nullptr;
+	int workerIndex = GetCurrentWorkerIndex();
+
+	//threads that aren't workers (e.g. the main thread helping out) only take general jobs
+	JobWorkerThread* worker = (workerIndex >= 0) ? m_workerThreads[workerIndex] : nullptr;
+	JobCategory category = (worker != nullptr) ? worker->m_category : JobCategory::GENERAL;
+
+	//every source is drained of high priority jobs before any normal priority job is taken, and so on
+	for (int priorityIndex = 0; priorityIndex < (int)JobPriority::COUNT && newJob == nullptr; priorityIndex++)
+	{
+		//own deque first, newest job is the most likely to still be in cache
+		if (worker != nullptr)
+		{
+			newJob = worker->m_localJobs[priorityIndex]->Pop();
+		}
+
+		//then the shared queue, checking the counter first so an empty queue costs no lock
+		SharedJobQueue& sharedQueue = m_unclaimedJobs[(int)category][priorityIndex];
+		if (newJob == nullptr && sharedQueue.m_numJobs.load() > 0)
+		{
+			sharedQueue.m_mutex.lock();
+			if (!sharedQueue.m_jobs.empty())
+			{
+				newJob = sharedQueue.m_jobs.front();
+				sharedQueue.m_jobs.pop();
+				sharedQueue.m_numJobs--;
+			}
+			sharedQueue.m_mutex.unlock();
+		}
+
+		//finally take the oldest job from another worker of the same category
+		if (newJob == nullptr)
+		{
+			newJob = StealJob(workerIndex, category, (JobPriority)priorityIndex);
+			if (newJob != nullptr && worker != nullptr)
+			{
+				worker->m_stats.m_numJobsStolen.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+	}
+
+	return newJob;
+}
+
+
+Job* JobSystem::ClaimCompletedJob()
+{
+	//only touch the shared stack when the batch taken last time has run out
+	if (m_firstClaimableJob == nullptr)
+	{
+		DrainCompletedJobs();
+	}
+
+	Job* completedJob = m_firstClaimableJob;
+	if (completedJob != nullptr)
+	{
+		m_firstClaimableJob = completedJob->m_nextCompletedJob;
+		if (m_firstClaimableJob == nullptr)
+		{
+			m_lastClaimableJob = nullptr;
+		}
+
+		completedJob->m_nextCompletedJob = nullptr;
+		completedJob->m_status = JobStatus::CLAIMED;
+	}
+
+	return completedJob;
+}
+
+
+bool JobSystem::AreThereCompletedJobs()
+{
+	return m_firstClaimableJob != nullptr || m_completedJobsHead.load(std::memory_order_relaxed) != nullptr;
+}
+
+
+bool JobSystem::TryExecuteQueuedJob()
+{
+	//lets any thread (main thread included) chip in on queued work instead of blocking
+	Job* job = GetNewJobToWorkOn();
+	if (job == nullptr)
+	{
+		return false;
+	}
+
+	ExecuteJob(job);
+	return true;
+}
+
+
+void JobSystem::WaitForJobs(Job const* job)
+{
+	JobStatus status = job->GetStatus();
+	while (status != JobStatus::COMPLETED && status != JobStatus::CLAIMED)
+	{
+		HelpWhileWaiting();
+		status = job->GetStatus();
+	}
+}
+
+
+void JobSystem::WaitForJobs(JobCounter const* counter)
+{
+	while (!counter->IsComplete())
+	{
+		HelpWhileWaiting();
+	}
+}
+
+
+void JobSystem::HelpWhileWaiting()
+{
+	//quite possibly runs the very job being waited on, otherwise something else that would have kept a worker busy
+	if (!TryExecuteQueuedJob())
+	{
+		std::this_thread::yield();
+	}
+}
+
+
+void JobSystem::ExecuteJob(Job* job)
+{
+	job->m_status = JobStatus::EXECUTING;
+
+	double startTime = m_config.m_isTelemetryEnabled ? GetCurrentTimeSeconds() : 0.0;
+	RemoveQueuedJob(job, startTime);
+	JobCategoryStats& categoryStats = m_categoryStats[(int)job->m_category];
+
+	int workerIndex = GetCurrentWorkerIndex();
+	JobWorkerThread* worker = (workerIndex >= 0) ? m_workerThreads[workerIndex] : nullptr;
+
+	//a worker can be nested in here when it helps out while waiting, so restore whatever it was running before
+	Job* previousJob = nullptr;
+	if (worker != nullptr)
+	{
+		previousJob = worker->m_currentJob;
+		worker->m_currentJob = job;
+	}
+
+	//cancelled jobs still go through FinishJob so everything waiting on them is released
+	if (job->IsCancelled())
+	{
+		job->m_wasCancelled = true;
+		categoryStats.m_numJobsCancelled.fetch_add(1, std::memory_order_relaxed);
+	}
+	else
+	{
+		job->Execute();
+		categoryStats.m_numJobsExecuted.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	double executionSeconds = m_config.m_isTelemetryEnabled ? GetCurrentTimeSeconds() - startTime : 0.0;
+	if (m_config.m_isTelemetryEnabled)
+	{
+		categoryStats.m_executionLatency.AddSample(executionSeconds);
+	}
+
+	if (worker != nullptr)
+	{
+		worker->m_currentJob = previousJob;
+		worker->m_stats.m_numJobsExecuted.fetch_add(1, std::memory_order_relaxed);
+
+		//jobs run while helping inside another job are already covered by the outer job's time
+		if (previousJob == nullptr && m_config.m_isTelemetryEnabled)
+		{
+			worker->m_stats.m_busyMicroseconds.fetch_add(static_cast<uint64_t>(executionSeconds * 1000000.0), std::memory_order_relaxed);
+		}
+	}
+
+	//a job that yielded goes back to waiting instead of finishing
+	if (job->m_yieldCounter != nullptr || job->m_yieldJob != nullptr)
+	{
+		YieldJob(job);
+		return;
+	}
+
+	FinishJob(job);
+}
+
+
+void JobSystem::FinishJob(Job* job)
+{
+	//grab everything needed from the job before it's visible as completed, since it can be claimed and deleted right after
+	JobCounter* completionCounter = job->m_completionCounter;
+	JobOwnership ownership = job->m_ownership;
+	std::vector<Job*> dependentJobs;
+	job->m_dependents.ReleaseDependents(dependentJobs);
+	job->m_numUnfinishedPrerequisites = 1;
+
+	//nothing but pooled jobs may be touched after this, whoever owns the job is free to reuse or delete it
+	job->m_status = JobStatus::COMPLETED;
+	if (ownership == JobOwnership::CLAIMED_BY_CALLER)
+	{
+		PushCompletedJob(job);
+	}
+
+	//dependents go onto this worker's deque, so the next stage usually runs right here
+	for (int dependentIndex = 0; dependentIndex < static_cast<int>(dependentJobs.size()); dependentIndex++)
+	{
+		ReleasePrerequisite(dependentJobs[dependentIndex]);
+	}
+
+	//poster-owned jobs may be destroyed as soon as their counter completes, so this has to come last for them
+	if (completionCounter != nullptr)
+	{
+		completionCounter->Decrement();
+	}
+
+	//pooled jobs are kept alive by our reference until here
+	if (ownership == JobOwnership::POOLED)
+	{
+		static_cast<PooledJob*>(job)->ReleaseReference();
+	}
+
+	m_numUnfinishedJobs--;
+}
+
+
+void JobSystem::YieldJob(Job* job)
+{
+	JobCounter* yieldCounter = job->m_yieldCounter;
+	Job* yieldJob = job->m_yieldJob;
+	job->m_yieldCounter = nullptr;
+	job->m_yieldJob = nullptr;
+	job->m_resumeCount++;
+
+	//same hold as PostNewJob, so the job can't be resumed before it's registered with what it waits on
+	job->m_numUnfinishedPrerequisites = 1;
+	job->m_status = JobStatus::WAITING;
+	if (yieldCounter != nullptr)
+	{
+		job->AddPrerequisite(yieldCounter);
+	}
+	if (yieldJob != nullptr)
+	{
+		job->AddPrerequisite(yieldJob);
+	}
+
+	//the job may already be queued (or running on another worker) once the hold is dropped, don't touch it after this
+	ReleasePrerequisite(job);
+
+	//QueueJob counted it again when it was resumed, decrementing last keeps the count from dipping to zero in between
+	m_numUnfinishedJobs--;
+}
+
+
+void JobSystem::PushCompletedJob(Job* job)
+{
+	Job* head = m_completedJobsHead.load(std::memory_order_relaxed);
+	do
+	{
+		job->m_nextCompletedJob = head;
+	}
+	while (!m_completedJobsHead.compare_exchange_weak(head, job, std::memory_order_release, std::memory_order_relaxed));
+}
+
+
+void JobSystem::DrainCompletedJobs()
+{
+	Job* newestJob = m_completedJobsHead.exchange(nullptr, std::memory_order_acquire);
+	if (newestJob == nullptr)
+	{
+		return;
+	}
+
+	//the stack is newest first, reverse it so jobs are claimed in the order they completed
+	Job* oldestJob = nullptr;
+	Job* batchTail = newestJob;
+	while (newestJob != nullptr)
+	{
+		Job* nextJob = newestJob->m_nextCompletedJob;
+		newestJob->m_nextCompletedJob = oldestJob;
+		oldestJob = newestJob;
+		newestJob = nextJob;
+	}
+
+	if (m_lastClaimableJob != nullptr)
+	{
+		m_lastClaimableJob->m_nextCompletedJob = oldestJob;
+	}
+	else
+	{
+		m_firstClaimableJob = oldestJob;
+	}
+	m_lastClaimableJob = batchTail;
+}
+
+
+Job* JobSystem::PopAnyQueuedJob()
+{
+	for (int categoryIndex = 0; categoryIndex < (int)JobCategory::COUNT; categoryIndex++)
+	{
+		for (int priorityIndex = 0; priorityIndex < (int)JobPriority::COUNT; priorityIndex++)
+		{
+			SharedJobQueue& sharedQueue = m_unclaimedJobs[categoryIndex][priorityIndex];
+			Job* job = nullptr;
+
+			sharedQueue.m_mutex.lock();
+			if (!sharedQueue.m_jobs.empty())
+			{
+				job = sharedQueue.m_jobs.front();
+				sharedQueue.m_jobs.pop();
+				sharedQueue.m_numJobs--;
+			}
+			sharedQueue.m_mutex.unlock();
+
+			if (job != nullptr)
+			{
+				return job;
+			}
+		}
+	}
+
+	//only safe once the workers have joined, since this pops from the owner's end of their deques
+	for (int threadIndex = 0; threadIndex < m_workerThreads.size(); threadIndex++)
+	{
+		for (int priorityIndex = 0; priorityIndex < (int)JobPriority::COUNT; priorityIndex++)
+		{
+			Job* job = m_workerThreads[threadIndex]->m_localJobs[priorityIndex]->Pop();
+			if (job != nullptr)
+			{
+				return job;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+
+void JobSystem::ReleasePrerequisite(Job* dependentJob)
+{
+	if (dependentJob->m_numUnfinishedPrerequisites.fetch_sub(1) == 1)
+	{
+		QueueJob(dependentJob);
+	}
+}
+
+
+Job* JobSystem::StealJob(int thiefIndex, JobCategory category, JobPriority priority)
+{
+	int numWorkers = m_numWorkers.load();
+
+	//start with the next worker over so thieves don't all hammer worker 0
+	for (int offset = 1; offset <= numWorkers; offset++)
+	{
+		int victimIndex = (thiefIndex + offset) % numWorkers;
+		JobWorkerThread* victim = m_workerThreads[victimIndex];
+		if (victimIndex == thiefIndex || victim->m_category != category)
+		{
+			continue;
+		}
+
+		Job* stolenJob = victim->m_localJobs[(int)priority]->Steal();
+		if (stolenJob != nullptr)
+		{
+			return stolenJob;
+		}
+	}
+
+	return nullptr;
+}
+
+
+void JobSystem::RemoveQueuedJob(Job* job, double currentTime)
+{
+	JobCategoryStats& categoryStats = m_categoryStats[(int)job->m_category];
+	categoryStats.m_numJobsInQueue.fetch_sub(1, std::memory_order_relaxed);
+
+	if (m_config.m_isTelemetryEnabled && currentTime > 0.0)
+	{
+		categoryStats.m_queueLatency.AddSample(currentTime - job->m_queuedTime);
+	}
+}
+
+
+void JobSystem::WakeSleepingWorker(JobCategory category)
+{
+	WorkerSleepState& sleepState = m_sleepStates[(int)category];
+	sleepState.m_wakeCounter++;
+
+	//lock so the notify can't land between a sleeper checking its predicate and starting to wait
+	if (sleepState.m_numSleepingWorkers.load() > 0)
+	{
+		sleepState.m_mutex.lock();
+		sleepState.m_condition.notify_one();
+		sleepState.m_mutex.unlock();
+	}
+}
+
+
+void JobSystem::WaitForNewJobs(int workerIndex)
+{
+	JobCategory category = m_workerThreads[workerIndex]->m_category;
+	WorkerSleepState& sleepState = m_sleepStates[(int)category];
+
+	//register as sleeping before reading the counter, so a poster either sees us or we see its post
+	sleepState.m_numSleepingWorkers++;
+	uint64_t wakeCounter = sleepState.m_wakeCounter.load();
+
+	bool areThereQueuedJobs = false;
+	for (int priorityIndex = 0; priorityIndex < (int)JobPriority::COUNT && !areThereQueuedJobs; priorityIndex++)
+	{
+		areThereQueuedJobs = m_unclaimedJobs[(int)category][priorityIndex].m_numJobs.load() > 0;
+
+		int numWorkers = m_numWorkers.load();
+		for (int otherIndex = 0; otherIndex < numWorkers && !areThereQueuedJobs; otherIndex++)
+		{
+			JobWorkerThread* otherWorker = m_workerThreads[otherIndex];
+			if (otherIndex != workerIndex && otherWorker->m_category == category && !otherWorker->m_localJobs[priorityIndex]->IsEmpty())
+			{
+				areThereQueuedJobs = true;
+			}
+		}
+	}
+
+	if (!areThereQueuedJobs)
+	{
+		double sleepStartTime = m_config.m_isTelemetryEnabled ? GetCurrentTimeSeconds() : 0.0;
+
+		std::unique_lock<std::mutex> sleepLock(sleepState.m_mutex);
+		sleepState.m_condition.wait(sleepLock, [&]()
+			{
+				return m_isQuitting.load() || sleepState.m_wakeCounter.load() != wakeCounter;
+			});
+		sleepLock.unlock();
+
+		if (m_config.m_isTelemetryEnabled)
+		{
+			double sleepSeconds = GetCurrentTimeSeconds() - sleepStartTime;
+			m_workerThreads[workerIndex]->m_stats.m_sleepingMicroseconds.fetch_add(static_cast<uint64_t>(sleepSeconds * 1000000.0), std::memory_order_relaxed);
+		}
+	}
+
+	sleepState.m_numSleepingWorkers--;
+}
+
+
+JobCategory JobSystem::GetQueueCategory(JobCategory jobCategory) const
+{
+	//categories nobody was dedicated to fall back to the general workers rather than never running
+	if (m_numWorkersInCategory[(int)jobCategory].load() == 0)
+	{
+		return JobCategory::GENERAL;
+	}
+
+	return jobCategory;
+}
+
+
+//
+//cancellation functions
+//
+void JobSystem::CancelQueuedJobs(JobCategory category)
+{
+	//every job posted before this now compares unequal, so it gets skipped when a worker picks it up
+	m_cancelGenerations[(int)category]++;
+}
+
+
+void JobSystem::CancelAllQueuedJobs()
+{
+	for (int categoryIndex = 0; categoryIndex < (int)JobCategory::COUNT; categoryIndex++)
+	{
+		CancelQueuedJobs((JobCategory)categoryIndex);
+	}
+}
+
+
+//
+//accessors
+//
+int JobSystem::GetCurrentWorkerIndex() const
+{
+	return s_currentWorkerIndex;
+}
+
+
+//
+//telemetry functions
+//
+float JobSystem::GetWorkerUtilization(int workerIndex) const
+{
+	JobWorkerStats const& workerStats = m_workerThreads[workerIndex]->m_stats;
+	double elapsedSeconds = GetCurrentTimeSeconds() - workerStats.m_startTimeSeconds;
+	if (elapsedSeconds <= 0.0)
+	{
+		return 0.0f;
+	}
+
+	double busySeconds = static_cast<double>(workerStats.m_busyMicroseconds.load(std::memory_order_relaxed)) * 0.000001;
+	return static_cast<float>(busySeconds / elapsedSeconds);
+}
+
+
+void JobSystem::ResetTelemetry()
+{
+	double currentTime = GetCurrentTimeSeconds();
+	for (int threadIndex = 0; threadIndex < m_workerThreads.size(); threadIndex++)
+	{
+		m_workerThreads[threadIndex]->m_stats.Reset();
+		m_workerThreads[threadIndex]->m_stats.m_startTimeSeconds = currentTime;
+	}
+
+	for (int categoryIndex = 0; categoryIndex < (int)JobCategory::COUNT; categoryIndex++)
+	{
+		m_categoryStats[categoryIndex].Reset();
+	}
+}
+
+
+void JobSystem::PrintTelemetryToDevConsole() const
+{
+	g_theDevConsole->AddLine(DevConsole::COLOR_INFO_MAJOR, "Job categories (latencies in ms, avg / p50 / p99 / max):");
+	for (int categoryIndex = 0; categoryIndex < (int)JobCategory::COUNT; categoryIndex++)
+	{
+		JobCategoryStats const& categoryStats = m_categoryStats[categoryIndex];
+		JobLatencyHistogram const& queueLatency = categoryStats.m_queueLatency;
+		JobLatencyHistogram const& executionLatency = categoryStats.m_executionLatency;
+
+		g_theDevConsole->AddLine(DevConsole::COLOR_INFO_MINOR, Stringf("%-10s workers %d, queued %llu, executed %llu, cancelled %llu, in queue %d (peak %d)",
+			s_jobCategoryNames[categoryIndex], GetNumWorkersInCategory((JobCategory)categoryIndex),
+			categoryStats.m_numJobsQueued.load(), categoryStats.m_numJobsExecuted.load(), categoryStats.m_numJobsCancelled.load(),
+			categoryStats.m_numJobsInQueue.load(), categoryStats.m_peakJobsInQueue.load()));
+		g_theDevConsole->AddLine(DevConsole::COLOR_INFO_MINOR, Stringf("           queue wait %.3f / %.3f / %.3f / %.3f, execute %.3f / %.3f / %.3f / %.3f",
+			queueLatency.GetAverageSeconds() * 1000.0, queueLatency.GetPercentileSeconds(0.5f) * 1000.0, queueLatency.GetPercentileSeconds(0.99f) * 1000.0, queueLatency.GetMaxSeconds() * 1000.0,
+			executionLatency.GetAverageSeconds() * 1000.0, executionLatency.GetPercentileSeconds(0.5f) * 1000.0, executionLatency.GetPercentileSeconds(0.99f) * 1000.0, executionLatency.GetMaxSeconds() * 1000.0));
+	}
+
+	g_theDevConsole->AddLine(DevConsole::COLOR_INFO_MAJOR, "Job workers:");
+	double currentTime = GetCurrentTimeSeconds();
+	for (int threadIndex = 0; threadIndex < m_workerThreads.size(); threadIndex++)
+	{
+		JobWorkerStats const& workerStats = m_workerThreads[threadIndex]->m_stats;
+		double elapsedSeconds = currentTime - workerStats.m_startTimeSeconds;
+		double sleepingFraction = (elapsedSeconds > 0.0) ? static_cast<double>(workerStats.m_sleepingMicroseconds.load()) * 0.000001 / elapsedSeconds : 0.0;
+
+		g_theDevConsole->AddLine(DevConsole::COLOR_INFO_MINOR, Stringf("%2d %-10s executed %llu, stolen %llu, busy %5.1f%%, asleep %5.1f%%",
+			threadIndex, s_jobCategoryNames[(int)m_workerThreads[threadIndex]->m_category],
+			workerStats.m_numJobsExecuted.load(), workerStats.m_numJobsStolen.load(),
+			GetWorkerUtilization(threadIndex) * 100.0f, sleepingFraction * 100.0));
+	}
+}
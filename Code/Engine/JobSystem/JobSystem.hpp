@@ -1,57 +1,181 @@
-#pragma once
-#include "Engine/JobSystem/JobWorkerThread.hpp"
-#include "Engine/Core/EngineCommon.hpp"
-#include <mutex>
-#include <queue>
-
-
-struct JobSystemConfig
-{
-};
-
-
-class JobSystem
-{
-//public member functions
-public:
-	//static functions
-	static void ThreadMain(int threadID);
-	
-	//constructor and destructor
-	JobSystem(JobSystemConfig const& config) 
-		: m_config (config) {}
-	~JobSystem() {}
-	
-	//game flow functions
-	void Startup();
-	void Shutdown();
-	void BeginFrame() {}
-	void EndFrame() {}
-
-	//worker management functions
-	void CreateWorkers(int numWorkers);
-	void ClearJobSystem();
-
-	//job management functions
-	void PostNewJob(Job* job);
-	Job* GetNewJobToWorkOn();
-	Job* ClaimCompletedJob();
-	bool AreThereCompletedJobs();
-	
-//private member variables
-private:
-	JobSystemConfig m_config;
-
-	std::vector<JobWorkerThread*> m_workerThreads;
-
-	std::queue<Job*>  m_unclaimedJobs;
-	std::mutex		  m_unclaimedJobsMutex;
-	std::vector<Job*> m_claimedJobs;
-	std::mutex		  m_claimedJobsMutex;
-	std::queue<Job*> m_completedJobs;
-	std::mutex		  m_completedJobsMutex;
-
-	std::atomic<bool> m_isQuitting = false;
-};
-
-extern JobSystem* g_theJobSystem;
+#pragma once
+#include "Engine/JobSystem/JobWorkerThread.hpp"
+#include "Engine/JobSystem/JobAllocator.hpp"
+#include "Engine/JobSystem/JobFuture.hpp"
+#include "Engine/JobSystem/JobCancellationToken.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <mutex>
+#include <queue>
+#include <condition_variable>
+
+
+struct JobSystemConfig
+{
+	int m_maxWorkers = 64;				//upper bound on workers across all CreateWorkers calls
+	int m_workerQueueCapacity = 4096;	//per-worker deque size, overflow goes to the shared queue
+
+	//workers created by Startup, e.g. one IO worker and N general workers (games can still call CreateWorkers themselves)
+	int m_numWorkersPerCategory[(int)JobCategory::COUNT] = {};
+
+	bool m_isTelemetryEnabled = true;	//latency histograms and busy time cost a few clock reads per job
+};
+
+
+//mutex-guarded queue for jobs posted from outside a worker of the right category
+struct SharedJobQueue
+{
+	std::queue<Job*> m_jobs;
+	std::mutex		 m_mutex;
+	std::atomic<int> m_numJobs = 0;
+};
+
+
+//idle workers of one category park here until a job of that category is posted
+struct WorkerSleepState
+{
+	std::mutex				m_mutex;
+	std::condition_variable m_condition;
+	std::atomic<int>		m_numSleepingWorkers = 0;
+	std::atomic<uint64_t>	m_wakeCounter = 0;
+};
+
+
+class JobSystem
+{
+	friend class JobCounter;
+
+//public member functions
+public:
+	//static functions
+	static void ThreadMain(int threadID);
+	static bool Command_JobStats(EventArgs& args);
+
+	//constructor and destructor
+	JobSystem(JobSystemConfig const& config)
+		: m_config (config) {}
+	~JobSystem() {}
+
+	//game flow functions
+	void Startup();
+	void Shutdown();
+	void BeginFrame() {}
+	void EndFrame() {}
+
+	//worker management functions
+	void CreateWorkers(int numWorkers, JobCategory category = JobCategory::GENERAL);
+	void ClearJobSystem(double maxDrainSeconds = 0.0);
+	int  GetNumWorkers() const { return m_numWorkers.load(); }
+	int  GetNumWorkersInCategory(JobCategory category) const { return m_numWorkersInCategory[(int)category].load(); }
+	int  GetCurrentWorkerIndex() const;
+
+	//job management functions
+	void PostNewJob(Job* job);
+	Job* GetNewJobToWorkOn();
+	Job* ClaimCompletedJob();		//completed list has a single consumer, only claim from one thread (normally the main thread)
+	bool AreThereCompletedJobs();
+	bool TryExecuteQueuedJob();
+	int  GetNumUnfinishedJobs() const { return m_numUnfinishedJobs.load(); }
+
+	//wait functions, the calling thread runs queued jobs until the awaited ones finish instead of blocking a core
+	void WaitForJobs(Job const* job);	//a claimable job still has to be claimed from the completed list afterwards
+	void WaitForJobs(JobCounter const* counter);
+	template<typename T>
+	void WaitForJobs(JobFuture<T> const& future) { future.Wait(); }
+
+	//cancellation functions, cancelled jobs still finish (skipped) so their counters, dependents and futures resolve
+	void CancelQueuedJobs(JobCategory category);
+	void CancelAllQueuedJobs();
+	unsigned int GetCancelGeneration(JobCategory category) const { return m_cancelGenerations[(int)category].load(); }
+
+	//runs a function object on a worker and returns a future for its result, job storage comes from the job pool
+	template<typename T_Function>
+	JobFuture<typename std::decay<decltype(std::declval<typename std::decay<T_Function>::type&>()())>::type> Submit(T_Function&& function,
+		JobPriority priority = JobPriority::NORMAL, JobCategory category = JobCategory::GENERAL);
+
+	//job pool functions
+	void* AllocateJobBlock();
+	void  FreeJobBlock(void* block);
+
+	//telemetry functions, counters are always kept but latencies and busy time need m_isTelemetryEnabled
+	JobWorkerStats const&	GetWorkerStats(int workerIndex) const { return m_workerThreads[workerIndex]->m_stats; }
+	JobCategoryStats const& GetCategoryStats(JobCategory category) const { return m_categoryStats[(int)category]; }
+	JobCategory				GetWorkerCategory(int workerIndex) const { return m_workerThreads[workerIndex]->m_category; }
+	int						GetNumQueuedJobs(JobCategory category) const { return m_categoryStats[(int)category].m_numJobsInQueue.load(); }
+	float					GetWorkerUtilization(int workerIndex) const;	//fraction of time spent executing jobs since the last reset
+	void					ResetTelemetry();
+	void					PrintTelemetryToDevConsole() const;
+
+//private member functions
+private:
+	//job management functions
+	void QueueJob(Job* job);
+	void ExecuteJob(Job* job);
+	void FinishJob(Job* job);
+	void YieldJob(Job* job);	//re-queues a job that called YieldUntil, its Execute restarts from the top (see Job::YieldUntil)
+	void ReleasePrerequisite(Job* dependentJob);
+	void PushCompletedJob(Job* job);
+	void DrainCompletedJobs();
+	Job* PopAnyQueuedJob();
+	void HelpWhileWaiting();
+	Job* StealJob(int thiefIndex, JobCategory category, JobPriority priority);
+	void RemoveQueuedJob(Job* job, double currentTime);
+	void WakeSleepingWorker(JobCategory category);
+	void WaitForNewJobs(int workerIndex);
+	JobCategory GetQueueCategory(JobCategory jobCategory) const;
+
+//private member variables
+private:
+	JobSystemConfig m_config;
+	JobAllocator	m_jobAllocator;
+
+	std::vector<JobWorkerThread*> m_workerThreads;
+	std::atomic<int>			  m_numWorkers = 0;
+	std::atomic<int>			  m_numWorkersInCategory[(int)JobCategory::COUNT] = {};
+
+	//jobs posted from threads that aren't workers of their category (or that overflowed a worker's deque)
+	SharedJobQueue m_unclaimedJobs[(int)JobCategory::COUNT][(int)JobPriority::COUNT];
+
+	//workers push finished jobs onto a lock-free stack, the claiming thread takes the whole stack at once
+	std::atomic<Job*> m_completedJobsHead = nullptr;
+	Job*			  m_firstClaimableJob = nullptr;
+	Job*			  m_lastClaimableJob = nullptr;
+
+	WorkerSleepState m_sleepStates[(int)JobCategory::COUNT];
+
+	std::atomic<int>		  m_numUnfinishedJobs = 0;	//queued or executing
+	std::atomic<unsigned int> m_cancelGenerations[(int)JobCategory::COUNT] = {};
+
+	JobCategoryStats m_categoryStats[(int)JobCategory::COUNT];
+
+	std::atomic<bool> m_isQuitting = false;
+};
+
+extern JobSystem* g_theJobSystem;
+
+
+//
+//template functions
+//
+template<typename T_Function>
+JobFuture<typename std::decay<decltype(std::declval<typename std::decay<T_Function>::type&>()())>::type> JobSystem::Submit(T_Function&& function,
+	JobPriority priority, JobCategory category)
+{
+	typedef typename std::decay<T_Function>::type FunctionType;
+	typedef typename std::decay<decltype(std::declval<FunctionType&>()())>::type ResultType;
+	typedef LambdaJob<ResultType, FunctionType> LambdaJobType;
+
+	//captures too big for a pool block fall back to the heap
+	bool fitsInPoolBlock = sizeof(LambdaJobType) <= JobAllocator::MAX_BLOCK_DATA_SIZE && alignof(LambdaJobType) <= JobAllocator::BLOCK_ALIGNMENT;
+	void* jobMemory = fitsInPoolBlock ? AllocateJobBlock() : ::operator new(sizeof(LambdaJobType));
+
+	LambdaJobType* job = new (jobMemory) LambdaJobType(std::forward<T_Function>(function), fitsInPoolBlock);
+
+	job->SetPriority(priority);
+	job->SetCategory(category);
+
+	//one reference for the job system until the job finishes, one for the returned future
+	job->AddReference();
+	PostNewJob(job);
+
+	return JobFuture<ResultType>(job);
+}
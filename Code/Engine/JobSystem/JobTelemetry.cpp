@@ -0,0 +1,117 @@
+#include "Engine/JobSystem/JobTelemetry.hpp"
+
+
+//
+//histogram functions
+//
+void JobLatencyHistogram::AddSample(double seconds)
+{
+	uint64_t microseconds = (seconds > 0.0) ? static_cast<uint64_t>(seconds * 1000000.0) : 0;
+
+	int bucketIndex = 0;
+	uint64_t bucketValue = microseconds >> 1;
+	while (bucketValue > 0 && bucketIndex < NUM_BUCKETS - 1)
+	{
+		bucketValue >>= 1;
+		bucketIndex++;
+	}
+
+	m_bucketCounts[bucketIndex].fetch_add(1, std::memory_order_relaxed);
+	m_numSamples.fetch_add(1, std::memory_order_relaxed);
+	m_totalMicroseconds.fetch_add(microseconds, std::memory_order_relaxed);
+
+	uint64_t maxMicroseconds = m_maxMicroseconds.load(std::memory_order_relaxed);
+	while (microseconds > maxMicroseconds && !m_maxMicroseconds.compare_exchange_weak(maxMicroseconds, microseconds, std::memory_order_relaxed))
+	{
+	}
+}
+
+
+void JobLatencyHistogram::Reset()
+{
+	for (int bucketIndex = 0; bucketIndex < NUM_BUCKETS; bucketIndex++)
+	{
+		m_bucketCounts[bucketIndex] = 0;
+	}
+
+	m_numSamples = 0;
+	m_totalMicroseconds = 0;
+	m_maxMicroseconds = 0;
+}
+
+
+//
+//accessors
+//
+double JobLatencyHistogram::GetAverageSeconds() const
+{
+	uint64_t numSamples = GetNumSamples();
+	if (numSamples == 0)
+	{
+		return 0.0;
+	}
+
+	return static_cast<double>(m_totalMicroseconds.load(std::memory_order_relaxed)) / static_cast<double>(numSamples) * 0.000001;
+}
+
+
+double JobLatencyHistogram::GetMaxSeconds() const
+{
+	return static_cast<double>(m_maxMicroseconds.load(std::memory_order_relaxed)) * 0.000001;
+}
+
+
+double JobLatencyHistogram::GetPercentileSeconds(float percentile) const
+{
+	uint64_t numSamples = GetNumSamples();
+	if (numSamples == 0)
+	{
+		return 0.0;
+	}
+
+	uint64_t targetSample = static_cast<uint64_t>(static_cast<double>(numSamples) * percentile);
+	uint64_t samplesSoFar = 0;
+	for (int bucketIndex = 0; bucketIndex < NUM_BUCKETS; bucketIndex++)
+	{
+		samplesSoFar += GetBucketCount(bucketIndex);
+		if (samplesSoFar > targetSample)
+		{
+			//the bucket edge can overshoot the slowest sample actually seen
+			double bucketUpperSeconds = GetBucketUpperSeconds(bucketIndex);
+			double maxSeconds = GetMaxSeconds();
+			return (bucketUpperSeconds < maxSeconds) ? bucketUpperSeconds : maxSeconds;
+		}
+	}
+
+	return GetMaxSeconds();
+}
+
+
+double JobLatencyHistogram::GetBucketUpperSeconds(int bucketIndex)
+{
+	return static_cast<double>(2ull << bucketIndex) * 0.000001;
+}
+
+
+//
+//stats functions
+//
+void JobWorkerStats::Reset()
+{
+	m_numJobsExecuted = 0;
+	m_numJobsStolen = 0;
+	m_busyMicroseconds = 0;
+	m_sleepingMicroseconds = 0;
+}
+
+
+void JobCategoryStats::Reset()
+{
+	m_numJobsQueued = 0;
+	m_numJobsExecuted = 0;
+	m_numJobsCancelled = 0;
+	m_peakJobsInQueue = m_numJobsInQueue.load();
+
+	m_queueLatency.Reset();
+	m_executionLatency.Reset();
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+
+//log2 histogram of job latencies, bucket 0 holds anything under 2 microseconds and bucket n holds [2^n, 2^(n+1)) microseconds
+//samples are added lock-free from any thread, reads are approximate while jobs are still running
+class JobLatencyHistogram
+{
+//public member functions
+public:
+	static constexpr int NUM_BUCKETS = 24;	//last bucket catches everything from ~8 seconds up
+
+	//constructor and destructor
+	JobLatencyHistogram() {}
+	JobLatencyHistogram(JobLatencyHistogram const& copy) = delete;
+	~JobLatencyHistogram() {}
+
+	//histogram functions
+	void AddSample(double seconds);
+	void Reset();
+
+	//accessors
+	uint64_t GetNumSamples() const { return m_numSamples.load(std::memory_order_relaxed); }
+	uint64_t GetBucketCount(int bucketIndex) const { return m_bucketCounts[bucketIndex].load(std::memory_order_relaxed); }
+	double	 GetAverageSeconds() const;
+	double	 GetMaxSeconds() const;
+	double	 GetPercentileSeconds(float percentile) const;	//upper edge of the bucket the percentile lands in, e.g. 0.99f
+
+	static double GetBucketUpperSeconds(int bucketIndex);
+
+//private member variables
+private:
+	std::atomic<uint64_t> m_bucketCounts[NUM_BUCKETS] = {};
+	std::atomic<uint64_t> m_numSamples = 0;
+	std::atomic<uint64_t> m_totalMicroseconds = 0;
+	std::atomic<uint64_t> m_maxMicroseconds = 0;
+};
+
+
+//counters for one worker thread, only that worker writes them
+struct JobWorkerStats
+{
+	void Reset();
+
+	std::atomic<uint64_t> m_numJobsExecuted = 0;
+	std::atomic<uint64_t> m_numJobsStolen = 0;
+	std::atomic<uint64_t> m_busyMicroseconds = 0;		//inside top-level ExecuteJob, nested helping isn't counted twice
+	std::atomic<uint64_t> m_sleepingMicroseconds = 0;	//parked in WaitForNewJobs
+	double				  m_startTimeSeconds = 0.0;		//when the worker was created or its stats were last reset
+};
+
+
+//counters for one job category, written by whichever thread posts or runs the job
+struct JobCategoryStats
+{
+	void Reset();
+
+	std::atomic<uint64_t> m_numJobsQueued = 0;
+	std::atomic<uint64_t> m_numJobsExecuted = 0;
+	std::atomic<uint64_t> m_numJobsCancelled = 0;
+	std::atomic<int>	  m_numJobsInQueue = 0;		//queued but not picked up yet
+	std::atomic<int>	  m_peakJobsInQueue = 0;
+
+	JobLatencyHistogram m_queueLatency;		//queued until a thread picked it up
+	JobLatencyHistogram m_executionLatency;	//time spent in Execute, once per run for jobs that yield
+};
@@ -1,18 +1,27 @@
-#include "Engine/JobSystem/JobWorkerThread.hpp"
-#include "Engine/JobSystem/Job.hpp"
-
-
-//
-//constructor
-//
-JobWorkerThread::JobWorkerThread(std::thread* thread, int threadID)
-	: m_thread(thread)
-	, m_threadID(threadID)
-{
-}
-
-
-JobWorkerThread::~JobWorkerThread()
-{
-	delete m_thread;
-}
+#include "Engine/JobSystem/JobWorkerThread.hpp"
+#include "Engine/JobSystem/Job.hpp"
+
+
+//
+//constructor
+//
+JobWorkerThread::JobWorkerThread(int threadID, JobCategory category, int queueCapacity)
+	: m_threadID(threadID)
+	, m_category(category)
+{
+	for (int priorityIndex = 0; priorityIndex < (int)JobPriority::COUNT; priorityIndex++)
+	{
+		m_localJobs[priorityIndex] = new JobDeque(queueCapacity);
+	}
+}
+
+
+JobWorkerThread::~JobWorkerThread()
+{
+	delete m_thread;
+
+	for (int priorityIndex = 0; priorityIndex < (int)JobPriority::COUNT; priorityIndex++)
+	{
+		delete m_localJobs[priorityIndex];
+	}
+}
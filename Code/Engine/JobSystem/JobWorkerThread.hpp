@@ -1,23 +1,29 @@
-#pragma once
-#include <thread>
-
-
-//forward declarations
-class Job;
-
-
-class JobWorkerThread
-{
-//public member functions
-public:
-	//constructor and destructor
-	JobWorkerThread(std::thread* thread, int threadID);
-	~JobWorkerThread();
-
-//public member variables
-public:
-	std::thread* m_thread = nullptr;
-	int			 m_threadID = -1;
-
-	Job*		 m_currentJob = nullptr;
-};
+#pragma once
+#include "Engine/JobSystem/Job.hpp"
+#include "Engine/JobSystem/JobDeque.hpp"
+#include "Engine/JobSystem/JobTelemetry.hpp"
+#include <thread>
+
+
+class JobWorkerThread
+{
+//public member functions
+public:
+	//constructor and destructor
+	JobWorkerThread(int threadID, JobCategory category, int queueCapacity);
+	~JobWorkerThread();
+
+//public member variables
+public:
+	std::thread* m_thread = nullptr;
+	int			 m_threadID = -1;
+
+	JobCategory	 m_category = JobCategory::GENERAL;
+
+	Job*		 m_currentJob = nullptr;
+
+	//one deque per priority, only holds jobs of this worker's category
+	JobDeque*	 m_localJobs[(int)JobPriority::COUNT] = {};
+
+	JobWorkerStats m_stats;
+};
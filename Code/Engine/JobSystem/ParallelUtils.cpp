@@ -0,0 +1,158 @@
+#include "Engine/JobSystem/ParallelUtils.hpp"
+#include "Engine/JobSystem/JobSystem.hpp"
+#include "Engine/JobSystem/JobCounter.hpp"
+#include <new>
+
+
+//helper jobs for up to this many helpers live on the calling thread's stack, only bigger machines pay for a heap allocation
+constexpr int MAX_STACK_HELPER_JOBS = 32;
+
+
+//job that runs a shared parallel task alongside the thread that started it
+class ParallelTaskJob : public Job
+{
+//public member functions
+public:
+	ParallelTaskJob()
+	{
+		m_ownership = JobOwnership::OWNED_BY_POSTER;
+
+		//the thread that started the loop is waiting on these
+		SetPriority(JobPriority::HIGH);
+	}
+
+	virtual void Execute() override
+	{
+		m_task->Run();
+	}
+
+//public member variables
+public:
+	ParallelTask* m_task = nullptr;
+};
+
+
+//
+//constructor
+//
+ParallelRange::ParallelRange(int beginIndex, int endIndex, int grainSize, int numParticipants, bool isAdaptive)
+	: m_nextIndex(beginIndex)
+	, m_beginIndex(beginIndex)
+	, m_endIndex(endIndex)
+	, m_grainSize(grainSize > 0 ? grainSize : 1)
+	, m_numParticipants(numParticipants > 0 ? numParticipants : 1)
+	, m_isAdaptive(isAdaptive)
+{
+}
+
+
+//
+//chunk functions
+//
+bool ParallelRange::ClaimChunk(int& out_chunkBegin, int& out_chunkEnd)
+{
+	int chunkBegin = m_nextIndex.load();
+	while (chunkBegin < m_endIndex)
+	{
+		//guided scheduling: take a share of what's left while there's plenty, fall back to grain size near the end
+		int chunkSize = m_grainSize;
+		if (m_isAdaptive)
+		{
+			int adaptiveSize = (m_endIndex - chunkBegin) / (2 * m_numParticipants);
+			if (adaptiveSize > chunkSize)
+			{
+				chunkSize = adaptiveSize;
+			}
+		}
+
+		int chunkEnd = chunkBegin + chunkSize;
+		if (chunkEnd > m_endIndex || chunkEnd < chunkBegin)
+		{
+			chunkEnd = m_endIndex;
+		}
+
+		if (m_nextIndex.compare_exchange_weak(chunkBegin, chunkEnd))
+		{
+			out_chunkBegin = chunkBegin;
+			out_chunkEnd = chunkEnd;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//
+//accessors
+//
+int ParallelRange::GetNumFixedChunks() const
+{
+	if (m_endIndex <= m_beginIndex)
+	{
+		return 0;
+	}
+
+	return ((m_endIndex - m_beginIndex) + (m_grainSize - 1)) / m_grainSize;
+}
+
+
+//
+//parallel execution functions
+//
+int GetNumParallelParticipants(int beginIndex, int endIndex, int grainSize)
+{
+	if (g_theJobSystem == nullptr || endIndex <= beginIndex)
+	{
+		return 1;
+	}
+
+	if (grainSize <= 0)
+	{
+		grainSize = 1;
+	}
+
+	//no point waking more helpers than there are grain-sized chunks
+	int numChunks = ((endIndex - beginIndex) + (grainSize - 1)) / grainSize;
+	int numParticipants = g_theJobSystem->GetNumWorkersInCategory(JobCategory::GENERAL) + 1;
+
+	return (numChunks < numParticipants) ? numChunks : numParticipants;
+}
+
+
+void RunParallelTaskAndWait(ParallelTask& task, int numParticipants)
+{
+	int numHelpers = numParticipants - 1;
+	JobCounter helpersCounter(numHelpers);
+
+	//raw storage so only the helpers actually needed get constructed
+	alignas(ParallelTaskJob) unsigned char stackJobStorage[MAX_STACK_HELPER_JOBS * sizeof(ParallelTaskJob)];
+	unsigned char* heapJobStorage = nullptr;
+	ParallelTaskJob* helperJobs = reinterpret_cast<ParallelTaskJob*>(stackJobStorage);
+	if (numHelpers > MAX_STACK_HELPER_JOBS)
+	{
+		heapJobStorage = new unsigned char[numHelpers * sizeof(ParallelTaskJob)];
+		helperJobs = reinterpret_cast<ParallelTaskJob*>(heapJobStorage);
+	}
+
+	for (int helperIndex = 0; helperIndex < numHelpers; helperIndex++)
+	{
+		ParallelTaskJob* helperJob = new (&helperJobs[helperIndex]) ParallelTaskJob();
+		helperJob->m_task = &task;
+		helperJob->SetCompletionCounter(&helpersCounter);
+		g_theJobSystem->PostNewJob(helperJob);
+	}
+
+	//calling thread works on the range too instead of blocking
+	task.Run();
+
+	//helpers that haven't started yet find the range empty, run them (or anything else queued) here rather than wait for a worker
+	g_theJobSystem->WaitForJobs(&helpersCounter);
+
+	for (int helperIndex = 0; helperIndex < numHelpers; helperIndex++)
+	{
+		helperJobs[helperIndex].~ParallelTaskJob();
+	}
+
+	delete[] heapJobStorage;
+}
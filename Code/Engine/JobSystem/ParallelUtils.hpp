@@ -0,0 +1,179 @@
+#pragma once
+#include "Engine/JobSystem/Job.hpp"
+#include <vector>
+
+
+//hands out chunks of [begin, end) to whichever thread asks next
+class ParallelRange
+{
+//public member functions
+public:
+	//constructor
+	ParallelRange(int beginIndex, int endIndex, int grainSize, int numParticipants, bool isAdaptive);
+	ParallelRange(ParallelRange const& copy) = delete;
+
+	//chunk functions
+	bool ClaimChunk(int& out_chunkBegin, int& out_chunkEnd);
+
+	//accessors
+	int GetBeginIndex() const { return m_beginIndex; }
+	int GetGrainSize() const { return m_grainSize; }
+	int GetNumFixedChunks() const;
+
+//private member variables
+private:
+	std::atomic<int> m_nextIndex = 0;
+	int				 m_beginIndex = 0;
+	int				 m_endIndex = 0;
+	int				 m_grainSize = 1;
+	int				 m_numParticipants = 1;
+	bool			 m_isAdaptive = true;
+};
+
+
+//work run by the calling thread and every helper job at once
+class ParallelTask
+{
+//public member functions
+public:
+	virtual ~ParallelTask() {}
+
+	virtual void Run() = 0;
+};
+
+
+//parallel execution functions
+int  GetNumParallelParticipants(int beginIndex, int endIndex, int grainSize);
+void RunParallelTaskAndWait(ParallelTask& task, int numParticipants);
+
+
+//templated tasks
+template<typename T_Function>
+class ParallelForTask : public ParallelTask
+{
+//public member functions
+public:
+	ParallelForTask(ParallelRange& range, T_Function const& function)
+		: m_range(range)
+		, m_function(function)
+	{}
+
+	virtual void Run() override
+	{
+		int chunkBegin = 0;
+		int chunkEnd = 0;
+		while (m_range.ClaimChunk(chunkBegin, chunkEnd))
+		{
+			m_function(chunkBegin, chunkEnd);
+		}
+	}
+
+//private member variables
+private:
+	ParallelRange&	  m_range;
+	T_Function const& m_function;
+};
+
+
+template<typename T_Value, typename T_ChunkFunction>
+class ParallelReduceTask : public ParallelTask
+{
+//public member functions
+public:
+	ParallelReduceTask(ParallelRange& range, T_ChunkFunction const& chunkFunction, std::vector<T_Value>& chunkResults)
+		: m_range(range)
+		, m_chunkFunction(chunkFunction)
+		, m_chunkResults(chunkResults)
+	{}
+
+	virtual void Run() override
+	{
+		int chunkBegin = 0;
+		int chunkEnd = 0;
+		while (m_range.ClaimChunk(chunkBegin, chunkEnd))
+		{
+			int chunkIndex = (chunkBegin - m_range.GetBeginIndex()) / m_range.GetGrainSize();
+			m_chunkResults[chunkIndex] = m_chunkFunction(chunkBegin, chunkEnd);
+		}
+	}
+
+//private member variables
+private:
+	ParallelRange&		   m_range;
+	T_ChunkFunction const& m_chunkFunction;
+	std::vector<T_Value>&  m_chunkResults;
+};
+
+
+//
+//parallel loop functions
+//
+//calls chunkFunction(chunkBegin, chunkEnd) over [beginIndex, endIndex) split across the job workers and the calling thread
+//chunks start large and shrink towards grainSize as the range runs out, so uneven iterations still balance
+template<typename T_ChunkFunction>
+void ParallelForChunks(int beginIndex, int endIndex, int grainSize, T_ChunkFunction const& chunkFunction)
+{
+	int numParticipants = GetNumParallelParticipants(beginIndex, endIndex, grainSize);
+	if (numParticipants <= 1)
+	{
+		if (beginIndex < endIndex)
+		{
+			chunkFunction(beginIndex, endIndex);
+		}
+		return;
+	}
+
+	ParallelRange range(beginIndex, endIndex, grainSize, numParticipants, true);
+	ParallelForTask<T_ChunkFunction> task(range, chunkFunction);
+	RunParallelTaskAndWait(task, numParticipants);
+}
+
+
+//calls function(index) for every index in [beginIndex, endIndex)
+template<typename T_Function>
+void ParallelFor(int beginIndex, int endIndex, int grainSize, T_Function const& function)
+{
+	auto chunkFunction = [&function](int chunkBegin, int chunkEnd)
+	{
+		for (int index = chunkBegin; index < chunkEnd; index++)
+		{
+			function(index);
+		}
+	};
+
+	ParallelForChunks(beginIndex, endIndex, grainSize, chunkFunction);
+}
+
+
+//chunkFunction(chunkBegin, chunkEnd) returns the value for one chunk, reduceFunction(a, b) combines two values
+//chunks are always exactly grainSize and combined in index order, so the result doesn't depend on thread timing
+template<typename T_Value, typename T_ChunkFunction, typename T_ReduceFunction>
+T_Value ParallelReduce(int beginIndex, int endIndex, int grainSize, T_Value const& identity, T_ChunkFunction const& chunkFunction, T_ReduceFunction const& reduceFunction)
+{
+	if (beginIndex >= endIndex)
+	{
+		return identity;
+	}
+
+	int numParticipants = GetNumParallelParticipants(beginIndex, endIndex, grainSize);
+	ParallelRange range(beginIndex, endIndex, grainSize, numParticipants, false);
+	std::vector<T_Value> chunkResults(range.GetNumFixedChunks(), identity);
+
+	ParallelReduceTask<T_Value, T_ChunkFunction> task(range, chunkFunction, chunkResults);
+	if (numParticipants <= 1)
+	{
+		task.Run();
+	}
+	else
+	{
+		RunParallelTaskAndWait(task, numParticipants);
+	}
+
+	T_Value result = identity;
+	for (int chunkIndex = 0; chunkIndex < static_cast<int>(chunkResults.size()); chunkIndex++)
+	{
+		result = reduceFunction(result, chunkResults[chunkIndex]);
+	}
+
+	return result;
+}
@@ -0,0 +1,199 @@
+#include "Engine/Math/ArcLengthTable2D.hpp"
+#include "Engine/Math/CatmullRomSpline.hpp"
+#include "Engine/Math/CubicBezierCurve2D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+
+
+//cursors further than this many segments from their target jump there with the binary search instead of walking
+constexpr int MAX_CURSOR_WALK_SEGMENTS = 8;
+
+
+//
+//constructors
+//
+ArcLengthTable2D::ArcLengthTable2D(CubicBezierCurve2D const& curve, int numSubdivisions)
+{
+	Build(curve, numSubdivisions);
+}
+
+
+ArcLengthTable2D::ArcLengthTable2D(CatmullRomSpline const& spline, int numSubdivisionsPerCurve)
+{
+	Build(spline, numSubdivisionsPerCurve);
+}
+
+
+//
+//build functions
+//
+void ArcLengthTable2D::Build(CubicBezierCurve2D const& curve, int numSubdivisions)
+{
+	GUARANTEE_OR_DIE(numSubdivisions > 0, "Tried to build an ArcLengthTable2D with no subdivisions!");
+
+	Clear();
+	m_positions.reserve(numSubdivisions + 1);
+	m_distances.reserve(numSubdivisions + 1);
+	m_parametrics.reserve(numSubdivisions + 1);
+
+	m_positions.push_back(curve.A);
+	m_distances.push_back(0.0f);
+	m_parametrics.push_back(0.0f);
+	AddCurveSamples(curve, numSubdivisions, 0.0f);
+}
+
+
+void ArcLengthTable2D::Build(CatmullRomSpline const& spline, int numSubdivisionsPerCurve)
+{
+	GUARANTEE_OR_DIE(numSubdivisionsPerCurve > 0, "Tried to build an ArcLengthTable2D with no subdivisions!");
+
+	Clear();
+	if (spline.m_curves.empty())
+	{
+		return;
+	}
+
+	int numSamples = static_cast<int>(spline.m_curves.size()) * numSubdivisionsPerCurve + 1;
+	m_positions.reserve(numSamples);
+	m_distances.reserve(numSamples);
+	m_parametrics.reserve(numSamples);
+
+	//each curve starts where the last one ended, so only the first curve adds its start point
+	m_positions.push_back(spline.m_curves[0].A);
+	m_distances.push_back(0.0f);
+	m_parametrics.push_back(0.0f);
+	for (int curveIndex = 0; curveIndex < static_cast<int>(spline.m_curves.size()); curveIndex++)
+	{
+		AddCurveSamples(spline.m_curves[curveIndex], numSubdivisionsPerCurve, static_cast<float>(curveIndex));
+	}
+}
+
+
+void ArcLengthTable2D::Clear()
+{
+	m_positions.clear();
+	m_distances.clear();
+	m_parametrics.clear();
+}
+
+
+//
+//distance queries
+//
+Vec2 const ArcLengthTable2D::EvaluateAtDistance(float distanceAlongPath) const
+{
+	if (IsEmpty())
+	{
+		return Vec2();
+	}
+
+	int segmentIndex = GetSegmentIndexAtDistance(distanceAlongPath);
+	float fraction = GetFractionInSegment(segmentIndex, distanceAlongPath);
+	Vec2 const& segmentStart = m_positions[segmentIndex];
+	return segmentStart + (m_positions[segmentIndex + 1] - segmentStart) * fraction;
+}
+
+
+float ArcLengthTable2D::GetParametricAtDistance(float distanceAlongPath) const
+{
+	if (IsEmpty())
+	{
+		return 0.0f;
+	}
+
+	int segmentIndex = GetSegmentIndexAtDistance(distanceAlongPath);
+	float fraction = GetFractionInSegment(segmentIndex, distanceAlongPath);
+	return Interpolate(m_parametrics[segmentIndex], m_parametrics[segmentIndex + 1], fraction);
+}
+
+
+//
+//cursor queries
+//
+Vec2 const ArcLengthTable2D::EvaluateAtDistance(float distanceAlongPath, ArcLengthCursor& cursor) const
+{
+	if (IsEmpty())
+	{
+		cursor = ArcLengthCursor();
+		return Vec2();
+	}
+
+	cursor.m_distance = GetClamped(distanceAlongPath, 0.0f, GetLength());
+	cursor.m_segmentIndex = GetSegmentIndexAtDistance(cursor.m_distance, cursor.m_segmentIndex);
+
+	float fraction = GetFractionInSegment(cursor.m_segmentIndex, cursor.m_distance);
+	Vec2 const& segmentStart = m_positions[cursor.m_segmentIndex];
+	return segmentStart + (m_positions[cursor.m_segmentIndex + 1] - segmentStart) * fraction;
+}
+
+
+Vec2 const ArcLengthTable2D::AdvanceCursor(ArcLengthCursor& cursor, float deltaDistance) const
+{
+	return EvaluateAtDistance(cursor.m_distance + deltaDistance, cursor);
+}
+
+
+//
+//private member functions
+//
+void ArcLengthTable2D::AddCurveSamples(CubicBezierCurve2D const& curve, int numSubdivisions, float curveIndex)
+{
+	float inverseNumSubdivisions = 1.0f / static_cast<float>(numSubdivisions);
+	for (int subdivIndex = 1; subdivIndex <= numSubdivisions; subdivIndex++)
+	{
+		float t = static_cast<float>(subdivIndex) * inverseNumSubdivisions;
+		Vec2 segmentEnd = (subdivIndex == numSubdivisions) ? curve.D : curve.EvaluateAtParametric(t);
+
+		m_distances.push_back(m_distances.back() + GetDistance2D(m_positions.back(), segmentEnd));
+		m_positions.push_back(segmentEnd);
+		m_parametrics.push_back(curveIndex + t);
+	}
+}
+
+
+int ArcLengthTable2D::GetSegmentIndexAtDistance(float distanceAlongPath) const
+{
+	//the last sample at or before the distance starts the segment, distances at or past the end use the last segment
+	int numSegments = GetNumSegments();
+	int segmentIndex = static_cast<int>(std::upper_bound(m_distances.begin(), m_distances.end(), distanceAlongPath) - m_distances.begin()) - 1;
+	return GetClamped(segmentIndex, 0, numSegments - 1);
+}
+
+
+int ArcLengthTable2D::GetSegmentIndexAtDistance(float distanceAlongPath, int startSegmentIndex) const
+{
+	int numSegments = GetNumSegments();
+	int segmentIndex = GetClamped(startSegmentIndex, 0, numSegments - 1);
+
+	int lowestWalkIndex = GetClamped(segmentIndex - MAX_CURSOR_WALK_SEGMENTS, 0, numSegments - 1);
+	int highestWalkIndex = GetClamped(segmentIndex + MAX_CURSOR_WALK_SEGMENTS, 0, numSegments - 1);
+	if (distanceAlongPath < m_distances[lowestWalkIndex] || distanceAlongPath > m_distances[highestWalkIndex + 1])
+	{
+		return GetSegmentIndexAtDistance(distanceAlongPath);
+	}
+
+	//walk from the cursor's segment, ending on the same segment the binary search would pick
+	while (segmentIndex > 0 && m_distances[segmentIndex] > distanceAlongPath)
+	{
+		segmentIndex--;
+	}
+	while (segmentIndex < numSegments - 1 && m_distances[segmentIndex + 1] <= distanceAlongPath)
+	{
+		segmentIndex++;
+	}
+
+	return segmentIndex;
+}
+
+
+float ArcLengthTable2D::GetFractionInSegment(int segmentIndex, float distanceAlongPath) const
+{
+	float segmentStartDistance = m_distances[segmentIndex];
+	float segmentLength = m_distances[segmentIndex + 1] - segmentStartDistance;
+	if (segmentLength <= 0.0f)
+	{
+		return 0.0f;
+	}
+
+	return GetClamped((distanceAlongPath - segmentStartDistance) / segmentLength, 0.0f, 1.0f);
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//forward declarations
+struct CubicBezierCurve2D;
+class CatmullRomSpline;
+
+
+//remembers where along a path an object is, so moving it a little only steps through the table segments it crossed
+struct ArcLengthCursor
+{
+//public member variables
+public:
+	float m_distance = 0.0f;
+	int	  m_segmentIndex = 0;
+};
+
+
+//precomputed arc length lookup for a curve or spline, sampled at evenly spaced parametric values along each curve
+//distance queries binary search the table instead of re-walking the curve and, like CubicBezierCurve2D::EvaluateAtApproximateDistance,
+//interpolate along the straight segments between samples
+//the table copies the samples, so rebuild it if the curve or spline changes
+class ArcLengthTable2D
+{
+//public member functions
+public:
+	//constructors
+	ArcLengthTable2D() {}
+	explicit ArcLengthTable2D(CubicBezierCurve2D const& curve, int numSubdivisions = 64);
+	explicit ArcLengthTable2D(CatmullRomSpline const& spline, int numSubdivisionsPerCurve = 64);
+
+	//build functions
+	void Build(CubicBezierCurve2D const& curve, int numSubdivisions = 64);
+	void Build(CatmullRomSpline const& spline, int numSubdivisionsPerCurve = 64);
+	void Clear();
+
+	//accessors
+	bool  IsEmpty() const { return m_distances.empty(); }
+	float GetLength() const { return m_distances.empty() ? 0.0f : m_distances.back(); }
+	int	  GetNumSegments() const { return m_distances.empty() ? 0 : static_cast<int>(m_distances.size()) - 1; }
+
+	//distance queries, distances are clamped to [0, length]
+	//parametric values for splines are the curve index plus the parametric value on that curve, see CatmullRomSpline::EvaluateAtParametric
+	Vec2 const EvaluateAtDistance(float distanceAlongPath) const;
+	float	   GetParametricAtDistance(float distanceAlongPath) const;
+
+	//cursor queries, searching from the cursor's last segment so steady movement costs O(1) per call
+	Vec2 const EvaluateAtDistance(float distanceAlongPath, ArcLengthCursor& cursor) const;	//moves the cursor to the distance
+	Vec2 const AdvanceCursor(ArcLengthCursor& cursor, float deltaDistance) const;			//negative deltas move back, returns the cursor's new position
+
+//private member functions
+private:
+	void  AddCurveSamples(CubicBezierCurve2D const& curve, int numSubdivisions, float curveIndex);
+	int	  GetSegmentIndexAtDistance(float distanceAlongPath) const;
+	int	  GetSegmentIndexAtDistance(float distanceAlongPath, int startSegmentIndex) const;
+	float GetFractionInSegment(int segmentIndex, float distanceAlongPath) const;
+
+//private member variables
+private:
+	std::vector<Vec2>  m_positions;
+	std::vector<float> m_distances;		//distance along the path to each sample, never decreasing
+	std::vector<float> m_parametrics;	//parametric value of each sample
+};
@@ -1,25 +1,56 @@
-#include "Engine/Math/CatmullRomSpline.hpp"
-
-
-//
-//constructor
-//
-CatmullRomSpline::CatmullRomSpline(std::vector<Vec2> const& positions)
-{
-	Vec2 velA = Vec2();
-
-	for (int posIndex = 0; posIndex < positions.size() - 1; posIndex++)
-	{
-		Vec2 velB = Vec2();
-		
-		if (posIndex < positions.size() - 2)
-		{
-			velB = (positions[posIndex + 2] - positions[posIndex]) * 0.5f;
-		}
-
-		CubicBezierCurve2D curve = CubicBezierCurve2D::CreateUsingHermite(positions[posIndex], velA, positions[posIndex+1], velB);
-		m_curves.push_back(curve);
-
-		velA = velB;
-	}
-}
+#include "Engine/Math/CatmullRomSpline.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <math.h>
+
+
+//
+//constructor
+//
+CatmullRomSpline::CatmullRomSpline(std::vector<Vec2> const& positions)
+{
+	Vec2 velA = Vec2();
+
+	for (int posIndex = 0; posIndex < positions.size() - 1; posIndex++)
+	{
+		Vec2 velB = Vec2();
+		
+		if (posIndex < positions.size() - 2)
+		{
+			velB = (positions[posIndex + 2] - positions[posIndex]) * 0.5f;
+		}
+
+		CubicBezierCurve2D curve = CubicBezierCurve2D::CreateUsingHermite(positions[posIndex], velA, positions[posIndex+1], velB);
+		m_curves.push_back(curve);
+
+		velA = velB;
+	}
+}
+
+
+//
+//spline utilities
+//
+Vec2 CatmullRomSpline::EvaluateAtParametric(float parametric) const
+{
+	if (m_curves.empty())
+	{
+		return Vec2();
+	}
+
+	int numCurves = static_cast<int>(m_curves.size());
+	int curveIndex = GetClamped(static_cast<int>(floorf(parametric)), 0, numCurves - 1);
+	float curveT = GetClamped(parametric - static_cast<float>(curveIndex), 0.0f, 1.0f);
+	return m_curves[curveIndex].EvaluateAtParametric(curveT);
+}
+
+
+float CatmullRomSpline::GetApproximateLength(int numSubdivisionsPerCurve) const
+{
+	float length = 0.0f;
+	for (int curveIndex = 0; curveIndex < static_cast<int>(m_curves.size()); curveIndex++)
+	{
+		length += m_curves[curveIndex].GetApproximateLength(numSubdivisionsPerCurve);
+	}
+
+	return length;
+}
@@ -1,17 +1,21 @@
-#pragma once
-#include "Engine/Math/CubicBezierCurve2D.hpp"
-#include "Engine/Core/EngineCommon.hpp"
-
-
-class CatmullRomSpline
-{
-//public member functions
-public:
-	//constructors
-	CatmullRomSpline() {}
-	CatmullRomSpline(std::vector<Vec2> const& positions);
-
-//public member variables
-public:
-	std::vector<CubicBezierCurve2D> m_curves;
-};
+#pragma once
+#include "Engine/Math/CubicBezierCurve2D.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+class CatmullRomSpline
+{
+//public member functions
+public:
+	//constructors
+	CatmullRomSpline() {}
+	CatmullRomSpline(std::vector<Vec2> const& positions);
+
+	//spline utilities, parametric values run from 0 at the first position to the number of curves at the last, see ArcLengthTable2D for distance queries
+	Vec2  EvaluateAtParametric(float parametric) const;
+	float GetApproximateLength(int numSubdivisionsPerCurve) const;
+
+//public member variables
+public:
+	std::vector<CubicBezierCurve2D> m_curves;
+};
@@ -1,4 +1,654 @@
-#include "Engine/Math/ConvexHull3D.hpp"
-
-
-
+#include "Engine/Math/ConvexHull3D.hpp"
+#include "Engine/Math/ConvexPoly2D.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Core/ErrorWarningAssert.hpp"
+#include <unordered_map>
+#include <queue>
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+
+
+constexpr float COPLANAR_FACE_TOLERANCE = 0.0001f;		//faces share a plane if their normals' dot product is within this of 1 and their corners are on it
+
+
+struct QuickhullFace
+{
+//public member variables
+public:
+	int				 m_vertexes[3] = {};	//counterclockwise seen from outside
+	Vec3			 m_normal;
+	float			 m_distFromOrigin = 0.0f;
+	std::vector<int> m_outsidePoints;
+	int				 m_farthestPoint = -1;	//the outside point farthest from the face, the eye if this face is picked
+	float			 m_farthestAltitude = 0.0f;
+	bool			 m_isRemoved = false;
+	bool			 m_isVisible = false;
+	int				 m_visitStamp = 0;
+};
+
+
+struct QuickhullState
+{
+//public member variables
+public:
+	std::vector<Vec3> const*			 m_points = nullptr;
+	float								 m_tolerance = 0.0f;	//points closer to a face than this count as on it
+	std::vector<QuickhullFace>			 m_faces;
+	std::unordered_map<uint64_t, int>	 m_faceForEdge;			//directed edge (start << 32 | end) to the face it winds around
+	int									 m_visitStamp = 0;
+
+	//live faces with outside points, keyed by their farthest altitude and then the lowest face index (stored negated)
+	//removed faces are skipped when they come off the top
+	std::priority_queue<std::pair<float, int>> m_eyeCandidates;
+
+	//coplanar faces merge into one plane, and each plane's faces form a disk, so by Euler the plane count is
+	//live faces - coplanar edges + vertexes whose edges are all coplanar, kept up to date as edges join and split
+	int				 m_numLiveFaces = 0;
+	int				 m_numCoplanarEdges = 0;
+	int				 m_numFlatVertexes = 0;
+	std::vector<int> m_numEdgesAtVertex;
+	std::vector<int> m_numCreasesAtVertex;	//edges between faces that aren't coplanar
+};
+
+
+//
+//static functions
+//
+static uint64_t GetQuickhullEdgeKey(int startIndex, int endIndex)
+{
+	return (static_cast<uint64_t>(startIndex) << 32) | static_cast<uint32_t>(endIndex);
+}
+
+
+static int GetQuickhullNumPlanes(QuickhullState const& state)
+{
+	return state.m_numLiveFaces - state.m_numCoplanarEdges + state.m_numFlatVertexes;
+}
+
+
+static bool AreQuickhullCornersOnFace(QuickhullState const& state, QuickhullFace const& face, QuickhullFace const& cornersFace)
+{
+	std::vector<Vec3> const& points = *state.m_points;
+	for (int cornerNumber = 0; cornerNumber < 3; cornerNumber++)
+	{
+		if (fabsf(DotProduct3D(face.m_normal, points[cornersFace.m_vertexes[cornerNumber]]) - face.m_distFromOrigin) > state.m_tolerance)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//either face's corners being on the other's plane is enough, so this is symmetric but as forgiving as checking against one plane
+//sliver faces have no normal, so they're never coplanar with anything
+static bool AreQuickhullFacesCoplanar(QuickhullState const& state, QuickhullFace const& faceA, QuickhullFace const& faceB)
+{
+	if (DotProduct3D(faceA.m_normal, faceB.m_normal) < 1.0f - COPLANAR_FACE_TOLERANCE)
+	{
+		return false;
+	}
+
+	return AreQuickhullCornersOnFace(state, faceA, faceB) || AreQuickhullCornersOnFace(state, faceB, faceA);
+}
+
+
+static void ChangeQuickhullVertexEdges(QuickhullState& state, int vertexIndex, int numEdgesChange, int numCreasesChange)
+{
+	bool wasFlat = state.m_numEdgesAtVertex[vertexIndex] > 0 && state.m_numCreasesAtVertex[vertexIndex] == 0;
+	state.m_numEdgesAtVertex[vertexIndex] += numEdgesChange;
+	state.m_numCreasesAtVertex[vertexIndex] += numCreasesChange;
+	bool isFlat = state.m_numEdgesAtVertex[vertexIndex] > 0 && state.m_numCreasesAtVertex[vertexIndex] == 0;
+
+	state.m_numFlatVertexes += static_cast<int>(isFlat) - static_cast<int>(wasFlat);
+}
+
+
+//an edge joins when its second face is added and splits when its first face is removed, change is +1 or -1 respectively
+static void ChangeQuickhullEdge(QuickhullState& state, int edgeStart, int edgeEnd, QuickhullFace const& face, QuickhullFace const& neighborFace, int change)
+{
+	int numCreasesChange = 0;
+	if (AreQuickhullFacesCoplanar(state, face, neighborFace))
+	{
+		state.m_numCoplanarEdges += change;
+	}
+	else
+	{
+		numCreasesChange = change;
+	}
+
+	ChangeQuickhullVertexEdges(state, edgeStart, change, numCreasesChange);
+	ChangeQuickhullVertexEdges(state, edgeEnd, change, numCreasesChange);
+}
+
+
+//links a face's edges to its neighbors, for new faces and for faces restored after a growth step is undone
+static void LinkQuickhullFace(QuickhullState& state, int faceIndex)
+{
+	QuickhullFace& face = state.m_faces[faceIndex];
+	face.m_isRemoved = false;
+	state.m_numLiveFaces++;
+	for (int cornerNumber = 0; cornerNumber < 3; cornerNumber++)
+	{
+		int edgeStart = face.m_vertexes[cornerNumber];
+		int edgeEnd = face.m_vertexes[(cornerNumber + 1) % 3];
+		state.m_faceForEdge[GetQuickhullEdgeKey(edgeStart, edgeEnd)] = faceIndex;
+
+		std::unordered_map<uint64_t, int>::const_iterator neighborIter = state.m_faceForEdge.find(GetQuickhullEdgeKey(edgeEnd, edgeStart));
+		if (neighborIter != state.m_faceForEdge.end())
+		{
+			ChangeQuickhullEdge(state, edgeStart, edgeEnd, face, state.m_faces[neighborIter->second], 1);
+		}
+	}
+}
+
+
+static int AddQuickhullFace(QuickhullState& state, int vertexA, int vertexB, int vertexC)
+{
+	std::vector<Vec3> const& points = *state.m_points;
+	QuickhullFace face;
+	face.m_vertexes[0] = vertexA;
+	face.m_vertexes[1] = vertexB;
+	face.m_vertexes[2] = vertexC;
+
+	//a sliver face gets no normal, so nothing is ever outside it and it never makes a plane
+	Vec3 normal = CrossProduct3D(points[vertexB] - points[vertexA], points[vertexC] - points[vertexA]);
+	float normalLength = normal.GetLength();
+	if (normalLength > 0.0f)
+	{
+		face.m_normal = normal / normalLength;
+		face.m_distFromOrigin = DotProduct3D(face.m_normal, points[vertexA]);
+	}
+
+	int faceIndex = static_cast<int>(state.m_faces.size());
+	state.m_faces.push_back(face);
+	LinkQuickhullFace(state, faceIndex);
+	return faceIndex;
+}
+
+
+static void RemoveQuickhullFace(QuickhullState& state, int faceIndex)
+{
+	QuickhullFace& face = state.m_faces[faceIndex];
+	for (int cornerNumber = 0; cornerNumber < 3; cornerNumber++)
+	{
+		int edgeStart = face.m_vertexes[cornerNumber];
+		int edgeEnd = face.m_vertexes[(cornerNumber + 1) % 3];
+		state.m_faceForEdge.erase(GetQuickhullEdgeKey(edgeStart, edgeEnd));
+
+		std::unordered_map<uint64_t, int>::const_iterator neighborIter = state.m_faceForEdge.find(GetQuickhullEdgeKey(edgeEnd, edgeStart));
+		if (neighborIter != state.m_faceForEdge.end())
+		{
+			ChangeQuickhullEdge(state, edgeStart, edgeEnd, face, state.m_faces[neighborIter->second], -1);
+		}
+	}
+	face.m_isRemoved = true;
+	face.m_outsidePoints.clear();
+	face.m_outsidePoints.shrink_to_fit();
+	state.m_numLiveFaces--;
+}
+
+
+//gives each point to the face it's farthest outside of, points inside all of them are done with
+static void AssignQuickhullOutsidePoints(QuickhullState& state, std::vector<int> const& pointIndexes, int firstFaceIndex)
+{
+	std::vector<Vec3> const& points = *state.m_points;
+	for (int pointNumber = 0; pointNumber < static_cast<int>(pointIndexes.size()); pointNumber++)
+	{
+		int pointIndex = pointIndexes[pointNumber];
+		int bestFaceIndex = -1;
+		float bestAltitude = state.m_tolerance;
+		for (int faceIndex = firstFaceIndex; faceIndex < static_cast<int>(state.m_faces.size()); faceIndex++)
+		{
+			QuickhullFace const& face = state.m_faces[faceIndex];
+			float altitude = DotProduct3D(face.m_normal, points[pointIndex]) - face.m_distFromOrigin;
+			if (!face.m_isRemoved && altitude > bestAltitude)
+			{
+				bestFaceIndex = faceIndex;
+				bestAltitude = altitude;
+			}
+		}
+
+		if (bestFaceIndex >= 0)
+		{
+			QuickhullFace& bestFace = state.m_faces[bestFaceIndex];
+			bestFace.m_outsidePoints.push_back(pointIndex);
+			if (bestAltitude > bestFace.m_farthestAltitude)
+			{
+				bestFace.m_farthestPoint = pointIndex;
+				bestFace.m_farthestAltitude = bestAltitude;
+			}
+		}
+	}
+
+	//a face's outside points never change after this, so neither does its place in the queue
+	for (int faceIndex = firstFaceIndex; faceIndex < static_cast<int>(state.m_faces.size()); faceIndex++)
+	{
+		if (state.m_faces[faceIndex].m_farthestPoint >= 0)
+		{
+			state.m_eyeCandidates.push(std::pair<float, int>(state.m_faces[faceIndex].m_farthestAltitude, -faceIndex));
+		}
+	}
+}
+
+
+//flood fills each live face's coplanar neighbors into one plane
+static void GetQuickhullPlanes(QuickhullState& state, std::vector<Plane3D>& out_planes)
+{
+	out_planes.clear();
+	state.m_visitStamp++;
+	std::vector<int> faceStack;
+	for (int faceIndex = 0; faceIndex < static_cast<int>(state.m_faces.size()); faceIndex++)
+	{
+		QuickhullFace& face = state.m_faces[faceIndex];
+		if (face.m_isRemoved || face.m_visitStamp == state.m_visitStamp || face.m_normal.GetLengthSquared() == 0.0f)
+		{
+			continue;
+		}
+
+		out_planes.push_back(Plane3D(face.m_normal, face.m_distFromOrigin));
+		face.m_visitStamp = state.m_visitStamp;
+		faceStack.push_back(faceIndex);
+		while (!faceStack.empty())
+		{
+			QuickhullFace const& planeFace = state.m_faces[faceStack.back()];
+			faceStack.pop_back();
+			for (int cornerNumber = 0; cornerNumber < 3; cornerNumber++)
+			{
+				int neighborFaceIndex = state.m_faceForEdge[GetQuickhullEdgeKey(planeFace.m_vertexes[(cornerNumber + 1) % 3], planeFace.m_vertexes[cornerNumber])];
+				QuickhullFace& neighborFace = state.m_faces[neighborFaceIndex];
+				if (neighborFace.m_visitStamp != state.m_visitStamp && AreQuickhullFacesCoplanar(state, planeFace, neighborFace))
+				{
+					neighborFace.m_visitStamp = state.m_visitStamp;
+					faceStack.push_back(neighborFaceIndex);
+				}
+			}
+		}
+	}
+}
+
+
+//moves each plane out until every point is on or behind it
+static void PushPlanesOutToPoints(std::vector<Vec3> const& points, std::vector<Plane3D>& planes)
+{
+	for (int planeIndex = 0; planeIndex < static_cast<int>(planes.size()); planeIndex++)
+	{
+		Plane3D& plane = planes[planeIndex];
+		plane.m_distFromOrigin = -FLT_MAX;
+		for (int pointIndex = 0; pointIndex < static_cast<int>(points.size()); pointIndex++)
+		{
+			plane.m_distFromOrigin = std::max(plane.m_distFromOrigin, DotProduct3D(plane.m_normal, points[pointIndex]));
+		}
+	}
+}
+
+
+//four planes facing alternate corners of a cube, pushed out to the points, enclose any cloud
+//for points, lines and flat clouds that were asked for fewer planes than their usual bounds need
+static void GetEnclosingTetrahedronPlanes(std::vector<Vec3> const& points, std::vector<Plane3D>& out_planes)
+{
+	float const oneOverRootThree = 0.577350269f;
+	out_planes.clear();
+	out_planes.push_back(Plane3D(Vec3(oneOverRootThree, oneOverRootThree, oneOverRootThree), 0.0f));
+	out_planes.push_back(Plane3D(Vec3(oneOverRootThree, -oneOverRootThree, -oneOverRootThree), 0.0f));
+	out_planes.push_back(Plane3D(Vec3(-oneOverRootThree, oneOverRootThree, -oneOverRootThree), 0.0f));
+	out_planes.push_back(Plane3D(Vec3(-oneOverRootThree, -oneOverRootThree, oneOverRootThree), 0.0f));
+	PushPlanesOutToPoints(points, out_planes);
+}
+
+
+//flat point clouds get a plane on each side plus one standing up along each edge of their 2D hull
+//with maxNumEdges the rim grows from a triangle toward its farthest corner, stops at that many edges and pushes each edge out to the corners past it
+static void GetFlatHullPlanes(std::vector<Vec3> const& points, Vec3 const& origin, Vec3 const& planeNormal, Vec3 const& iBasis, int maxNumEdges, std::vector<Plane3D>& out_planes)
+{
+	Vec3 jBasis = CrossProduct3D(planeNormal, iBasis);
+	std::vector<Vec2> flatPoints;
+	flatPoints.reserve(points.size());
+	for (int pointIndex = 0; pointIndex < static_cast<int>(points.size()); pointIndex++)
+	{
+		Vec3 dispFromOrigin = points[pointIndex] - origin;
+		flatPoints.push_back(Vec2(DotProduct3D(dispFromOrigin, iBasis), DotProduct3D(dispFromOrigin, jBasis)));
+	}
+
+	float planeDist = DotProduct3D(planeNormal, origin);
+	out_planes.push_back(Plane3D(planeNormal, planeDist));
+	out_planes.push_back(Plane3D(-planeNormal, -planeDist));
+
+	ConvexPoly2D flatHull = ConvexPoly2D::MakeConvexHullOfPoints(flatPoints);
+	int numHullPoints = flatHull.GetNumberOfPoints();
+
+	//rim corners kept, as hull point numbers in counterclockwise order
+	std::vector<int> rimPointNumbers;
+	if (maxNumEdges <= 0 || numHullPoints <= maxNumEdges)
+	{
+		for (int pointNumber = 0; pointNumber < numHullPoints; pointNumber++)
+		{
+			rimPointNumbers.push_back(pointNumber);
+		}
+	}
+	else
+	{
+		int farthestPointNumber = 0;
+		float farthestDistSquared = -1.0f;
+		for (int pointNumber = 1; pointNumber < numHullPoints; pointNumber++)
+		{
+			float distSquared = GetDistanceSquared2D(flatHull.GetPoint(0), flatHull.GetPoint(pointNumber));
+			if (distSquared > farthestDistSquared)
+			{
+				farthestDistSquared = distSquared;
+				farthestPointNumber = pointNumber;
+			}
+		}
+		rimPointNumbers.push_back(0);
+		rimPointNumbers.push_back(farthestPointNumber);
+
+		while (static_cast<int>(rimPointNumbers.size()) < maxNumEdges)
+		{
+			//hull points between two rim corners can only be outside the edge joining them
+			int bestRimNumber = -1;
+			int bestPointNumber = -1;
+			float bestAltitude = 0.0f;
+			for (int rimNumber = 0; rimNumber < static_cast<int>(rimPointNumbers.size()); rimNumber++)
+			{
+				int startPointNumber = rimPointNumbers[rimNumber];
+				int endPointNumber = rimPointNumbers[(rimNumber + 1) % rimPointNumbers.size()];
+				Vec2 edgeStart = flatHull.GetPoint(startPointNumber);
+				Vec2 edgeDisp = flatHull.GetPoint(endPointNumber) - edgeStart;
+				Vec2 edgeNormal = Vec2(edgeDisp.y, -edgeDisp.x).GetNormalized();
+				for (int pointNumber = (startPointNumber + 1) % numHullPoints; pointNumber != endPointNumber; pointNumber = (pointNumber + 1) % numHullPoints)
+				{
+					float altitude = DotProduct2D(flatHull.GetPoint(pointNumber) - edgeStart, edgeNormal);
+					if (altitude > bestAltitude)
+					{
+						bestRimNumber = rimNumber;
+						bestPointNumber = pointNumber;
+						bestAltitude = altitude;
+					}
+				}
+			}
+			if (bestRimNumber < 0)
+			{
+				break;
+			}
+
+			rimPointNumbers.insert(rimPointNumbers.begin() + (bestRimNumber + 1), bestPointNumber);
+		}
+	}
+
+	int numRimPoints = static_cast<int>(rimPointNumbers.size());
+	for (int rimNumber = 0; rimNumber < numRimPoints; rimNumber++)
+	{
+		int startPointNumber = rimPointNumbers[rimNumber];
+		int endPointNumber = rimPointNumbers[(rimNumber + 1) % numRimPoints];
+		Vec2 edgeStart = flatHull.GetPoint(startPointNumber);
+		Vec2 edgeDisp = flatHull.GetPoint(endPointNumber) - edgeStart;
+		Vec2 edgeNormal = Vec2(edgeDisp.y, -edgeDisp.x).GetNormalized();
+		float edgeDist = DotProduct2D(edgeStart, edgeNormal);
+		for (int pointNumber = (startPointNumber + 1) % numHullPoints; pointNumber != endPointNumber; pointNumber = (pointNumber + 1) % numHullPoints)
+		{
+			edgeDist = std::max(edgeDist, DotProduct2D(flatHull.GetPoint(pointNumber), edgeNormal));
+		}
+
+		Vec3 edgeNormal3D = iBasis * edgeNormal.x + jBasis * edgeNormal.y;
+		out_planes.push_back(Plane3D(edgeNormal3D, edgeDist + DotProduct3D(edgeNormal3D, origin)));
+	}
+}
+
+
+//
+//constructors
+//
+ConvexHull3D::ConvexHull3D(std::vector<Plane3D> const& boundingPlanes)
+	: m_boundingPlanes(boundingPlanes)
+{
+}
+
+
+//
+//static creation functions
+//
+ConvexHull3D const ConvexHull3D::MakeConvexHullOfPoints(std::vector<Vec3> const& points, int maxNumPlanes)
+{
+	GUARANTEE_OR_DIE(maxNumPlanes == 0 || maxNumPlanes >= 4, "A simplified convex hull needs at least 4 planes");
+
+	ConvexHull3D convexHull;
+	int numPoints = static_cast<int>(points.size());
+	if (numPoints == 0)
+	{
+		return convexHull;
+	}
+
+	//the extreme point on each axis, the tolerance grows with the cloud's distance from the origin since float precision does
+	int extremeIndexes[6] = {};
+	Vec3 maxAbsCoords;
+	for (int pointIndex = 0; pointIndex < numPoints; pointIndex++)
+	{
+		Vec3 const& point = points[pointIndex];
+		for (int axisIndex = 0; axisIndex < 3; axisIndex++)
+		{
+			float coord = (&point.x)[axisIndex];
+			if (coord < (&points[extremeIndexes[axisIndex * 2]].x)[axisIndex])
+			{
+				extremeIndexes[axisIndex * 2] = pointIndex;
+			}
+			if (coord > (&points[extremeIndexes[axisIndex * 2 + 1]].x)[axisIndex])
+			{
+				extremeIndexes[axisIndex * 2 + 1] = pointIndex;
+			}
+		}
+		maxAbsCoords = Vec3(std::max(maxAbsCoords.x, fabsf(point.x)), std::max(maxAbsCoords.y, fabsf(point.y)), std::max(maxAbsCoords.z, fabsf(point.z)));
+	}
+
+	QuickhullState state;
+	state.m_points = &points;
+	state.m_tolerance = 3.0f * FLT_EPSILON * (maxAbsCoords.x + maxAbsCoords.y + maxAbsCoords.z);
+
+	AABB3 bounds = AABB3(points[extremeIndexes[0]].x, points[extremeIndexes[2]].y, points[extremeIndexes[4]].z,
+		points[extremeIndexes[1]].x, points[extremeIndexes[3]].y, points[extremeIndexes[5]].z);
+	std::vector<Plane3D> const boundsPlanes = { Plane3D(Vec3(1.0f, 0.0f, 0.0f), bounds.m_maxs.x), Plane3D(Vec3(-1.0f, 0.0f, 0.0f), -bounds.m_mins.x),
+		Plane3D(Vec3(0.0f, 1.0f, 0.0f), bounds.m_maxs.y), Plane3D(Vec3(0.0f, -1.0f, 0.0f), -bounds.m_mins.y),
+		Plane3D(Vec3(0.0f, 0.0f, 1.0f), bounds.m_maxs.z), Plane3D(Vec3(0.0f, 0.0f, -1.0f), -bounds.m_mins.z) };
+
+	//start from the tetrahedron of the two extremes farthest apart, the point farthest from their line and the point farthest from that plane
+	int simplexIndexes[4] = {};
+	float farthestDistSquared = -1.0f;
+	for (int firstExtreme = 0; firstExtreme < 6; firstExtreme++)
+	{
+		for (int secondExtreme = firstExtreme + 1; secondExtreme < 6; secondExtreme++)
+		{
+			float distSquared = GetDistanceSquared3D(points[extremeIndexes[firstExtreme]], points[extremeIndexes[secondExtreme]]);
+			if (distSquared > farthestDistSquared)
+			{
+				farthestDistSquared = distSquared;
+				simplexIndexes[0] = extremeIndexes[firstExtreme];
+				simplexIndexes[1] = extremeIndexes[secondExtreme];
+			}
+		}
+	}
+	if (farthestDistSquared <= state.m_tolerance * state.m_tolerance)
+	{
+		convexHull.m_boundingPlanes = boundsPlanes;		//every point is in the same spot
+		if (maxNumPlanes > 0 && maxNumPlanes < static_cast<int>(boundsPlanes.size()))
+		{
+			GetEnclosingTetrahedronPlanes(points, convexHull.m_boundingPlanes);
+		}
+		return convexHull;
+	}
+
+	Vec3 const& firstPoint = points[simplexIndexes[0]];
+	Vec3 lineDirection = (points[simplexIndexes[1]] - firstPoint).GetNormalized();
+	float farthestDistFromLine = -1.0f;
+	for (int pointIndex = 0; pointIndex < numPoints; pointIndex++)
+	{
+		float distFromLine = CrossProduct3D(points[pointIndex] - firstPoint, lineDirection).GetLength();
+		if (distFromLine > farthestDistFromLine)
+		{
+			farthestDistFromLine = distFromLine;
+			simplexIndexes[2] = pointIndex;
+		}
+	}
+	if (farthestDistFromLine <= state.m_tolerance)
+	{
+		convexHull.m_boundingPlanes = boundsPlanes;		//every point is on one line
+		if (maxNumPlanes > 0 && maxNumPlanes < static_cast<int>(boundsPlanes.size()))
+		{
+			GetEnclosingTetrahedronPlanes(points, convexHull.m_boundingPlanes);
+		}
+		return convexHull;
+	}
+
+	Vec3 baseNormal = CrossProduct3D(points[simplexIndexes[1]] - firstPoint, points[simplexIndexes[2]] - firstPoint).GetNormalized();
+	float farthestAltitude = 0.0f;
+	for (int pointIndex = 0; pointIndex < numPoints; pointIndex++)
+	{
+		float altitude = DotProduct3D(points[pointIndex] - firstPoint, baseNormal);
+		if (fabsf(altitude) > fabsf(farthestAltitude))
+		{
+			farthestAltitude = altitude;
+			simplexIndexes[3] = pointIndex;
+		}
+	}
+	if (fabsf(farthestAltitude) <= state.m_tolerance)
+	{
+		//the two sides take two planes and the rim needs at least a triangle
+		if (maxNumPlanes > 0 && maxNumPlanes < 5)
+		{
+			GetEnclosingTetrahedronPlanes(points, convexHull.m_boundingPlanes);
+			return convexHull;
+		}
+
+		GetFlatHullPlanes(points, firstPoint, baseNormal, lineDirection, (maxNumPlanes > 0) ? maxNumPlanes - 2 : 0, convexHull.m_boundingPlanes);
+		return convexHull;
+	}
+
+	state.m_numEdgesAtVertex.resize(numPoints);
+	state.m_numCreasesAtVertex.resize(numPoints);
+
+	//wind the base to face away from the fourth point
+	if (farthestAltitude > 0.0f)
+	{
+		std::swap(simplexIndexes[1], simplexIndexes[2]);
+	}
+	AddQuickhullFace(state, simplexIndexes[0], simplexIndexes[1], simplexIndexes[2]);
+	AddQuickhullFace(state, simplexIndexes[0], simplexIndexes[3], simplexIndexes[1]);
+	AddQuickhullFace(state, simplexIndexes[1], simplexIndexes[3], simplexIndexes[2]);
+	AddQuickhullFace(state, simplexIndexes[2], simplexIndexes[3], simplexIndexes[0]);
+
+	std::vector<int> pointIndexes;
+	pointIndexes.reserve(numPoints);
+	for (int pointIndex = 0; pointIndex < numPoints; pointIndex++)
+	{
+		if (pointIndex != simplexIndexes[0] && pointIndex != simplexIndexes[1] && pointIndex != simplexIndexes[2] && pointIndex != simplexIndexes[3])
+		{
+			pointIndexes.push_back(pointIndex);
+		}
+	}
+	AssignQuickhullOutsidePoints(state, pointIndexes, 0);
+
+	bool wasSimplified = false;
+	std::vector<int> visibleFaces;
+	std::vector<int> horizonEdges;
+	std::vector<int> faceStack;
+	while (true)
+	{
+		//grow toward the farthest outside point first, so a hull stopped early is as close to the full one as it can be
+		while (!state.m_eyeCandidates.empty() && state.m_faces[-state.m_eyeCandidates.top().second].m_isRemoved)
+		{
+			state.m_eyeCandidates.pop();
+		}
+		if (state.m_eyeCandidates.empty())
+		{
+			break;
+		}
+		int eyeFaceIndex = -state.m_eyeCandidates.top().second;
+		int eyePointIndex = state.m_faces[eyeFaceIndex].m_farthestPoint;
+
+		//flood out from the eye's face over every face the eye can see, the edges where that stops form the horizon
+		Vec3 const& eyePoint = points[eyePointIndex];
+		state.m_visitStamp++;
+		visibleFaces.clear();
+		horizonEdges.clear();
+		faceStack.clear();
+		faceStack.push_back(eyeFaceIndex);
+		state.m_faces[eyeFaceIndex].m_visitStamp = state.m_visitStamp;
+		state.m_faces[eyeFaceIndex].m_isVisible = true;
+		while (!faceStack.empty())
+		{
+			int faceIndex = faceStack.back();
+			faceStack.pop_back();
+			visibleFaces.push_back(faceIndex);
+
+			for (int cornerNumber = 0; cornerNumber < 3; cornerNumber++)
+			{
+				int edgeStart = state.m_faces[faceIndex].m_vertexes[cornerNumber];
+				int edgeEnd = state.m_faces[faceIndex].m_vertexes[(cornerNumber + 1) % 3];
+				int neighborFaceIndex = state.m_faceForEdge[GetQuickhullEdgeKey(edgeEnd, edgeStart)];
+				QuickhullFace& neighborFace = state.m_faces[neighborFaceIndex];
+				if (neighborFace.m_visitStamp != state.m_visitStamp)
+				{
+					neighborFace.m_visitStamp = state.m_visitStamp;
+					neighborFace.m_isVisible = DotProduct3D(neighborFace.m_normal, eyePoint) - neighborFace.m_distFromOrigin > state.m_tolerance;
+					if (neighborFace.m_isVisible)
+					{
+						faceStack.push_back(neighborFaceIndex);
+					}
+				}
+				if (!neighborFace.m_isVisible)
+				{
+					horizonEdges.push_back(edgeStart);
+					horizonEdges.push_back(edgeEnd);
+				}
+			}
+		}
+
+		//the seen faces' other outside points go to the new faces or turn out to be inside now
+		pointIndexes.clear();
+		for (int visibleNumber = 0; visibleNumber < static_cast<int>(visibleFaces.size()); visibleNumber++)
+		{
+			std::vector<int> const& outsidePoints = state.m_faces[visibleFaces[visibleNumber]].m_outsidePoints;
+			for (int pointNumber = 0; pointNumber < static_cast<int>(outsidePoints.size()); pointNumber++)
+			{
+				if (outsidePoints[pointNumber] != eyePointIndex)
+				{
+					pointIndexes.push_back(outsidePoints[pointNumber]);
+				}
+			}
+			RemoveQuickhullFace(state, visibleFaces[visibleNumber]);
+		}
+
+		int firstNewFaceIndex = static_cast<int>(state.m_faces.size());
+		for (int edgeIndex = 0; edgeIndex < static_cast<int>(horizonEdges.size()); edgeIndex += 2)
+		{
+			AddQuickhullFace(state, horizonEdges[edgeIndex], horizonEdges[edgeIndex + 1], eyePointIndex);
+		}
+
+		//too many planes now, so undo the step and stop with the last hull that fit
+		if (maxNumPlanes > 0 && GetQuickhullNumPlanes(state) > maxNumPlanes)
+		{
+			for (int faceIndex = firstNewFaceIndex; faceIndex < static_cast<int>(state.m_faces.size()); faceIndex++)
+			{
+				RemoveQuickhullFace(state, faceIndex);
+			}
+			for (int visibleNumber = 0; visibleNumber < static_cast<int>(visibleFaces.size()); visibleNumber++)
+			{
+				LinkQuickhullFace(state, visibleFaces[visibleNumber]);
+			}
+			wasSimplified = true;
+			break;
+		}
+
+		AssignQuickhullOutsidePoints(state, pointIndexes, firstNewFaceIndex);
+	}
+
+	GetQuickhullPlanes(state, convexHull.m_boundingPlanes);
+
+	//the last hull that fit leaves some points outside, so push each plane out to the farthest point
+	if (wasSimplified)
+	{
+		PushPlanesOutToPoints(points, convexHull.m_boundingPlanes);
+	}
+	return convexHull;
+}
@@ -1,15 +1,23 @@
-#pragma once
-#include "Engine/Math/Plane3D.hpp"
-#include "Engine/Core/EngineCommon.hpp"
-
-
-class ConvexHull3D
-{
-//public member functions
-public:
-
-
-//public member variables
-public:
-	std::vector<Plane3D> m_boundingPlanes;
-};
+#pragma once
+#include "Engine/Math/Plane3D.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+class ConvexHull3D
+{
+//public member functions
+public:
+	ConvexHull3D() {}
+	explicit ConvexHull3D(std::vector<Plane3D> const& boundingPlanes);
+
+	//static creation functions
+	//quickhull over a point cloud (e.g. a mesh's vertexes), faces that are flat together share one plane
+	//with maxNumPlanes the hull stops growing before it needs more planes than that, then each plane is pushed out to the farthest point,
+	//so the simplified hull is a little bigger than the exact one but still holds every point, which is what a collision proxy wants
+	//flat clouds keep their two sides and simplify their rim the same way, clouds too flat or thin for the planes asked for get an enclosing tetrahedron
+	static ConvexHull3D const MakeConvexHullOfPoints(std::vector<Vec3> const& points, int maxNumPlanes = 0);
+
+//public member variables
+public:
+	std::vector<Plane3D> m_boundingPlanes;
+};
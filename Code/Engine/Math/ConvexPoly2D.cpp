@@ -1,59 +1,111 @@
-#include "Engine/Math/ConvexPoly2D.hpp"
-#include "Engine/Math/ConvexHull2D.hpp"
-
-
-//
-//constructor
-//
-ConvexPoly2D::ConvexPoly2D(std::vector<Vec2> ccwOrderedPoints)
-	: m_ccwOrderedPoints(ccwOrderedPoints)
-{
-}
-
-
-//
-//accessors
-//
-Vec2 ConvexPoly2D::GetPoint(int pointNumber) const
-{
-	if (pointNumber < 0 || pointNumber >= m_ccwOrderedPoints.size())
-	{
-		ERROR_AND_DIE("Point number requested is outside of range!");
-	}
-
-	return m_ccwOrderedPoints[pointNumber];
-}
-
-
-void ConvexPoly2D::Translate(Vec2 const& translation)
-{
-	for (int pointIndex = 0; pointIndex < m_ccwOrderedPoints.size(); pointIndex++)
-	{
-		m_ccwOrderedPoints[pointIndex] += translation;
-	}
-}
-
-
-void ConvexPoly2D::RotateAroundPivot(Vec2 const& pivot, float degreesCCW)
-{
-	for (int pointIndex = 0; pointIndex < m_ccwOrderedPoints.size(); pointIndex++)
-	{
-		Vec2& point = m_ccwOrderedPoints[pointIndex];
-
-		point -= pivot;
-		point.RotateDegrees(degreesCCW);
-		point += pivot;
-	}
-}
-
-
-void ConvexPoly2D::ScaleAroundPivot(Vec2 const& pivot, float scaleIncrease)
-{
-	for (int pointIndex = 0; pointIndex < m_ccwOrderedPoints.size(); pointIndex++)
-	{
-		Vec2& point = m_ccwOrderedPoints[pointIndex];
-
-		Vec2 dispToPivot = point - pivot;
-		point += dispToPivot * scaleIncrease;
-	}
-}
+#include "Engine/Math/ConvexPoly2D.hpp"
+#include "Engine/Math/ConvexHull2D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+
+
+//
+//constructor
+//
+ConvexPoly2D::ConvexPoly2D(std::vector<Vec2> ccwOrderedPoints)
+	: m_ccwOrderedPoints(ccwOrderedPoints)
+{
+}
+
+
+//
+//static creation functions
+//
+//Andrew's monotone chain: sort by x, then build the lower and upper chains, backing up whenever a point would turn clockwise
+ConvexPoly2D const ConvexPoly2D::MakeConvexHullOfPoints(std::vector<Vec2> const& points)
+{
+	std::vector<Vec2> sortedPoints = points;
+	std::sort(sortedPoints.begin(), sortedPoints.end(), [](Vec2 const& pointA, Vec2 const& pointB)
+		{
+			return (pointA.x < pointB.x) || (pointA.x == pointB.x && pointA.y < pointB.y);
+		});
+	sortedPoints.erase(std::unique(sortedPoints.begin(), sortedPoints.end()), sortedPoints.end());
+
+	int numPoints = static_cast<int>(sortedPoints.size());
+	if (numPoints < 3)
+	{
+		return ConvexPoly2D(sortedPoints);
+	}
+
+	std::vector<Vec2> hullPoints(2 * numPoints);
+	int numHullPoints = 0;
+	auto addHullPoint = [&hullPoints, &numHullPoints](Vec2 const& point, int minChainSize)
+		{
+			while (numHullPoints >= minChainSize &&
+				CrossProduct2D(hullPoints[numHullPoints - 1] - hullPoints[numHullPoints - 2], point - hullPoints[numHullPoints - 2]) <= 0.0f)
+			{
+				numHullPoints--;
+			}
+			hullPoints[numHullPoints] = point;
+			numHullPoints++;
+		};
+
+	for (int pointIndex = 0; pointIndex < numPoints; pointIndex++)
+	{
+		addHullPoint(sortedPoints[pointIndex], 2);
+	}
+
+	//the upper chain can't back up into the lower one
+	int upperChainStart = numHullPoints + 1;
+	for (int pointIndex = numPoints - 2; pointIndex >= 0; pointIndex--)
+	{
+		addHullPoint(sortedPoints[pointIndex], upperChainStart);
+	}
+
+	//the last point is the first one again
+	hullPoints.resize(numHullPoints - 1);
+	return ConvexPoly2D(hullPoints);
+}
+
+
+//
+//accessors
+//
+Vec2 ConvexPoly2D::GetPoint(int pointNumber) const
+{
+	if (pointNumber < 0 || pointNumber >= m_ccwOrderedPoints.size())
+	{
+		ERROR_AND_DIE("Point number requested is outside of range!");
+	}
+
+	return m_ccwOrderedPoints[pointNumber];
+}
+
+
+void ConvexPoly2D::Translate(Vec2 const& translation)
+{
+	for (int pointIndex = 0; pointIndex < m_ccwOrderedPoints.size(); pointIndex++)
+	{
+		m_ccwOrderedPoints[pointIndex] += translation;
+	}
+}
+
+
+void ConvexPoly2D::RotateAroundPivot(Vec2 const& pivot, float degreesCCW)
+{
+	for (int pointIndex = 0; pointIndex < m_ccwOrderedPoints.size(); pointIndex++)
+	{
+		Vec2& point = m_ccwOrderedPoints[pointIndex];
+
+		point -= pivot;
+		point.RotateDegrees(degreesCCW);
+		point += pivot;
+	}
+}
+
+
+void ConvexPoly2D::ScaleAroundPivot(Vec2 const& pivot, float scaleIncrease)
+{
+	for (int pointIndex = 0; pointIndex < m_ccwOrderedPoints.size(); pointIndex++)
+	{
+		Vec2& point = m_ccwOrderedPoints[pointIndex];
+
+		Vec2 dispToPivot = point - pivot;
+		point += dispToPivot * scaleIncrease;
+	}
+}
@@ -0,0 +1,151 @@
+#include "Engine/Math/ConvexShape2D.hpp"
+#include "Engine/Math/ConvexPoly2D.hpp"
+#include "Engine/Math/ConvexHull2D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <math.h>
+
+
+//
+//constructors
+//
+ConvexShape2D::ConvexShape2D(ConvexPoly2D const& convexPoly)
+{
+	m_localVertexes.reserve(convexPoly.GetNumberOfPoints());
+	for (int pointIndex = 0; pointIndex < convexPoly.GetNumberOfPoints(); pointIndex++)
+	{
+		m_localVertexes.push_back(convexPoly.GetPoint(pointIndex));
+	}
+}
+
+
+//every pair of plane lines that meets inside all the other planes is a corner
+ConvexShape2D::ConvexShape2D(ConvexHull2D const& convexHull)
+{
+	constexpr float CORNER_TOLERANCE = 0.0001f;
+
+	std::vector<Plane2D> const& planes = convexHull.m_boundingPlanes;
+	int numPlanes = static_cast<int>(planes.size());
+	for (int firstPlaneIndex = 0; firstPlaneIndex < numPlanes; firstPlaneIndex++)
+	{
+		for (int secondPlaneIndex = firstPlaneIndex + 1; secondPlaneIndex < numPlanes; secondPlaneIndex++)
+		{
+			Plane2D const& firstPlane = planes[firstPlaneIndex];
+			Plane2D const& secondPlane = planes[secondPlaneIndex];
+			float determinant = CrossProduct2D(firstPlane.m_normal, secondPlane.m_normal);
+			if (fabsf(determinant) < 0.000001f)
+			{
+				continue;
+			}
+
+			Vec2 corner = Vec2((firstPlane.m_distFromOrigin * secondPlane.m_normal.y) - (secondPlane.m_distFromOrigin * firstPlane.m_normal.y),
+				(secondPlane.m_distFromOrigin * firstPlane.m_normal.x) - (firstPlane.m_distFromOrigin * secondPlane.m_normal.x)) / determinant;
+
+			bool isInsideHull = true;
+			for (int planeIndex = 0; planeIndex < numPlanes && isInsideHull; planeIndex++)
+			{
+				isInsideHull = DotProduct2D(corner, planes[planeIndex].m_normal) - planes[planeIndex].m_distFromOrigin <= CORNER_TOLERANCE;
+			}
+
+			bool isDuplicate = false;
+			for (int vertIndex = 0; vertIndex < static_cast<int>(m_localVertexes.size()) && !isDuplicate; vertIndex++)
+			{
+				isDuplicate = GetDistanceSquared2D(corner, m_localVertexes[vertIndex]) < CORNER_TOLERANCE * CORNER_TOLERANCE;
+			}
+
+			if (isInsideHull && !isDuplicate)
+			{
+				m_localVertexes.push_back(corner);
+			}
+		}
+	}
+
+	//order the corners counterclockwise around their average
+	Vec2 center = Vec2(0.0f, 0.0f);
+	for (int vertIndex = 0; vertIndex < static_cast<int>(m_localVertexes.size()); vertIndex++)
+	{
+		center += m_localVertexes[vertIndex];
+	}
+	if (!m_localVertexes.empty())
+	{
+		center /= static_cast<float>(m_localVertexes.size());
+	}
+
+	std::sort(m_localVertexes.begin(), m_localVertexes.end(), [&](Vec2 const& vertA, Vec2 const& vertB)
+	{
+		return atan2f(vertA.y - center.y, vertA.x - center.x) < atan2f(vertB.y - center.y, vertB.x - center.x);
+	});
+}
+
+
+ConvexShape2D::ConvexShape2D(std::vector<Vec2> const& ccwOrderedPoints)
+	: m_localVertexes(ccwOrderedPoints)
+{
+}
+
+
+//
+//accessors
+//
+Vec2 const ConvexShape2D::GetWorldVertex(int vertexIndex) const
+{
+	Vec2 const& localVertex = m_localVertexes[vertexIndex];
+	return m_position + (m_iBasis * localVertex.x) + (m_iBasis.GetRotated90Degrees() * localVertex.y);
+}
+
+
+int ConvexShape2D::GetSupportVertexIndex(Vec2 const& worldDirection) const
+{
+	int numVertexes = GetNumVertexes();
+	if (numVertexes == 0)
+	{
+		return -1;
+	}
+
+	Vec2 localDirection = Vec2(DotProduct2D(worldDirection, m_iBasis), DotProduct2D(worldDirection, m_iBasis.GetRotated90Degrees()));
+
+	//a convex polygon's projection onto any direction rises to one peak, so walk uphill from last time's answer
+	int supportIndex = (m_lastSupportIndex < numVertexes) ? m_lastSupportIndex : 0;
+	float supportDot = DotProduct2D(m_localVertexes[supportIndex], localDirection);
+	for (int stepIndex = 0; stepIndex < numVertexes; stepIndex++)
+	{
+		int nextIndex = (supportIndex + 1) % numVertexes;
+		int prevIndex = (supportIndex + numVertexes - 1) % numVertexes;
+		float nextDot = DotProduct2D(m_localVertexes[nextIndex], localDirection);
+		float prevDot = DotProduct2D(m_localVertexes[prevIndex], localDirection);
+		if (nextDot > supportDot && nextDot >= prevDot)
+		{
+			supportIndex = nextIndex;
+			supportDot = nextDot;
+		}
+		else if (prevDot > supportDot)
+		{
+			supportIndex = prevIndex;
+			supportDot = prevDot;
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	m_lastSupportIndex = supportIndex;
+	return supportIndex;
+}
+
+
+Vec2 const ConvexShape2D::GetSupportPoint(Vec2 const& worldDirection) const
+{
+	return GetWorldVertex(GetSupportVertexIndex(worldDirection));
+}
+
+
+//
+//mutators
+//
+void ConvexShape2D::SetTransform(Vec2 const& position, float orientationDegrees)
+{
+	m_position = position;
+	m_orientationDegrees = orientationDegrees;
+	m_iBasis = Vec2::MakeFromPolarDegrees(orientationDegrees);
+}
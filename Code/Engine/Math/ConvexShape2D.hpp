@@ -0,0 +1,44 @@
+#pragma once
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//forward declarations
+class ConvexPoly2D;
+class ConvexHull2D;
+
+
+//vertex form of a 2D convex shape for GJK/EPA, build it once and move it with SetTransform instead of rebuilding
+//hulls only store planes, so their corners are solved for here once
+//support queries hill climb from the last support vertex, so they're cheap while the query direction changes slowly
+//the hill climb start is cached in the shape, so don't query one shape from several threads at once
+class ConvexShape2D
+{
+//public member functions
+public:
+	//constructors
+	ConvexShape2D() {}
+	explicit ConvexShape2D(ConvexPoly2D const& convexPoly);
+	explicit ConvexShape2D(ConvexHull2D const& convexHull);	//the hull has to be bounded
+	explicit ConvexShape2D(std::vector<Vec2> const& ccwOrderedPoints);
+
+	//accessors
+	int		   GetNumVertexes() const { return static_cast<int>(m_localVertexes.size()); }
+	Vec2 const GetLocalVertex(int vertexIndex) const { return m_localVertexes[vertexIndex]; }
+	Vec2 const GetWorldVertex(int vertexIndex) const;
+	Vec2 const GetPosition() const { return m_position; }
+	float	   GetOrientationDegrees() const { return m_orientationDegrees; }
+	int		   GetSupportVertexIndex(Vec2 const& worldDirection) const;
+	Vec2 const GetSupportPoint(Vec2 const& worldDirection) const;
+
+	//mutators
+	void SetTransform(Vec2 const& position, float orientationDegrees);
+
+//private member variables
+private:
+	std::vector<Vec2> m_localVertexes;	//counterclockwise
+	Vec2			  m_position = Vec2(0.0f, 0.0f);
+	float			  m_orientationDegrees = 0.0f;
+	Vec2			  m_iBasis = Vec2(1.0f, 0.0f);
+	mutable int		  m_lastSupportIndex = 0;
+};
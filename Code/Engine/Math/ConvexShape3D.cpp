@@ -0,0 +1,190 @@
+#include "Engine/Math/ConvexShape3D.hpp"
+#include "Engine/Math/ConvexHull3D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <math.h>
+
+
+//
+//constructors
+//
+//every three planes that meet inside all the other planes make a corner, corners sharing two planes share an edge
+ConvexShape3D::ConvexShape3D(ConvexHull3D const& convexHull)
+{
+	constexpr float CORNER_TOLERANCE = 0.0001f;
+
+	std::vector<Plane3D> const& planes = convexHull.m_boundingPlanes;
+	int numPlanes = static_cast<int>(planes.size());
+	std::vector<std::vector<int>> cornerPlanes;
+	for (int firstPlaneIndex = 0; firstPlaneIndex < numPlanes; firstPlaneIndex++)
+	{
+		for (int secondPlaneIndex = firstPlaneIndex + 1; secondPlaneIndex < numPlanes; secondPlaneIndex++)
+		{
+			for (int thirdPlaneIndex = secondPlaneIndex + 1; thirdPlaneIndex < numPlanes; thirdPlaneIndex++)
+			{
+				Plane3D const& firstPlane = planes[firstPlaneIndex];
+				Plane3D const& secondPlane = planes[secondPlaneIndex];
+				Plane3D const& thirdPlane = planes[thirdPlaneIndex];
+				Vec3 secondCrossThird = CrossProduct3D(secondPlane.m_normal, thirdPlane.m_normal);
+				float determinant = DotProduct3D(firstPlane.m_normal, secondCrossThird);
+				if (fabsf(determinant) < 0.000001f)
+				{
+					continue;
+				}
+
+				Vec3 corner = ((secondCrossThird * firstPlane.m_distFromOrigin) + (CrossProduct3D(thirdPlane.m_normal, firstPlane.m_normal) * secondPlane.m_distFromOrigin) +
+					(CrossProduct3D(firstPlane.m_normal, secondPlane.m_normal) * thirdPlane.m_distFromOrigin)) / determinant;
+
+				bool isInsideHull = true;
+				for (int planeIndex = 0; planeIndex < numPlanes && isInsideHull; planeIndex++)
+				{
+					isInsideHull = DotProduct3D(corner, planes[planeIndex].m_normal) - planes[planeIndex].m_distFromOrigin <= CORNER_TOLERANCE;
+				}
+				if (!isInsideHull)
+				{
+					continue;
+				}
+
+				//more than three planes can meet at one corner, merge them
+				int cornerIndex = 0;
+				for (; cornerIndex < static_cast<int>(m_localVertexes.size()); cornerIndex++)
+				{
+					if (GetDistanceSquared3D(corner, m_localVertexes[cornerIndex]) < CORNER_TOLERANCE * CORNER_TOLERANCE)
+					{
+						break;
+					}
+				}
+				if (cornerIndex == static_cast<int>(m_localVertexes.size()))
+				{
+					m_localVertexes.push_back(corner);
+					cornerPlanes.emplace_back();
+				}
+
+				std::vector<int>& planesAtCorner = cornerPlanes[cornerIndex];
+				int const planeIndexes[3] = { firstPlaneIndex, secondPlaneIndex, thirdPlaneIndex };
+				for (int planeNumber = 0; planeNumber < 3; planeNumber++)
+				{
+					if (std::find(planesAtCorner.begin(), planesAtCorner.end(), planeIndexes[planeNumber]) == planesAtCorner.end())
+					{
+						planesAtCorner.push_back(planeIndexes[planeNumber]);
+					}
+				}
+			}
+		}
+	}
+
+	int numVertexes = static_cast<int>(m_localVertexes.size());
+	m_firstNeighbors.reserve(numVertexes + 1);
+	for (int vertIndex = 0; vertIndex < numVertexes; vertIndex++)
+	{
+		m_firstNeighbors.push_back(static_cast<int>(m_neighbors.size()));
+		for (int otherIndex = 0; otherIndex < numVertexes; otherIndex++)
+		{
+			if (otherIndex == vertIndex)
+			{
+				continue;
+			}
+
+			int numSharedPlanes = 0;
+			for (int planeNumber = 0; planeNumber < static_cast<int>(cornerPlanes[vertIndex].size()); planeNumber++)
+			{
+				std::vector<int> const& otherPlanes = cornerPlanes[otherIndex];
+				if (std::find(otherPlanes.begin(), otherPlanes.end(), cornerPlanes[vertIndex][planeNumber]) != otherPlanes.end())
+				{
+					numSharedPlanes++;
+				}
+			}
+
+			if (numSharedPlanes >= 2)
+			{
+				m_neighbors.push_back(otherIndex);
+			}
+		}
+	}
+	m_firstNeighbors.push_back(static_cast<int>(m_neighbors.size()));
+}
+
+
+ConvexShape3D::ConvexShape3D(std::vector<Vec3> const& points)
+	: m_localVertexes(points)
+{
+}
+
+
+//
+//accessors
+//
+Vec3 const ConvexShape3D::GetWorldVertex(int vertexIndex) const
+{
+	return m_transform.TransformPosition3D(m_localVertexes[vertexIndex]);
+}
+
+
+int ConvexShape3D::GetSupportVertexIndex(Vec3 const& worldDirection) const
+{
+	int numVertexes = GetNumVertexes();
+	if (numVertexes == 0)
+	{
+		return -1;
+	}
+
+	Vec3 localDirection = Vec3(DotProduct3D(worldDirection, m_transform.GetIBasis3D()), DotProduct3D(worldDirection, m_transform.GetJBasis3D()),
+		DotProduct3D(worldDirection, m_transform.GetKBasis3D()));
+
+	int supportIndex = (m_lastSupportIndex < numVertexes) ? m_lastSupportIndex : 0;
+	float supportDot = DotProduct3D(m_localVertexes[supportIndex], localDirection);
+
+	//no edges, check every point
+	if (m_neighbors.empty())
+	{
+		for (int vertIndex = 0; vertIndex < numVertexes; vertIndex++)
+		{
+			float vertDot = DotProduct3D(m_localVertexes[vertIndex], localDirection);
+			if (vertDot > supportDot)
+			{
+				supportIndex = vertIndex;
+				supportDot = vertDot;
+			}
+		}
+
+		m_lastSupportIndex = supportIndex;
+		return supportIndex;
+	}
+
+	//on a convex polytope the first vertex with no better neighbor is the best overall
+	bool didImprove = true;
+	while (didImprove)
+	{
+		didImprove = false;
+		for (int neighborNumber = m_firstNeighbors[supportIndex]; neighborNumber < m_firstNeighbors[supportIndex + 1]; neighborNumber++)
+		{
+			int neighborIndex = m_neighbors[neighborNumber];
+			float neighborDot = DotProduct3D(m_localVertexes[neighborIndex], localDirection);
+			if (neighborDot > supportDot)
+			{
+				supportIndex = neighborIndex;
+				supportDot = neighborDot;
+				didImprove = true;
+				break;
+			}
+		}
+	}
+
+	m_lastSupportIndex = supportIndex;
+	return supportIndex;
+}
+
+
+Vec3 const ConvexShape3D::GetSupportPoint(Vec3 const& worldDirection) const
+{
+	return GetWorldVertex(GetSupportVertexIndex(worldDirection));
+}
+
+
+//
+//mutators
+//
+void ConvexShape3D::SetTransform(Mat44 const& transform)
+{
+	m_transform = transform;
+}
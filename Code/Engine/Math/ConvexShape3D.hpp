@@ -0,0 +1,42 @@
+#pragma once
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//forward declarations
+class ConvexHull3D;
+
+
+//vertex form of a 3D convex shape for GJK/EPA, build it once and move it with SetTransform instead of rebuilding
+//hulls only store planes, so their corners and the edges between them are solved for here once
+//support queries hill climb along those edges from the last support vertex, point clouds without edges fall back to checking every point
+//the hill climb start is cached in the shape, so don't query one shape from several threads at once
+class ConvexShape3D
+{
+//public member functions
+public:
+	//constructors
+	ConvexShape3D() {}
+	explicit ConvexShape3D(ConvexHull3D const& convexHull);	//the hull has to be bounded
+	explicit ConvexShape3D(std::vector<Vec3> const& points);
+
+	//accessors
+	int			GetNumVertexes() const { return static_cast<int>(m_localVertexes.size()); }
+	Vec3 const	GetLocalVertex(int vertexIndex) const { return m_localVertexes[vertexIndex]; }
+	Vec3 const	GetWorldVertex(int vertexIndex) const;
+	Mat44 const GetTransform() const { return m_transform; }
+	int			GetSupportVertexIndex(Vec3 const& worldDirection) const;
+	Vec3 const	GetSupportPoint(Vec3 const& worldDirection) const;
+
+	//mutators
+	void SetTransform(Mat44 const& transform);	//rotation and translation only
+
+//private member variables
+private:
+	std::vector<Vec3> m_localVertexes;
+	std::vector<int>  m_firstNeighbors;		//per vertex, where its neighbors start in m_neighbors, plus one past the end
+	std::vector<int>  m_neighbors;
+	Mat44			  m_transform;
+	mutable int		  m_lastSupportIndex = 0;
+};
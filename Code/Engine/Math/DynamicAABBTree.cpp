@@ -0,0 +1,616 @@
+#include "Engine/Math/DynamicAABBTree.hpp"
+#include "Engine/Math/ConvexHull3D.hpp"
+#include <algorithm>
+#include <math.h>
+
+
+//constants
+constexpr int QUERY_STACK_SIZE = 128;	//rotations keep the height near 1.44 log2(n), far below this for any proxy count that fits in memory
+
+
+//
+//static functions
+//
+static AABB3 const GetUnion(AABB3 const& boundsA, AABB3 const& boundsB)
+{
+	return AABB3(std::min(boundsA.m_mins.x, boundsB.m_mins.x), std::min(boundsA.m_mins.y, boundsB.m_mins.y), std::min(boundsA.m_mins.z, boundsB.m_mins.z),
+		std::max(boundsA.m_maxs.x, boundsB.m_maxs.x), std::max(boundsA.m_maxs.y, boundsB.m_maxs.y), std::max(boundsA.m_maxs.z, boundsB.m_maxs.z));
+}
+
+
+static float GetHalfSurfaceArea(AABB3 const& bounds)
+{
+	Vec3 dimensions = bounds.m_maxs - bounds.m_mins;
+	return (dimensions.x * dimensions.y) + (dimensions.y * dimensions.z) + (dimensions.z * dimensions.x);
+}
+
+
+static bool DoesBoundsContainBounds(AABB3 const& outerBounds, AABB3 const& innerBounds)
+{
+	return outerBounds.m_mins.x <= innerBounds.m_mins.x && outerBounds.m_mins.y <= innerBounds.m_mins.y && outerBounds.m_mins.z <= innerBounds.m_mins.z &&
+		outerBounds.m_maxs.x >= innerBounds.m_maxs.x && outerBounds.m_maxs.y >= innerBounds.m_maxs.y && outerBounds.m_maxs.z >= innerBounds.m_maxs.z;
+}
+
+
+static AABB3 const GetAABB3ForAABB2(AABB2 const& bounds)
+{
+	return AABB3(bounds.m_mins.x, bounds.m_mins.y, 0.0f, bounds.m_maxs.x, bounds.m_maxs.y, 0.0f);
+}
+
+
+static float GetSafeInverse(float value)
+{
+	if (value > -1e-30f && value < 1e-30f)
+	{
+		return (value < 0.0f) ? -1e30f : 1e30f;
+	}
+
+	return 1.0f / value;
+}
+
+
+//slab test, returns false or the distance the ray enters the bounds (0 if it starts inside)
+static bool GetRayEntryDist(AABB3 const& bounds, Vec3 const& startPosition, Vec3 const& inverseDirection, float maxDistance, float& out_entryDist)
+{
+	float tX1 = (bounds.m_mins.x - startPosition.x) * inverseDirection.x;
+	float tX2 = (bounds.m_maxs.x - startPosition.x) * inverseDirection.x;
+	float tY1 = (bounds.m_mins.y - startPosition.y) * inverseDirection.y;
+	float tY2 = (bounds.m_maxs.y - startPosition.y) * inverseDirection.y;
+	float tZ1 = (bounds.m_mins.z - startPosition.z) * inverseDirection.z;
+	float tZ2 = (bounds.m_maxs.z - startPosition.z) * inverseDirection.z;
+
+	out_entryDist = std::max(std::max(std::min(tX1, tX2), std::min(tY1, tY2)), std::max(std::min(tZ1, tZ2), 0.0f));
+	float exitDist = std::min(std::min(std::max(tX1, tX2), std::max(tY1, tY2)), std::min(std::max(tZ1, tZ2), maxDistance));
+
+	return out_entryDist <= exitDist;
+}
+
+
+//conservative, a box is only culled if it's entirely in front of one plane
+static bool IsBoundsOutsideConvexHull3D(AABB3 const& bounds, ConvexHull3D const& convexHull)
+{
+	Vec3 center = bounds.GetCenter();
+	Vec3 halfDimensions = (bounds.m_maxs - bounds.m_mins) * 0.5f;
+	for (int planeIndex = 0; planeIndex < static_cast<int>(convexHull.m_boundingPlanes.size()); planeIndex++)
+	{
+		Plane3D const& plane = convexHull.m_boundingPlanes[planeIndex];
+		float centerAltitude = DotProduct3D(center, plane.m_normal) - plane.m_distFromOrigin;
+		float boxRadius = (halfDimensions.x * fabsf(plane.m_normal.x)) + (halfDimensions.y * fabsf(plane.m_normal.y)) + (halfDimensions.z * fabsf(plane.m_normal.z));
+		if (centerAltitude > boxRadius)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+//
+//constructors
+//
+DynamicAABBTree::DynamicAABBTree(float fatMargin)
+	: m_fatMargin(fatMargin)
+{
+}
+
+
+//
+//proxy functions
+//
+int DynamicAABBTree::AddProxy(AABB3 const& bounds, void* userData)
+{
+	int leafIndex = AllocateNode();
+	DynamicAABBTreeNode& leaf = m_nodes[leafIndex];
+	Vec3 margin(m_fatMargin, m_fatMargin, m_fatMargin);
+	leaf.m_bounds = AABB3(bounds.m_mins - margin, bounds.m_maxs + margin);
+	leaf.m_userData = userData;
+	leaf.m_height = 0;
+
+	InsertLeaf(leafIndex);
+	m_numProxies++;
+
+	return leafIndex;
+}
+
+
+int DynamicAABBTree::AddProxy(AABB2 const& bounds, void* userData)
+{
+	return AddProxy(GetAABB3ForAABB2(bounds), userData);
+}
+
+
+bool DynamicAABBTree::MoveProxy(int proxyHandle, AABB3 const& newBounds)
+{
+	GUARANTEE_OR_DIE(proxyHandle >= 0 && proxyHandle < static_cast<int>(m_nodes.size()) && m_nodes[proxyHandle].m_height == 0, "DynamicAABBTree tried to move an invalid proxy");
+
+	if (DoesBoundsContainBounds(m_nodes[proxyHandle].m_bounds, newBounds))
+	{
+		return false;
+	}
+
+	RemoveLeaf(proxyHandle);
+
+	Vec3 margin(m_fatMargin, m_fatMargin, m_fatMargin);
+	m_nodes[proxyHandle].m_bounds = AABB3(newBounds.m_mins - margin, newBounds.m_maxs + margin);
+	InsertLeaf(proxyHandle);
+
+	return true;
+}
+
+
+bool DynamicAABBTree::MoveProxy(int proxyHandle, AABB2 const& newBounds)
+{
+	return MoveProxy(proxyHandle, GetAABB3ForAABB2(newBounds));
+}
+
+
+void DynamicAABBTree::RemoveProxy(int proxyHandle)
+{
+	GUARANTEE_OR_DIE(proxyHandle >= 0 && proxyHandle < static_cast<int>(m_nodes.size()) && m_nodes[proxyHandle].m_height == 0, "DynamicAABBTree tried to remove an invalid proxy");
+
+	RemoveLeaf(proxyHandle);
+	FreeNode(proxyHandle);
+	m_numProxies--;
+}
+
+
+void DynamicAABBTree::Clear()
+{
+	m_nodes.clear();
+	m_rootNode = INVALID_AABB_TREE_NODE;
+	m_firstFreeNode = INVALID_AABB_TREE_NODE;
+	m_numProxies = 0;
+}
+
+
+//
+//accessors
+//
+int DynamicAABBTree::GetHeight() const
+{
+	if (m_rootNode == INVALID_AABB_TREE_NODE)
+	{
+		return 0;
+	}
+
+	return m_nodes[m_rootNode].m_height;
+}
+
+
+void* DynamicAABBTree::GetUserData(int proxyHandle) const
+{
+	return m_nodes[proxyHandle].m_userData;
+}
+
+
+AABB3 const DynamicAABBTree::GetFatBounds(int proxyHandle) const
+{
+	return m_nodes[proxyHandle].m_bounds;
+}
+
+
+//
+//queries
+//
+int DynamicAABBTree::GetProxiesOverlappingAABB3(AABB3 const& bounds, std::vector<int>& out_proxyHandles) const
+{
+	int numProxiesFound = 0;
+
+	int nodeStack[QUERY_STACK_SIZE];
+	int stackSize = 0;
+	if (m_rootNode != INVALID_AABB_TREE_NODE)
+	{
+		nodeStack[stackSize++] = m_rootNode;
+	}
+
+	while (stackSize > 0)
+	{
+		int nodeIndex = nodeStack[--stackSize];
+		DynamicAABBTreeNode const& node = m_nodes[nodeIndex];
+		if (!DoAABB3sOverlap(node.m_bounds, bounds))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			out_proxyHandles.push_back(nodeIndex);
+			numProxiesFound++;
+		}
+		else
+		{
+			nodeStack[stackSize++] = node.m_firstChild;
+			nodeStack[stackSize++] = node.m_secondChild;
+		}
+	}
+
+	return numProxiesFound;
+}
+
+
+int DynamicAABBTree::GetProxiesOverlappingAABB2(AABB2 const& bounds, std::vector<int>& out_proxyHandles) const
+{
+	return GetProxiesOverlappingAABB3(GetAABB3ForAABB2(bounds), out_proxyHandles);
+}
+
+
+int DynamicAABBTree::GetProxiesOverlappingConvexHull3D(ConvexHull3D const& convexHull, std::vector<int>& out_proxyHandles) const
+{
+	int numProxiesFound = 0;
+
+	int nodeStack[QUERY_STACK_SIZE];
+	int stackSize = 0;
+	if (m_rootNode != INVALID_AABB_TREE_NODE)
+	{
+		nodeStack[stackSize++] = m_rootNode;
+	}
+
+	while (stackSize > 0)
+	{
+		int nodeIndex = nodeStack[--stackSize];
+		DynamicAABBTreeNode const& node = m_nodes[nodeIndex];
+		if (IsBoundsOutsideConvexHull3D(node.m_bounds, convexHull))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			out_proxyHandles.push_back(nodeIndex);
+			numProxiesFound++;
+		}
+		else
+		{
+			nodeStack[stackSize++] = node.m_firstChild;
+			nodeStack[stackSize++] = node.m_secondChild;
+		}
+	}
+
+	return numProxiesFound;
+}
+
+
+int DynamicAABBTree::GetProxiesHitByRay(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance, std::vector<int>& out_proxyHandles) const
+{
+	int numProxiesFound = 0;
+	Vec3 inverseDirection(GetSafeInverse(directionNormal.x), GetSafeInverse(directionNormal.y), GetSafeInverse(directionNormal.z));
+
+	int nodeStack[QUERY_STACK_SIZE];
+	int stackSize = 0;
+	if (m_rootNode != INVALID_AABB_TREE_NODE)
+	{
+		nodeStack[stackSize++] = m_rootNode;
+	}
+
+	while (stackSize > 0)
+	{
+		int nodeIndex = nodeStack[--stackSize];
+		DynamicAABBTreeNode const& node = m_nodes[nodeIndex];
+		float entryDist = 0.0f;
+		if (!GetRayEntryDist(node.m_bounds, startPosition, inverseDirection, maxDistance, entryDist))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			out_proxyHandles.push_back(nodeIndex);
+			numProxiesFound++;
+		}
+		else
+		{
+			nodeStack[stackSize++] = node.m_firstChild;
+			nodeStack[stackSize++] = node.m_secondChild;
+		}
+	}
+
+	return numProxiesFound;
+}
+
+
+RaycastResult3D DynamicAABBTree::RaycastClosestProxy(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance, AABBTreeProxyRaycastFunction raycastFunction,
+	int* out_proxyHandle) const
+{
+	RaycastResult3D closestResult;
+	closestResult.m_rayStartPosition = startPosition;
+	closestResult.m_rayDirection = directionNormal;
+	closestResult.m_rayLength = maxDistance;
+
+	int closestProxy = INVALID_AABB_TREE_NODE;
+	float closestDist = maxDistance;
+	Vec3 inverseDirection(GetSafeInverse(directionNormal.x), GetSafeInverse(directionNormal.y), GetSafeInverse(directionNormal.z));
+
+	int nodeStack[QUERY_STACK_SIZE];
+	int stackSize = 0;
+	if (m_rootNode != INVALID_AABB_TREE_NODE)
+	{
+		nodeStack[stackSize++] = m_rootNode;
+	}
+
+	while (stackSize > 0)
+	{
+		int nodeIndex = nodeStack[--stackSize];
+		DynamicAABBTreeNode const& node = m_nodes[nodeIndex];
+		float entryDist = 0.0f;
+		if (!GetRayEntryDist(node.m_bounds, startPosition, inverseDirection, closestDist, entryDist))
+		{
+			continue;
+		}
+
+		if (node.IsLeaf())
+		{
+			RaycastResult3D proxyResult = raycastFunction ? raycastFunction(node.m_userData, startPosition, directionNormal, closestDist) :
+				RaycastVsAABB3D(startPosition, directionNormal, closestDist, node.m_bounds);
+			if (proxyResult.m_didImpact && (closestProxy == INVALID_AABB_TREE_NODE || proxyResult.m_impactDist < closestDist))
+			{
+				closestResult = proxyResult;
+				closestDist = proxyResult.m_impactDist;
+				closestProxy = nodeIndex;
+			}
+
+			continue;
+		}
+
+		//push the farther child first so the nearer one is popped next and shortens the ray sooner
+		float firstChildEntryDist = FLT_MAX;
+		float secondChildEntryDist = FLT_MAX;
+		bool doesHitFirstChild = GetRayEntryDist(m_nodes[node.m_firstChild].m_bounds, startPosition, inverseDirection, closestDist, firstChildEntryDist);
+		bool doesHitSecondChild = GetRayEntryDist(m_nodes[node.m_secondChild].m_bounds, startPosition, inverseDirection, closestDist, secondChildEntryDist);
+		if (doesHitFirstChild && doesHitSecondChild)
+		{
+			bool isSecondChildNearer = secondChildEntryDist < firstChildEntryDist;
+			nodeStack[stackSize++] = isSecondChildNearer ? node.m_firstChild : node.m_secondChild;
+			nodeStack[stackSize++] = isSecondChildNearer ? node.m_secondChild : node.m_firstChild;
+		}
+		else if (doesHitFirstChild)
+		{
+			nodeStack[stackSize++] = node.m_firstChild;
+		}
+		else if (doesHitSecondChild)
+		{
+			nodeStack[stackSize++] = node.m_secondChild;
+		}
+	}
+
+	//proxy results carry the shortened ray they were tested with
+	closestResult.m_rayLength = maxDistance;
+	if (out_proxyHandle)
+	{
+		*out_proxyHandle = closestProxy;
+	}
+
+	return closestResult;
+}
+
+
+//
+//private member functions
+//
+int DynamicAABBTree::AllocateNode()
+{
+	int nodeIndex = m_firstFreeNode;
+	if (nodeIndex != INVALID_AABB_TREE_NODE)
+	{
+		m_firstFreeNode = m_nodes[nodeIndex].m_parent;
+	}
+	else
+	{
+		nodeIndex = static_cast<int>(m_nodes.size());
+		m_nodes.emplace_back();
+	}
+
+	DynamicAABBTreeNode& node = m_nodes[nodeIndex];
+	node.m_userData = nullptr;
+	node.m_parent = INVALID_AABB_TREE_NODE;
+	node.m_firstChild = INVALID_AABB_TREE_NODE;
+	node.m_secondChild = INVALID_AABB_TREE_NODE;
+	node.m_height = 0;
+
+	return nodeIndex;
+}
+
+
+void DynamicAABBTree::FreeNode(int nodeIndex)
+{
+	DynamicAABBTreeNode& node = m_nodes[nodeIndex];
+	node.m_userData = nullptr;
+	node.m_parent = m_firstFreeNode;
+	node.m_height = -1;
+	m_firstFreeNode = nodeIndex;
+}
+
+
+void DynamicAABBTree::InsertLeaf(int leafIndex)
+{
+	if (m_rootNode == INVALID_AABB_TREE_NODE)
+	{
+		m_rootNode = leafIndex;
+		m_nodes[leafIndex].m_parent = INVALID_AABB_TREE_NODE;
+		return;
+	}
+
+	//walk down toward the cheapest sibling, where cost is the surface area the new leaf adds to the tree
+	AABB3 leafBounds = m_nodes[leafIndex].m_bounds;
+	int siblingIndex = m_rootNode;
+	while (!m_nodes[siblingIndex].IsLeaf())
+	{
+		DynamicAABBTreeNode const& node = m_nodes[siblingIndex];
+		float nodeArea = GetHalfSurfaceArea(node.m_bounds);
+		float combinedArea = GetHalfSurfaceArea(GetUnion(node.m_bounds, leafBounds));
+
+		//pairing with this node makes a new parent, descending also grows this node to hold the leaf
+		float pairCost = 2.0f * combinedArea;
+		float inheritedCost = 2.0f * (combinedArea - nodeArea);
+
+		DynamicAABBTreeNode const& firstChild = m_nodes[node.m_firstChild];
+		DynamicAABBTreeNode const& secondChild = m_nodes[node.m_secondChild];
+		float firstChildCost = GetHalfSurfaceArea(GetUnion(firstChild.m_bounds, leafBounds)) + inheritedCost;
+		float secondChildCost = GetHalfSurfaceArea(GetUnion(secondChild.m_bounds, leafBounds)) + inheritedCost;
+		if (!firstChild.IsLeaf())
+		{
+			firstChildCost -= GetHalfSurfaceArea(firstChild.m_bounds);
+		}
+		if (!secondChild.IsLeaf())
+		{
+			secondChildCost -= GetHalfSurfaceArea(secondChild.m_bounds);
+		}
+
+		if (pairCost < firstChildCost && pairCost < secondChildCost)
+		{
+			break;
+		}
+
+		siblingIndex = (firstChildCost < secondChildCost) ? node.m_firstChild : node.m_secondChild;
+	}
+
+	//allocating can grow the node list, so only hold indexes across it
+	int oldParentIndex = m_nodes[siblingIndex].m_parent;
+	int newParentIndex = AllocateNode();
+	DynamicAABBTreeNode& newParent = m_nodes[newParentIndex];
+	newParent.m_parent = oldParentIndex;
+	newParent.m_bounds = GetUnion(leafBounds, m_nodes[siblingIndex].m_bounds);
+	newParent.m_height = m_nodes[siblingIndex].m_height + 1;
+	newParent.m_firstChild = siblingIndex;
+	newParent.m_secondChild = leafIndex;
+	m_nodes[siblingIndex].m_parent = newParentIndex;
+	m_nodes[leafIndex].m_parent = newParentIndex;
+
+	if (oldParentIndex != INVALID_AABB_TREE_NODE)
+	{
+		ReplaceChild(oldParentIndex, siblingIndex, newParentIndex);
+	}
+	else
+	{
+		m_rootNode = newParentIndex;
+	}
+
+	RefitAncestors(newParentIndex);
+}
+
+
+void DynamicAABBTree::RemoveLeaf(int leafIndex)
+{
+	if (leafIndex == m_rootNode)
+	{
+		m_rootNode = INVALID_AABB_TREE_NODE;
+		return;
+	}
+
+	//the leaf's sibling takes its parent's place
+	int parentIndex = m_nodes[leafIndex].m_parent;
+	int grandparentIndex = m_nodes[parentIndex].m_parent;
+	int siblingIndex = (m_nodes[parentIndex].m_firstChild == leafIndex) ? m_nodes[parentIndex].m_secondChild : m_nodes[parentIndex].m_firstChild;
+
+	m_nodes[siblingIndex].m_parent = grandparentIndex;
+	if (grandparentIndex != INVALID_AABB_TREE_NODE)
+	{
+		ReplaceChild(grandparentIndex, parentIndex, siblingIndex);
+	}
+	else
+	{
+		m_rootNode = siblingIndex;
+	}
+
+	FreeNode(parentIndex);
+	m_nodes[leafIndex].m_parent = INVALID_AABB_TREE_NODE;
+
+	RefitAncestors(grandparentIndex);
+}
+
+
+//rebalances and recomputes bounds and heights from firstNodeIndex up to the root
+void DynamicAABBTree::RefitAncestors(int firstNodeIndex)
+{
+	int nodeIndex = firstNodeIndex;
+	while (nodeIndex != INVALID_AABB_TREE_NODE)
+	{
+		nodeIndex = BalanceNode(nodeIndex);
+
+		DynamicAABBTreeNode& node = m_nodes[nodeIndex];
+		DynamicAABBTreeNode const& firstChild = m_nodes[node.m_firstChild];
+		DynamicAABBTreeNode const& secondChild = m_nodes[node.m_secondChild];
+		node.m_height = 1 + std::max(firstChild.m_height, secondChild.m_height);
+		node.m_bounds = GetUnion(firstChild.m_bounds, secondChild.m_bounds);
+
+		nodeIndex = node.m_parent;
+	}
+}
+
+
+//if one child is more than one level taller, rotates that child up into this node's place and returns the node now in that place
+int DynamicAABBTree::BalanceNode(int nodeIndex)
+{
+	DynamicAABBTreeNode& node = m_nodes[nodeIndex];
+	if (node.IsLeaf() || node.m_height < 2)
+	{
+		return nodeIndex;
+	}
+
+	int firstChildIndex = node.m_firstChild;
+	int secondChildIndex = node.m_secondChild;
+	int heightDifference = m_nodes[secondChildIndex].m_height - m_nodes[firstChildIndex].m_height;
+	if (heightDifference >= -1 && heightDifference <= 1)
+	{
+		return nodeIndex;
+	}
+
+	//the taller child moves up, this node takes the taller child's shorter grandchild and keeps its other child
+	bool isSecondChildTaller = heightDifference > 1;
+	int tallChildIndex = isSecondChildTaller ? secondChildIndex : firstChildIndex;
+	int shortChildIndex = isSecondChildTaller ? firstChildIndex : secondChildIndex;
+	DynamicAABBTreeNode& tallChild = m_nodes[tallChildIndex];
+	int tallGrandchildIndex = tallChild.m_firstChild;
+	int shortGrandchildIndex = tallChild.m_secondChild;
+	if (m_nodes[tallGrandchildIndex].m_height < m_nodes[shortGrandchildIndex].m_height)
+	{
+		std::swap(tallGrandchildIndex, shortGrandchildIndex);
+	}
+
+	tallChild.m_parent = node.m_parent;
+	if (tallChild.m_parent != INVALID_AABB_TREE_NODE)
+	{
+		ReplaceChild(tallChild.m_parent, nodeIndex, tallChildIndex);
+	}
+	else
+	{
+		m_rootNode = tallChildIndex;
+	}
+
+	tallChild.m_firstChild = nodeIndex;
+	tallChild.m_secondChild = tallGrandchildIndex;
+	node.m_parent = tallChildIndex;
+	if (isSecondChildTaller)
+	{
+		node.m_secondChild = shortGrandchildIndex;
+	}
+	else
+	{
+		node.m_firstChild = shortGrandchildIndex;
+	}
+	m_nodes[shortGrandchildIndex].m_parent = nodeIndex;
+
+	DynamicAABBTreeNode const& shortChild = m_nodes[shortChildIndex];
+	DynamicAABBTreeNode const& shortGrandchild = m_nodes[shortGrandchildIndex];
+	DynamicAABBTreeNode const& tallGrandchild = m_nodes[tallGrandchildIndex];
+	node.m_bounds = GetUnion(shortChild.m_bounds, shortGrandchild.m_bounds);
+	node.m_height = 1 + std::max(shortChild.m_height, shortGrandchild.m_height);
+	tallChild.m_bounds = GetUnion(node.m_bounds, tallGrandchild.m_bounds);
+	tallChild.m_height = 1 + std::max(node.m_height, tallGrandchild.m_height);
+
+	return tallChildIndex;
+}
+
+
+void DynamicAABBTree::ReplaceChild(int parentIndex, int oldChildIndex, int newChildIndex)
+{
+	DynamicAABBTreeNode& parent = m_nodes[parentIndex];
+	if (parent.m_firstChild == oldChildIndex)
+	{
+		parent.m_firstChild = newChildIndex;
+	}
+	else
+	{
+		parent.m_secondChild = newChildIndex;
+	}
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//forward declarations
+class ConvexHull3D;
+
+
+//constants
+constexpr int INVALID_AABB_TREE_NODE = -1;
+
+
+//typedefs
+typedef RaycastResult3D (*AABBTreeProxyRaycastFunction)(void* userData, Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance);
+
+
+struct DynamicAABBTreeNode
+{
+//public member functions
+public:
+	bool IsLeaf() const { return m_firstChild == INVALID_AABB_TREE_NODE; }
+
+//public member variables
+public:
+	AABB3 m_bounds;										//fattened bounds for leaves, union of the children otherwise
+	void* m_userData = nullptr;
+	int	  m_parent = INVALID_AABB_TREE_NODE;			//next free node while the node is unused
+	int	  m_firstChild = INVALID_AABB_TREE_NODE;
+	int	  m_secondChild = INVALID_AABB_TREE_NODE;
+	int	  m_height = -1;								//0 for leaves, -1 for unused nodes
+};
+
+
+//incrementally updated bounding volume tree for objects that move every frame
+//leaves hold each proxy's bounds grown by a fat margin, so small moves inside that margin don't touch the tree
+//inserts pick the cheapest sibling by surface area and tree rotations keep it height balanced
+//2D proxies live in the z = 0 plane, so keep each tree all 2D or all 3D
+class DynamicAABBTree
+{
+//public member functions
+public:
+	//constructors
+	explicit DynamicAABBTree(float fatMargin = 0.1f);
+
+	//proxy functions, the handle is the proxy's leaf node and stays valid until it's removed
+	int	 AddProxy(AABB3 const& bounds, void* userData = nullptr);
+	int	 AddProxy(AABB2 const& bounds, void* userData = nullptr);
+	bool MoveProxy(int proxyHandle, AABB3 const& newBounds);	//returns true if the proxy left its fat bounds and was reinserted
+	bool MoveProxy(int proxyHandle, AABB2 const& newBounds);
+	void RemoveProxy(int proxyHandle);
+	void Clear();
+
+	//accessors
+	int			GetNumProxies() const { return m_numProxies; }
+	int			GetHeight() const;
+	float		GetFatMargin() const { return m_fatMargin; }
+	void*		GetUserData(int proxyHandle) const;
+	AABB3 const GetFatBounds(int proxyHandle) const;
+
+	//queries test fat bounds, they append proxy handles to the list and return how many were added
+	int GetProxiesOverlappingAABB3(AABB3 const& bounds, std::vector<int>& out_proxyHandles) const;
+	int GetProxiesOverlappingAABB2(AABB2 const& bounds, std::vector<int>& out_proxyHandles) const;
+	int GetProxiesOverlappingConvexHull3D(ConvexHull3D const& convexHull, std::vector<int>& out_proxyHandles) const;	//e.g. a view frustum, planes facing out
+	int GetProxiesHitByRay(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance, std::vector<int>& out_proxyHandles) const;
+
+	//walks the tree nearest first, raycasting the proxies whose fat bounds the ray reaches and shortening the ray at each hit
+	//without a raycast function the fat bounds themselves are hit
+	RaycastResult3D RaycastClosestProxy(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance, AABBTreeProxyRaycastFunction raycastFunction = nullptr,
+						int* out_proxyHandle = nullptr) const;
+
+//private member functions
+private:
+	int	 AllocateNode();
+	void FreeNode(int nodeIndex);
+	void InsertLeaf(int leafIndex);
+	void RemoveLeaf(int leafIndex);
+	void RefitAncestors(int firstNodeIndex);
+	int	 BalanceNode(int nodeIndex);
+	void ReplaceChild(int parentIndex, int oldChildIndex, int newChildIndex);
+
+//private member variables
+private:
+	std::vector<DynamicAABBTreeNode> m_nodes;
+	int								 m_rootNode = INVALID_AABB_TREE_NODE;
+	int								 m_firstFreeNode = INVALID_AABB_TREE_NODE;
+	int								 m_numProxies = 0;
+	float							 m_fatMargin = 0.1f;
+};
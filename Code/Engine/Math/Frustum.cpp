@@ -0,0 +1,460 @@
+#include "Engine/Math/Frustum.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/ConvexHull3D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include <math.h>
+
+
+constexpr int NUM_FRUSTUM_PLANES = (int)FrustumPlane::COUNT;
+
+
+//
+//static functions
+//
+//a shape is culled once it's entirely outside any one plane, radius is how far the shape reaches along that plane's normal
+static bool IsOutsideAnyPlane(Plane3D const* planes, Vec3 const& center, Vec3 const& iBasis, Vec3 const& jBasis, Vec3 const& kBasis, Vec3 const& halfDimensions)
+{
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+	{
+		Vec3 const& normal = planes[planeIndex].m_normal;
+		float radius = halfDimensions.x * fabsf(DotProduct3D(normal, iBasis)) + halfDimensions.y * fabsf(DotProduct3D(normal, jBasis)) +
+			halfDimensions.z * fabsf(DotProduct3D(normal, kBasis));
+		if (DotProduct3D(normal, center) - planes[planeIndex].m_distFromOrigin > radius)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+static bool IsSphereOutsideAnyPlane(Plane3D const* planes, Vec3 const& sphereCenter, float sphereRadius)
+{
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+	{
+		if (DotProduct3D(planes[planeIndex].m_normal, sphereCenter) - planes[planeIndex].m_distFromOrigin > sphereRadius)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+static int WriteVisibilityFlags(int outsideLaneBits, int numLanes, bool* out_isVisible)
+{
+	int numVisible = 0;
+	for (int laneIndex = 0; laneIndex < numLanes; laneIndex++)
+	{
+		out_isVisible[laneIndex] = ((outsideLaneBits >> laneIndex) & 1) == 0;
+		numVisible += out_isVisible[laneIndex] ? 1 : 0;
+	}
+	return numVisible;
+}
+
+
+#if defined(ENGINE_SIMD_X86)
+//
+//SSE2 culling kernels, four shapes per iteration, they return how many shapes they handled and how many of those are visible
+//
+static int CullSpheres_SSE2(Plane3D const* planes, int numSpheres, Vec3 const* sphereCenters, float const* sphereRadii, bool* out_isVisible, int& out_numVisible)
+{
+	int sphereIndex = 0;
+	for (; sphereIndex + 4 <= numSpheres; sphereIndex += 4)
+	{
+		Vec3 const* centers = &sphereCenters[sphereIndex];
+		__m128 centerX = _mm_setr_ps(centers[0].x, centers[1].x, centers[2].x, centers[3].x);
+		__m128 centerY = _mm_setr_ps(centers[0].y, centers[1].y, centers[2].y, centers[3].y);
+		__m128 centerZ = _mm_setr_ps(centers[0].z, centers[1].z, centers[2].z, centers[3].z);
+		__m128 radius = _mm_loadu_ps(&sphereRadii[sphereIndex]);
+
+		__m128 isOutside = _mm_setzero_ps();
+		for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+		{
+			Plane3D const& plane = planes[planeIndex];
+			__m128 altitude = _mm_mul_ps(_mm_set1_ps(plane.m_normal.x), centerX);
+			altitude = _mm_add_ps(altitude, _mm_mul_ps(_mm_set1_ps(plane.m_normal.y), centerY));
+			altitude = _mm_add_ps(altitude, _mm_mul_ps(_mm_set1_ps(plane.m_normal.z), centerZ));
+			altitude = _mm_sub_ps(altitude, _mm_set1_ps(plane.m_distFromOrigin));
+			isOutside = _mm_or_ps(isOutside, _mm_cmpgt_ps(altitude, radius));
+		}
+
+		out_numVisible += WriteVisibilityFlags(_mm_movemask_ps(isOutside), 4, &out_isVisible[sphereIndex]);
+	}
+	return sphereIndex;
+}
+
+
+static int CullAABB3s_SSE2(Plane3D const* planes, int numBoxes, AABB3 const* boxes, bool* out_isVisible, int& out_numVisible)
+{
+	__m128 const half = _mm_set1_ps(0.5f);
+
+	int boxIndex = 0;
+	for (; boxIndex + 4 <= numBoxes; boxIndex += 4)
+	{
+		AABB3 const* quad = &boxes[boxIndex];
+		__m128 minX = _mm_setr_ps(quad[0].m_mins.x, quad[1].m_mins.x, quad[2].m_mins.x, quad[3].m_mins.x);
+		__m128 minY = _mm_setr_ps(quad[0].m_mins.y, quad[1].m_mins.y, quad[2].m_mins.y, quad[3].m_mins.y);
+		__m128 minZ = _mm_setr_ps(quad[0].m_mins.z, quad[1].m_mins.z, quad[2].m_mins.z, quad[3].m_mins.z);
+		__m128 maxX = _mm_setr_ps(quad[0].m_maxs.x, quad[1].m_maxs.x, quad[2].m_maxs.x, quad[3].m_maxs.x);
+		__m128 maxY = _mm_setr_ps(quad[0].m_maxs.y, quad[1].m_maxs.y, quad[2].m_maxs.y, quad[3].m_maxs.y);
+		__m128 maxZ = _mm_setr_ps(quad[0].m_maxs.z, quad[1].m_maxs.z, quad[2].m_maxs.z, quad[3].m_maxs.z);
+		__m128 centerX = _mm_mul_ps(_mm_add_ps(minX, maxX), half);
+		__m128 centerY = _mm_mul_ps(_mm_add_ps(minY, maxY), half);
+		__m128 centerZ = _mm_mul_ps(_mm_add_ps(minZ, maxZ), half);
+		__m128 halfX = _mm_mul_ps(_mm_sub_ps(maxX, minX), half);
+		__m128 halfY = _mm_mul_ps(_mm_sub_ps(maxY, minY), half);
+		__m128 halfZ = _mm_mul_ps(_mm_sub_ps(maxZ, minZ), half);
+
+		__m128 isOutside = _mm_setzero_ps();
+		for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+		{
+			Plane3D const& plane = planes[planeIndex];
+			__m128 altitude = _mm_mul_ps(_mm_set1_ps(plane.m_normal.x), centerX);
+			altitude = _mm_add_ps(altitude, _mm_mul_ps(_mm_set1_ps(plane.m_normal.y), centerY));
+			altitude = _mm_add_ps(altitude, _mm_mul_ps(_mm_set1_ps(plane.m_normal.z), centerZ));
+			altitude = _mm_sub_ps(altitude, _mm_set1_ps(plane.m_distFromOrigin));
+
+			__m128 radius = _mm_mul_ps(_mm_set1_ps(fabsf(plane.m_normal.x)), halfX);
+			radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(fabsf(plane.m_normal.y)), halfY));
+			radius = _mm_add_ps(radius, _mm_mul_ps(_mm_set1_ps(fabsf(plane.m_normal.z)), halfZ));
+			isOutside = _mm_or_ps(isOutside, _mm_cmpgt_ps(altitude, radius));
+		}
+
+		out_numVisible += WriteVisibilityFlags(_mm_movemask_ps(isOutside), 4, &out_isVisible[boxIndex]);
+	}
+	return boxIndex;
+}
+
+
+static int CullOBB3s_SSE2(Plane3D const* planes, int numBoxes, OBB3 const* boxes, bool* out_isVisible, int& out_numVisible)
+{
+	__m128 const signBits = _mm_set1_ps(-0.0f);
+
+	int boxIndex = 0;
+	for (; boxIndex + 4 <= numBoxes; boxIndex += 4)
+	{
+		//one register per float of OBB3, in member order
+		__m128 boxFloats[15];
+		for (int floatIndex = 0; floatIndex < 15; floatIndex++)
+		{
+			float const* firstFloat = &boxes[boxIndex].m_center.x + floatIndex;
+			int const floatsPerBox = static_cast<int>(sizeof(OBB3) / sizeof(float));
+			boxFloats[floatIndex] = _mm_setr_ps(firstFloat[0], firstFloat[floatsPerBox], firstFloat[2 * floatsPerBox], firstFloat[3 * floatsPerBox]);
+		}
+
+		__m128 isOutside = _mm_setzero_ps();
+		for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+		{
+			Plane3D const& plane = planes[planeIndex];
+			__m128 normalX = _mm_set1_ps(plane.m_normal.x);
+			__m128 normalY = _mm_set1_ps(plane.m_normal.y);
+			__m128 normalZ = _mm_set1_ps(plane.m_normal.z);
+
+			//center, then the i, j and k bases
+			__m128 dots[4];
+			for (int vecIndex = 0; vecIndex < 4; vecIndex++)
+			{
+				dots[vecIndex] = _mm_mul_ps(normalX, boxFloats[vecIndex * 3]);
+				dots[vecIndex] = _mm_add_ps(dots[vecIndex], _mm_mul_ps(normalY, boxFloats[vecIndex * 3 + 1]));
+				dots[vecIndex] = _mm_add_ps(dots[vecIndex], _mm_mul_ps(normalZ, boxFloats[vecIndex * 3 + 2]));
+			}
+
+			__m128 altitude = _mm_sub_ps(dots[0], _mm_set1_ps(plane.m_distFromOrigin));
+			__m128 radius = _mm_mul_ps(boxFloats[12], _mm_andnot_ps(signBits, dots[1]));
+			radius = _mm_add_ps(radius, _mm_mul_ps(boxFloats[13], _mm_andnot_ps(signBits, dots[2])));
+			radius = _mm_add_ps(radius, _mm_mul_ps(boxFloats[14], _mm_andnot_ps(signBits, dots[3])));
+			isOutside = _mm_or_ps(isOutside, _mm_cmpgt_ps(altitude, radius));
+		}
+
+		out_numVisible += WriteVisibilityFlags(_mm_movemask_ps(isOutside), 4, &out_isVisible[boxIndex]);
+	}
+	return boxIndex;
+}
+
+
+//
+//AVX2 culling kernels, eight shapes per iteration gathered straight out of the caller's arrays
+//
+SIMD_AVX2_FUNCTION static int CullSpheres_AVX2(Plane3D const* planes, int numSpheres, Vec3 const* sphereCenters, float const* sphereRadii, bool* out_isVisible, int& out_numVisible)
+{
+	__m256i laneOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(sizeof(Vec3))));
+
+	int sphereIndex = 0;
+	for (; sphereIndex + 8 <= numSpheres; sphereIndex += 8)
+	{
+		float const* firstLaneFloats = &sphereCenters[sphereIndex].x;
+		__m256 centerX = _mm256_i32gather_ps(firstLaneFloats, laneOffsets, 1);
+		__m256 centerY = _mm256_i32gather_ps(firstLaneFloats + 1, laneOffsets, 1);
+		__m256 centerZ = _mm256_i32gather_ps(firstLaneFloats + 2, laneOffsets, 1);
+		__m256 radius = _mm256_loadu_ps(&sphereRadii[sphereIndex]);
+
+		__m256 isOutside = _mm256_setzero_ps();
+		for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+		{
+			Plane3D const& plane = planes[planeIndex];
+			__m256 altitude = _mm256_fmadd_ps(_mm256_set1_ps(plane.m_normal.x), centerX, _mm256_set1_ps(-plane.m_distFromOrigin));
+			altitude = _mm256_fmadd_ps(_mm256_set1_ps(plane.m_normal.y), centerY, altitude);
+			altitude = _mm256_fmadd_ps(_mm256_set1_ps(plane.m_normal.z), centerZ, altitude);
+			isOutside = _mm256_or_ps(isOutside, _mm256_cmp_ps(altitude, radius, _CMP_GT_OQ));
+		}
+
+		out_numVisible += WriteVisibilityFlags(_mm256_movemask_ps(isOutside), 8, &out_isVisible[sphereIndex]);
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+	return sphereIndex;
+}
+
+
+SIMD_AVX2_FUNCTION static int CullAABB3s_AVX2(Plane3D const* planes, int numBoxes, AABB3 const* boxes, bool* out_isVisible, int& out_numVisible)
+{
+	__m256i laneOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(sizeof(AABB3))));
+	__m256 const half = _mm256_set1_ps(0.5f);
+
+	int boxIndex = 0;
+	for (; boxIndex + 8 <= numBoxes; boxIndex += 8)
+	{
+		float const* firstLaneFloats = &boxes[boxIndex].m_mins.x;
+		__m256 minX = _mm256_i32gather_ps(firstLaneFloats, laneOffsets, 1);
+		__m256 minY = _mm256_i32gather_ps(firstLaneFloats + 1, laneOffsets, 1);
+		__m256 minZ = _mm256_i32gather_ps(firstLaneFloats + 2, laneOffsets, 1);
+		__m256 maxX = _mm256_i32gather_ps(firstLaneFloats + 3, laneOffsets, 1);
+		__m256 maxY = _mm256_i32gather_ps(firstLaneFloats + 4, laneOffsets, 1);
+		__m256 maxZ = _mm256_i32gather_ps(firstLaneFloats + 5, laneOffsets, 1);
+		__m256 centerX = _mm256_mul_ps(_mm256_add_ps(minX, maxX), half);
+		__m256 centerY = _mm256_mul_ps(_mm256_add_ps(minY, maxY), half);
+		__m256 centerZ = _mm256_mul_ps(_mm256_add_ps(minZ, maxZ), half);
+		__m256 halfX = _mm256_mul_ps(_mm256_sub_ps(maxX, minX), half);
+		__m256 halfY = _mm256_mul_ps(_mm256_sub_ps(maxY, minY), half);
+		__m256 halfZ = _mm256_mul_ps(_mm256_sub_ps(maxZ, minZ), half);
+
+		__m256 isOutside = _mm256_setzero_ps();
+		for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+		{
+			Plane3D const& plane = planes[planeIndex];
+			__m256 altitude = _mm256_fmadd_ps(_mm256_set1_ps(plane.m_normal.x), centerX, _mm256_set1_ps(-plane.m_distFromOrigin));
+			altitude = _mm256_fmadd_ps(_mm256_set1_ps(plane.m_normal.y), centerY, altitude);
+			altitude = _mm256_fmadd_ps(_mm256_set1_ps(plane.m_normal.z), centerZ, altitude);
+
+			__m256 radius = _mm256_mul_ps(_mm256_set1_ps(fabsf(plane.m_normal.x)), halfX);
+			radius = _mm256_fmadd_ps(_mm256_set1_ps(fabsf(plane.m_normal.y)), halfY, radius);
+			radius = _mm256_fmadd_ps(_mm256_set1_ps(fabsf(plane.m_normal.z)), halfZ, radius);
+			isOutside = _mm256_or_ps(isOutside, _mm256_cmp_ps(altitude, radius, _CMP_GT_OQ));
+		}
+
+		out_numVisible += WriteVisibilityFlags(_mm256_movemask_ps(isOutside), 8, &out_isVisible[boxIndex]);
+	}
+
+	_mm256_zeroupper();
+	return boxIndex;
+}
+
+
+SIMD_AVX2_FUNCTION static int CullOBB3s_AVX2(Plane3D const* planes, int numBoxes, OBB3 const* boxes, bool* out_isVisible, int& out_numVisible)
+{
+	__m256i laneOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(static_cast<int>(sizeof(OBB3))));
+	__m256 const signBits = _mm256_set1_ps(-0.0f);
+
+	int boxIndex = 0;
+	for (; boxIndex + 8 <= numBoxes; boxIndex += 8)
+	{
+		//one register per float of OBB3, in member order
+		float const* firstLaneFloats = &boxes[boxIndex].m_center.x;
+		__m256 boxFloats[15];
+		for (int floatIndex = 0; floatIndex < 15; floatIndex++)
+		{
+			boxFloats[floatIndex] = _mm256_i32gather_ps(firstLaneFloats + floatIndex, laneOffsets, 1);
+		}
+
+		__m256 isOutside = _mm256_setzero_ps();
+		for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+		{
+			Plane3D const& plane = planes[planeIndex];
+			__m256 normalX = _mm256_set1_ps(plane.m_normal.x);
+			__m256 normalY = _mm256_set1_ps(plane.m_normal.y);
+			__m256 normalZ = _mm256_set1_ps(plane.m_normal.z);
+
+			//center, then the i, j and k bases
+			__m256 dots[4];
+			for (int vecIndex = 0; vecIndex < 4; vecIndex++)
+			{
+				dots[vecIndex] = _mm256_mul_ps(normalX, boxFloats[vecIndex * 3]);
+				dots[vecIndex] = _mm256_fmadd_ps(normalY, boxFloats[vecIndex * 3 + 1], dots[vecIndex]);
+				dots[vecIndex] = _mm256_fmadd_ps(normalZ, boxFloats[vecIndex * 3 + 2], dots[vecIndex]);
+			}
+
+			__m256 altitude = _mm256_sub_ps(dots[0], _mm256_set1_ps(plane.m_distFromOrigin));
+			__m256 radius = _mm256_mul_ps(boxFloats[12], _mm256_andnot_ps(signBits, dots[1]));
+			radius = _mm256_fmadd_ps(boxFloats[13], _mm256_andnot_ps(signBits, dots[2]), radius);
+			radius = _mm256_fmadd_ps(boxFloats[14], _mm256_andnot_ps(signBits, dots[3]), radius);
+			isOutside = _mm256_or_ps(isOutside, _mm256_cmp_ps(altitude, radius, _CMP_GT_OQ));
+		}
+
+		out_numVisible += WriteVisibilityFlags(_mm256_movemask_ps(isOutside), 8, &out_isVisible[boxIndex]);
+	}
+
+	_mm256_zeroupper();
+	return boxIndex;
+}
+#endif
+
+
+//
+//constructors
+//
+//each plane is a sum or difference of rows of the clip transform (Gribb and Hartmann), points inside have row3 +/- row0 and so on >= 0
+Frustum::Frustum(Mat44 const& worldToClipTransform)
+{
+	float const* values = worldToClipTransform.GetAsFloatArray();
+	float rows[4][4];
+	for (int rowIndex = 0; rowIndex < 4; rowIndex++)
+	{
+		rows[rowIndex][0] = values[Mat44::Ix + rowIndex];
+		rows[rowIndex][1] = values[Mat44::Jx + rowIndex];
+		rows[rowIndex][2] = values[Mat44::Kx + rowIndex];
+		rows[rowIndex][3] = values[Mat44::Tx + rowIndex];
+	}
+
+	//clip depth runs from 0 to w, so near is row2 alone
+	float planeCoefficients[NUM_FRUSTUM_PLANES][4];
+	for (int coefficientIndex = 0; coefficientIndex < 4; coefficientIndex++)
+	{
+		planeCoefficients[(int)FrustumPlane::LEFT_PLANE][coefficientIndex] = rows[3][coefficientIndex] + rows[0][coefficientIndex];
+		planeCoefficients[(int)FrustumPlane::RIGHT_PLANE][coefficientIndex] = rows[3][coefficientIndex] - rows[0][coefficientIndex];
+		planeCoefficients[(int)FrustumPlane::BOTTOM_PLANE][coefficientIndex] = rows[3][coefficientIndex] + rows[1][coefficientIndex];
+		planeCoefficients[(int)FrustumPlane::TOP_PLANE][coefficientIndex] = rows[3][coefficientIndex] - rows[1][coefficientIndex];
+		planeCoefficients[(int)FrustumPlane::NEAR_PLANE][coefficientIndex] = rows[2][coefficientIndex];
+		planeCoefficients[(int)FrustumPlane::FAR_PLANE][coefficientIndex] = rows[3][coefficientIndex] - rows[2][coefficientIndex];
+	}
+
+	//flip to face out and normalize
+	for (int planeIndex = 0; planeIndex < NUM_FRUSTUM_PLANES; planeIndex++)
+	{
+		float const* coefficients = planeCoefficients[planeIndex];
+		Vec3 inwardNormal = Vec3(coefficients[0], coefficients[1], coefficients[2]);
+		float normalLength = inwardNormal.GetLength();
+		float inverseLength = (normalLength > 0.0f) ? 1.0f / normalLength : 0.0f;
+		m_planes[planeIndex] = Plane3D(inwardNormal * -inverseLength, coefficients[3] * inverseLength);
+	}
+}
+
+
+//
+//accessors
+//
+ConvexHull3D const Frustum::GetAsConvexHull3D() const
+{
+	ConvexHull3D convexHull;
+	convexHull.m_boundingPlanes.assign(m_planes, m_planes + NUM_FRUSTUM_PLANES);
+	return convexHull;
+}
+
+
+//
+//single visibility tests
+//
+bool Frustum::IsPointVisible(Vec3 const& point) const
+{
+	return !IsSphereOutsideAnyPlane(m_planes, point, 0.0f);
+}
+
+
+bool Frustum::IsSphereVisible(Vec3 const& sphereCenter, float sphereRadius) const
+{
+	return !IsSphereOutsideAnyPlane(m_planes, sphereCenter, sphereRadius);
+}
+
+
+bool Frustum::IsAABB3Visible(AABB3 const& box) const
+{
+	return !IsOutsideAnyPlane(m_planes, box.GetCenter(), Vec3(1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), (box.m_maxs - box.m_mins) * 0.5f);
+}
+
+
+bool Frustum::IsOBB3Visible(OBB3 const& box) const
+{
+	return !IsOutsideAnyPlane(m_planes, box.m_center, box.m_iBasisNormal, box.m_jBasisNormal, box.m_kBasisNormal, box.m_halfDimensions);
+}
+
+
+//
+//batch culling
+//
+int Frustum::CullSpheres(int numSpheres, Vec3 const* sphereCenters, float const* sphereRadii, bool* out_isVisible) const
+{
+	int numVisible = 0;
+	int sphereIndex = 0;
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		sphereIndex = CullSpheres_AVX2(m_planes, numSpheres, sphereCenters, sphereRadii, out_isVisible, numVisible);
+	}
+	if (simdLevel != SIMDLevel::SCALAR)
+	{
+		sphereIndex += CullSpheres_SSE2(m_planes, numSpheres - sphereIndex, sphereCenters + sphereIndex, sphereRadii + sphereIndex, out_isVisible + sphereIndex, numVisible);
+	}
+#endif
+
+	for (; sphereIndex < numSpheres; sphereIndex++)
+	{
+		out_isVisible[sphereIndex] = !IsSphereOutsideAnyPlane(m_planes, sphereCenters[sphereIndex], sphereRadii[sphereIndex]);
+		numVisible += out_isVisible[sphereIndex] ? 1 : 0;
+	}
+	return numVisible;
+}
+
+
+int Frustum::CullAABB3s(int numBoxes, AABB3 const* boxes, bool* out_isVisible) const
+{
+	int numVisible = 0;
+	int boxIndex = 0;
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		boxIndex = CullAABB3s_AVX2(m_planes, numBoxes, boxes, out_isVisible, numVisible);
+	}
+	if (simdLevel != SIMDLevel::SCALAR)
+	{
+		boxIndex += CullAABB3s_SSE2(m_planes, numBoxes - boxIndex, boxes + boxIndex, out_isVisible + boxIndex, numVisible);
+	}
+#endif
+
+	for (; boxIndex < numBoxes; boxIndex++)
+	{
+		out_isVisible[boxIndex] = IsAABB3Visible(boxes[boxIndex]);
+		numVisible += out_isVisible[boxIndex] ? 1 : 0;
+	}
+	return numVisible;
+}
+
+
+int Frustum::CullOBB3s(int numBoxes, OBB3 const* boxes, bool* out_isVisible) const
+{
+	int numVisible = 0;
+	int boxIndex = 0;
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		boxIndex = CullOBB3s_AVX2(m_planes, numBoxes, boxes, out_isVisible, numVisible);
+	}
+	if (simdLevel != SIMDLevel::SCALAR)
+	{
+		boxIndex += CullOBB3s_SSE2(m_planes, numBoxes - boxIndex, boxes + boxIndex, out_isVisible + boxIndex, numVisible);
+	}
+#endif
+
+	for (; boxIndex < numBoxes; boxIndex++)
+	{
+		out_isVisible[boxIndex] = IsOBB3Visible(boxes[boxIndex]);
+		numVisible += out_isVisible[boxIndex] ? 1 : 0;
+	}
+	return numVisible;
+}
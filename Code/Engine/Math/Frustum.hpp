@@ -0,0 +1,54 @@
+#pragma once
+#include "Engine/Math/Plane3D.hpp"
+
+
+//forward declarations
+struct AABB3;
+struct OBB3;
+struct Mat44;
+class  ConvexHull3D;
+
+
+//enums
+enum class FrustumPlane
+{
+	LEFT_PLANE,
+	RIGHT_PLANE,
+	BOTTOM_PLANE,
+	TOP_PLANE,
+	NEAR_PLANE,
+	FAR_PLANE,
+	COUNT
+};
+
+
+//view volume as six planes facing out, usually from Camera::GetFrustum
+//visibility tests are conservative: shapes crossing a frustum corner can pass even though no plane of them is inside, which only costs a wasted draw
+class Frustum
+{
+//public member functions
+public:
+	//constructors
+	Frustum() {}
+	explicit Frustum(Mat44 const& worldToClipTransform);	//projection appended with view, clip depth is 0 to w like our projection matrices
+
+	//accessors
+	Plane3D const& GetPlane(FrustumPlane plane) const { return m_planes[(int)plane]; }
+	ConvexHull3D const GetAsConvexHull3D() const;	//e.g. for DynamicAABBTree::GetProxiesOverlappingConvexHull3D
+
+	//single visibility tests, touching a plane counts as visible
+	bool IsPointVisible(Vec3 const& point) const;
+	bool IsSphereVisible(Vec3 const& sphereCenter, float sphereRadius) const;
+	bool IsAABB3Visible(AABB3 const& box) const;
+	bool IsOBB3Visible(OBB3 const& box) const;
+
+	//batch culling, fills one visibility flag per shape and returns how many are visible
+	//shapes are tested eight at a time with AVX2, four at a time with SSE2 (see SIMDUtils)
+	int CullSpheres(int numSpheres, Vec3 const* sphereCenters, float const* sphereRadii, bool* out_isVisible) const;
+	int CullAABB3s(int numBoxes, AABB3 const* boxes, bool* out_isVisible) const;
+	int CullOBB3s(int numBoxes, OBB3 const* boxes, bool* out_isVisible) const;
+
+//private member variables
+private:
+	Plane3D m_planes[(int)FrustumPlane::COUNT];
+};
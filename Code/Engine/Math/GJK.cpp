@@ -0,0 +1,854 @@
+#include "Engine/Math/GJK.hpp"
+#include "Engine/Math/ConvexShape2D.hpp"
+#include "Engine/Math/ConvexShape3D.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <algorithm>
+#include <float.h>
+#include <math.h>
+
+
+//both dimensions share one GJK, 2D shapes are run in the z = 0 plane
+constexpr int	GJK_MAX_ITERATIONS = 64;
+constexpr int	EPA_MAX_ITERATIONS = 64;
+constexpr float GJK_RELATIVE_TOLERANCE = 0.0001f;		//stop once a new support point gets the simplex less than this fraction closer
+constexpr float GJK_OVERLAP_DISTANCE = 0.000001f;		//closer than this counts as touching
+constexpr float EPA_TOLERANCE = 0.0001f;
+constexpr float DEGENERATE_TOLERANCE = 0.000001f;
+
+
+struct GJKVertex
+{
+//public member variables
+public:
+	Vec3 m_pointA;
+	Vec3 m_pointB;
+	Vec3 m_point;		//A - B
+	int	 m_indexA = 0;
+	int	 m_indexB = 0;
+};
+
+
+struct GJKSimplex
+{
+//public member variables
+public:
+	GJKVertex m_vertexes[4];
+	float	  m_weights[4] = {};	//barycentric weights of the closest point to the origin
+	int		  m_numVertexes = 0;
+};
+
+
+struct GJKState
+{
+//public member variables
+public:
+	GJKSimplex m_simplex;
+	Vec3	   m_closestPoint;
+	bool	   m_isOverlapping = false;
+	int		   m_numIterations = 0;
+};
+
+
+struct EPAFace
+{
+//public member variables
+public:
+	int	  m_vertexes[3] = {};
+	Vec3  m_normal;
+	float m_distance = 0.0f;
+};
+
+
+//
+//static functions
+//
+static GJKVertex MakeGJKVertex(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, int indexA, int indexB)
+{
+	GJKVertex vertex;
+	vertex.m_pointA = Vec3(shapeA.GetWorldVertex(indexA), 0.0f);
+	vertex.m_pointB = Vec3(shapeB.GetWorldVertex(indexB), 0.0f);
+	vertex.m_point = vertex.m_pointA - vertex.m_pointB;
+	vertex.m_indexA = indexA;
+	vertex.m_indexB = indexB;
+	return vertex;
+}
+
+
+static GJKVertex MakeGJKVertex(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, int indexA, int indexB)
+{
+	GJKVertex vertex;
+	vertex.m_pointA = shapeA.GetWorldVertex(indexA);
+	vertex.m_pointB = shapeB.GetWorldVertex(indexB);
+	vertex.m_point = vertex.m_pointA - vertex.m_pointB;
+	vertex.m_indexA = indexA;
+	vertex.m_indexB = indexB;
+	return vertex;
+}
+
+
+static GJKVertex GetSupportVertex(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, Vec3 const& direction)
+{
+	Vec2 directionXY = Vec2(direction.x, direction.y);
+	return MakeGJKVertex(shapeA, shapeB, shapeA.GetSupportVertexIndex(directionXY), shapeB.GetSupportVertexIndex(-directionXY));
+}
+
+
+static GJKVertex GetSupportVertex(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, Vec3 const& direction)
+{
+	return MakeGJKVertex(shapeA, shapeB, shapeA.GetSupportVertexIndex(direction), shapeB.GetSupportVertexIndex(-direction));
+}
+
+
+static void SetSimplexVertex(GJKSimplex& simplex, int vertexNumber, GJKVertex const& vertex, float weight)
+{
+	simplex.m_vertexes[vertexNumber] = vertex;
+	simplex.m_weights[vertexNumber] = weight;
+}
+
+
+static Vec3 const GetSimplexPoint(GJKSimplex const& simplex)
+{
+	Vec3 point;
+	for (int vertexNumber = 0; vertexNumber < simplex.m_numVertexes; vertexNumber++)
+	{
+		point += simplex.m_vertexes[vertexNumber].m_point * simplex.m_weights[vertexNumber];
+	}
+	return point;
+}
+
+
+//the solvers reduce the simplex to the vertexes whose region holds the closest point to the origin and weight them
+static void SolveSegment(GJKSimplex& simplex)
+{
+	GJKVertex vertexA = simplex.m_vertexes[0];
+	GJKVertex vertexB = simplex.m_vertexes[1];
+	Vec3 dispAToB = vertexB.m_point - vertexA.m_point;
+	float segmentLengthSquared = dispAToB.GetLengthSquared();
+	float fractionAlong = (segmentLengthSquared > 0.0f) ? -DotProduct3D(vertexA.m_point, dispAToB) / segmentLengthSquared : 0.0f;
+
+	if (fractionAlong <= 0.0f)
+	{
+		simplex.m_numVertexes = 1;
+		SetSimplexVertex(simplex, 0, vertexA, 1.0f);
+	}
+	else if (fractionAlong >= 1.0f)
+	{
+		simplex.m_numVertexes = 1;
+		SetSimplexVertex(simplex, 0, vertexB, 1.0f);
+	}
+	else
+	{
+		simplex.m_weights[0] = 1.0f - fractionAlong;
+		simplex.m_weights[1] = fractionAlong;
+	}
+}
+
+
+//returns true if the closest point is inside the triangle rather than on an edge or corner
+static bool SolveTriangle(GJKSimplex& simplex)
+{
+	GJKVertex vertexA = simplex.m_vertexes[0];
+	GJKVertex vertexB = simplex.m_vertexes[1];
+	GJKVertex vertexC = simplex.m_vertexes[2];
+	Vec3 const& pointA = vertexA.m_point;
+	Vec3 const& pointB = vertexB.m_point;
+	Vec3 const& pointC = vertexC.m_point;
+	Vec3 dispAToB = pointB - pointA;
+	Vec3 dispAToC = pointC - pointA;
+
+	float dotABA = -DotProduct3D(dispAToB, pointA);
+	float dotACA = -DotProduct3D(dispAToC, pointA);
+	if (dotABA <= 0.0f && dotACA <= 0.0f)
+	{
+		simplex.m_numVertexes = 1;
+		SetSimplexVertex(simplex, 0, vertexA, 1.0f);
+		return false;
+	}
+
+	float dotABB = -DotProduct3D(dispAToB, pointB);
+	float dotACB = -DotProduct3D(dispAToC, pointB);
+	if (dotABB >= 0.0f && dotACB <= dotABB)
+	{
+		simplex.m_numVertexes = 1;
+		SetSimplexVertex(simplex, 0, vertexB, 1.0f);
+		return false;
+	}
+
+	float areaC = dotABA * dotACB - dotABB * dotACA;
+	if (areaC <= 0.0f && dotABA >= 0.0f && dotABB <= 0.0f)
+	{
+		float fractionAlong = dotABA / (dotABA - dotABB);
+		simplex.m_numVertexes = 2;
+		SetSimplexVertex(simplex, 0, vertexA, 1.0f - fractionAlong);
+		SetSimplexVertex(simplex, 1, vertexB, fractionAlong);
+		return false;
+	}
+
+	float dotABC = -DotProduct3D(dispAToB, pointC);
+	float dotACC = -DotProduct3D(dispAToC, pointC);
+	if (dotACC >= 0.0f && dotABC <= dotACC)
+	{
+		simplex.m_numVertexes = 1;
+		SetSimplexVertex(simplex, 0, vertexC, 1.0f);
+		return false;
+	}
+
+	float areaB = dotABC * dotACA - dotABA * dotACC;
+	if (areaB <= 0.0f && dotACA >= 0.0f && dotACC <= 0.0f)
+	{
+		float fractionAlong = dotACA / (dotACA - dotACC);
+		simplex.m_numVertexes = 2;
+		SetSimplexVertex(simplex, 0, vertexA, 1.0f - fractionAlong);
+		SetSimplexVertex(simplex, 1, vertexC, fractionAlong);
+		return false;
+	}
+
+	float areaA = dotABB * dotACC - dotABC * dotACB;
+	if (areaA <= 0.0f && (dotACB - dotABB) >= 0.0f && (dotABC - dotACC) >= 0.0f)
+	{
+		float fractionAlong = (dotACB - dotABB) / ((dotACB - dotABB) + (dotABC - dotACC));
+		simplex.m_numVertexes = 2;
+		SetSimplexVertex(simplex, 0, vertexB, 1.0f - fractionAlong);
+		SetSimplexVertex(simplex, 1, vertexC, fractionAlong);
+		return false;
+	}
+
+	//a flat triangle has no inside, drop the newest vertex and let GJK find a better one
+	float totalArea = areaA + areaB + areaC;
+	if (totalArea <= DEGENERATE_TOLERANCE * dispAToB.GetLengthSquared() * dispAToC.GetLengthSquared())
+	{
+		simplex.m_numVertexes = 2;
+		SolveSegment(simplex);
+		return false;
+	}
+
+	simplex.m_weights[0] = areaA / totalArea;
+	simplex.m_weights[1] = areaB / totalArea;
+	simplex.m_weights[2] = areaC / totalArea;
+	return true;
+}
+
+
+//returns true if the tetrahedron holds the origin
+static bool SolveTetrahedron(GJKSimplex& simplex)
+{
+	static int const FACE_VERTEXES[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };	//three corners, then the opposite corner
+
+	Vec3 const& pointA = simplex.m_vertexes[0].m_point;
+	Vec3 dispAToB = simplex.m_vertexes[1].m_point - pointA;
+	Vec3 dispAToC = simplex.m_vertexes[2].m_point - pointA;
+	Vec3 dispAToD = simplex.m_vertexes[3].m_point - pointA;
+	float volume = DotProduct3D(dispAToD, CrossProduct3D(dispAToB, dispAToC));
+	float volumeScale = dispAToB.GetLength() * dispAToC.GetLength() * dispAToD.GetLength();
+	bool isFlat = fabsf(volume) <= DEGENERATE_TOLERANCE * volumeScale;
+
+	//the closest point is on one of the faces the origin is outside of, a flat tetrahedron checks them all
+	GJKSimplex closestSimplex;
+	float closestDistSquared = FLT_MAX;
+	bool isOutsideAnyFace = false;
+	for (int faceIndex = 0; faceIndex < 4; faceIndex++)
+	{
+		Vec3 const& facePointA = simplex.m_vertexes[FACE_VERTEXES[faceIndex][0]].m_point;
+		Vec3 const& facePointB = simplex.m_vertexes[FACE_VERTEXES[faceIndex][1]].m_point;
+		Vec3 const& facePointC = simplex.m_vertexes[FACE_VERTEXES[faceIndex][2]].m_point;
+		Vec3 const& oppositePoint = simplex.m_vertexes[FACE_VERTEXES[faceIndex][3]].m_point;
+		Vec3 faceNormal = CrossProduct3D(facePointB - facePointA, facePointC - facePointA);
+		float originSide = -DotProduct3D(facePointA, faceNormal);
+		float oppositeSide = DotProduct3D(oppositePoint - facePointA, faceNormal);
+		if (!isFlat && originSide * oppositeSide >= 0.0f)
+		{
+			continue;
+		}
+
+		isOutsideAnyFace = true;
+		GJKSimplex faceSimplex;
+		faceSimplex.m_numVertexes = 3;
+		for (int cornerNumber = 0; cornerNumber < 3; cornerNumber++)
+		{
+			faceSimplex.m_vertexes[cornerNumber] = simplex.m_vertexes[FACE_VERTEXES[faceIndex][cornerNumber]];
+		}
+		SolveTriangle(faceSimplex);
+
+		float faceDistSquared = GetSimplexPoint(faceSimplex).GetLengthSquared();
+		if (faceDistSquared < closestDistSquared)
+		{
+			closestDistSquared = faceDistSquared;
+			closestSimplex = faceSimplex;
+		}
+	}
+
+	if (!isOutsideAnyFace)
+	{
+		//each corner's weight is the volume of the tetrahedron with that corner moved to the origin
+		for (int cornerNumber = 0; cornerNumber < 4; cornerNumber++)
+		{
+			Vec3 corners[4];
+			for (int otherNumber = 0; otherNumber < 4; otherNumber++)
+			{
+				corners[otherNumber] = (otherNumber == cornerNumber) ? Vec3() : simplex.m_vertexes[otherNumber].m_point;
+			}
+			float subVolume = DotProduct3D(corners[3] - corners[0], CrossProduct3D(corners[1] - corners[0], corners[2] - corners[0]));
+			simplex.m_weights[cornerNumber] = subVolume / volume;
+		}
+		return true;
+	}
+
+	simplex = closestSimplex;
+	return false;
+}
+
+
+//returns true if the simplex holds the origin
+static bool SolveSimplex(GJKSimplex& simplex, int maxSimplexVertexes)
+{
+	switch (simplex.m_numVertexes)
+	{
+		case 1:
+			simplex.m_weights[0] = 1.0f;
+			return false;
+		case 2:
+			SolveSegment(simplex);
+			return false;
+		case 3:
+			return SolveTriangle(simplex) && maxSimplexVertexes == 3;
+		default:
+			return SolveTetrahedron(simplex);
+	}
+}
+
+
+static bool IsVertexInSimplex(GJKSimplex const& simplex, GJKVertex const& vertex)
+{
+	for (int vertexNumber = 0; vertexNumber < simplex.m_numVertexes; vertexNumber++)
+	{
+		if (simplex.m_vertexes[vertexNumber].m_indexA == vertex.m_indexA && simplex.m_vertexes[vertexNumber].m_indexB == vertex.m_indexB)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+//a boolean query gives up as soon as some support point doesn't reach past the origin
+template <typename ConvexShapeType>
+static GJKState const RunGJK(ConvexShapeType const& shapeA, ConvexShapeType const& shapeB, int maxSimplexVertexes, GJKSimplexCache* simplexCache, bool isBooleanQuery)
+{
+	GJKState state;
+	GJKSimplex& simplex = state.m_simplex;
+	if (shapeA.GetNumVertexes() == 0 || shapeB.GetNumVertexes() == 0)
+	{
+		return state;
+	}
+
+	//warm start from the cached simplex if it still fits these shapes
+	if (simplexCache != nullptr && simplexCache->m_numVertexes > 0 && simplexCache->m_numVertexes <= maxSimplexVertexes)
+	{
+		for (int vertexNumber = 0; vertexNumber < simplexCache->m_numVertexes; vertexNumber++)
+		{
+			int indexA = simplexCache->m_indexesA[vertexNumber];
+			int indexB = simplexCache->m_indexesB[vertexNumber];
+			if (indexA < 0 || indexA >= shapeA.GetNumVertexes() || indexB < 0 || indexB >= shapeB.GetNumVertexes())
+			{
+				simplex.m_numVertexes = 0;
+				break;
+			}
+
+			simplex.m_vertexes[simplex.m_numVertexes] = MakeGJKVertex(shapeA, shapeB, indexA, indexB);
+			simplex.m_numVertexes++;
+		}
+	}
+	if (simplex.m_numVertexes == 0)
+	{
+		simplex.m_vertexes[0] = MakeGJKVertex(shapeA, shapeB, 0, 0);
+		simplex.m_numVertexes = 1;
+	}
+
+	for (state.m_numIterations = 0; state.m_numIterations < GJK_MAX_ITERATIONS; state.m_numIterations++)
+	{
+		if (SolveSimplex(simplex, maxSimplexVertexes))
+		{
+			state.m_isOverlapping = true;
+			break;
+		}
+
+		state.m_closestPoint = GetSimplexPoint(simplex);
+		float distSquared = state.m_closestPoint.GetLengthSquared();
+		if (distSquared <= GJK_OVERLAP_DISTANCE * GJK_OVERLAP_DISTANCE)
+		{
+			state.m_isOverlapping = true;
+			break;
+		}
+
+		GJKVertex supportVertex = GetSupportVertex(shapeA, shapeB, -state.m_closestPoint);
+		if (isBooleanQuery && DotProduct3D(supportVertex.m_point, state.m_closestPoint) > 0.0f)
+		{
+			break;
+		}
+		if (IsVertexInSimplex(simplex, supportVertex) || distSquared - DotProduct3D(supportVertex.m_point, state.m_closestPoint) <= GJK_RELATIVE_TOLERANCE * distSquared)
+		{
+			break;
+		}
+
+		simplex.m_vertexes[simplex.m_numVertexes] = supportVertex;
+		simplex.m_numVertexes++;
+	}
+
+	if (state.m_isOverlapping)
+	{
+		state.m_closestPoint = GetSimplexPoint(simplex);
+	}
+
+	if (simplexCache != nullptr)
+	{
+		simplexCache->m_numVertexes = simplex.m_numVertexes;
+		for (int vertexNumber = 0; vertexNumber < simplex.m_numVertexes; vertexNumber++)
+		{
+			simplexCache->m_indexesA[vertexNumber] = simplex.m_vertexes[vertexNumber].m_indexA;
+			simplexCache->m_indexesB[vertexNumber] = simplex.m_vertexes[vertexNumber].m_indexB;
+		}
+	}
+
+	return state;
+}
+
+
+static void GetSimplexClosestPoints(GJKSimplex const& simplex, Vec3& out_pointOnA, Vec3& out_pointOnB)
+{
+	out_pointOnA = Vec3();
+	out_pointOnB = Vec3();
+	for (int vertexNumber = 0; vertexNumber < simplex.m_numVertexes; vertexNumber++)
+	{
+		out_pointOnA += simplex.m_vertexes[vertexNumber].m_pointA * simplex.m_weights[vertexNumber];
+		out_pointOnB += simplex.m_vertexes[vertexNumber].m_pointB * simplex.m_weights[vertexNumber];
+	}
+}
+
+
+//adds a support point in one of the directions that isn't already in the simplex, returns false if none of them are new
+template <typename ConvexShapeType>
+static bool AddSupportVertexInAnyDirection(ConvexShapeType const& shapeA, ConvexShapeType const& shapeB, GJKSimplex& simplex, int numDirections, Vec3 const* directions,
+	Vec3 const& dispToCheck, float minDistAlongCheck)
+{
+	for (int directionIndex = 0; directionIndex < numDirections; directionIndex++)
+	{
+		GJKVertex supportVertex = GetSupportVertex(shapeA, shapeB, directions[directionIndex]);
+		Vec3 dispFromFirst = supportVertex.m_point - simplex.m_vertexes[0].m_point;
+		float distAlongCheck = (dispToCheck.GetLengthSquared() > 0.0f) ? fabsf(DotProduct3D(dispFromFirst, dispToCheck)) : dispFromFirst.GetLength();
+		if (distAlongCheck > minDistAlongCheck && !IsVertexInSimplex(simplex, supportVertex))
+		{
+			simplex.m_vertexes[simplex.m_numVertexes] = supportVertex;
+			simplex.m_numVertexes++;
+			return true;
+		}
+	}
+	return false;
+}
+
+
+//returns false for faces too thin to have a reliable normal, or facing away from the origin
+static bool MakeEPAFace(std::vector<GJKVertex> const& polytopeVertexes, int vertexA, int vertexB, int vertexC, EPAFace& out_face)
+{
+	out_face.m_vertexes[0] = vertexA;
+	out_face.m_vertexes[1] = vertexB;
+	out_face.m_vertexes[2] = vertexC;
+
+	Vec3 const& pointA = polytopeVertexes[vertexA].m_point;
+	Vec3 dispAToB = polytopeVertexes[vertexB].m_point - pointA;
+	Vec3 dispAToC = polytopeVertexes[vertexC].m_point - pointA;
+	out_face.m_normal = CrossProduct3D(dispAToB, dispAToC);
+	float normalLength = out_face.m_normal.GetLength();
+	if (normalLength <= DEGENERATE_TOLERANCE * dispAToB.GetLength() * dispAToC.GetLength() || normalLength == 0.0f)
+	{
+		out_face.m_distance = 0.0f;
+		return false;
+	}
+
+	out_face.m_normal /= normalLength;
+	out_face.m_distance = DotProduct3D(out_face.m_normal, pointA);
+	return out_face.m_distance >= -EPA_TOLERANCE;
+}
+
+
+static int GetClosestEPAFaceIndex(std::vector<EPAFace> const& faces)
+{
+	int closestFaceIndex = 0;
+	for (int faceIndex = 1; faceIndex < static_cast<int>(faces.size()); faceIndex++)
+	{
+		if (faces[faceIndex].m_distance < faces[closestFaceIndex].m_distance)
+		{
+			closestFaceIndex = faceIndex;
+		}
+	}
+	return closestFaceIndex;
+}
+
+
+//
+//GJK queries
+//
+GJKResult2D GetGJKDistance2D(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, GJKSimplexCache* simplexCache)
+{
+	GJKState state = RunGJK(shapeA, shapeB, 3, simplexCache, false);
+	Vec3 pointOnA;
+	Vec3 pointOnB;
+	GetSimplexClosestPoints(state.m_simplex, pointOnA, pointOnB);
+
+	GJKResult2D result;
+	result.m_isOverlapping = state.m_isOverlapping;
+	result.m_distance = state.m_isOverlapping ? 0.0f : state.m_closestPoint.GetLength();
+	result.m_closestPointOnA = Vec2(pointOnA.x, pointOnA.y);
+	result.m_closestPointOnB = Vec2(pointOnB.x, pointOnB.y);
+	result.m_numIterations = state.m_numIterations;
+	return result;
+}
+
+
+GJKResult3D GetGJKDistance3D(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, GJKSimplexCache* simplexCache)
+{
+	GJKState state = RunGJK(shapeA, shapeB, 4, simplexCache, false);
+
+	GJKResult3D result;
+	result.m_isOverlapping = state.m_isOverlapping;
+	result.m_distance = state.m_isOverlapping ? 0.0f : state.m_closestPoint.GetLength();
+	GetSimplexClosestPoints(state.m_simplex, result.m_closestPointOnA, result.m_closestPointOnB);
+	result.m_numIterations = state.m_numIterations;
+	return result;
+}
+
+
+bool DoConvexShapesOverlap2D(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, GJKSimplexCache* simplexCache)
+{
+	return RunGJK(shapeA, shapeB, 3, simplexCache, true).m_isOverlapping;
+}
+
+
+bool DoConvexShapesOverlap3D(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, GJKSimplexCache* simplexCache)
+{
+	return RunGJK(shapeA, shapeB, 4, simplexCache, true).m_isOverlapping;
+}
+
+
+//
+//EPA queries
+//
+PenetrationResult2D GetPenetrationEPA2D(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, GJKSimplexCache* simplexCache)
+{
+	GJKState state = RunGJK(shapeA, shapeB, 3, simplexCache, false);
+	GJKSimplex& simplex = state.m_simplex;
+	Vec3 pointOnA;
+	Vec3 pointOnB;
+	GetSimplexClosestPoints(simplex, pointOnA, pointOnB);
+
+	PenetrationResult2D result;
+	result.m_isOverlapping = state.m_isOverlapping;
+	result.m_contactPointOnA = Vec2(pointOnA.x, pointOnA.y);
+	result.m_contactPointOnB = Vec2(pointOnB.x, pointOnB.y);
+	if (!state.m_isOverlapping)
+	{
+		result.m_depth = -state.m_closestPoint.GetLength();
+		result.m_normal = (result.m_contactPointOnB - result.m_contactPointOnA).GetNormalized();
+		return result;
+	}
+	if (simplex.m_numVertexes == 0)
+	{
+		return result;
+	}
+
+	//GJK stops early when the shapes only touch, grow its simplex into a triangle first
+	Vec3 const axisDirections[4] = { Vec3(1.0f, 0.0f, 0.0f), Vec3(-1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, -1.0f, 0.0f) };
+	if (simplex.m_numVertexes == 1)
+	{
+		AddSupportVertexInAnyDirection(shapeA, shapeB, simplex, 4, axisDirections, Vec3(), DEGENERATE_TOLERANCE);
+	}
+	if (simplex.m_numVertexes == 2)
+	{
+		Vec3 dispAToB = simplex.m_vertexes[1].m_point - simplex.m_vertexes[0].m_point;
+		Vec3 segmentNormal = Vec3(-dispAToB.y, dispAToB.x, 0.0f).GetNormalized();
+		Vec3 const normalDirections[2] = { segmentNormal, -segmentNormal };
+		AddSupportVertexInAnyDirection(shapeA, shapeB, simplex, 2, normalDirections, segmentNormal, DEGENERATE_TOLERANCE);
+	}
+	if (simplex.m_numVertexes < 3)
+	{
+		//the difference of the shapes is flat, they only touch
+		result.m_normal = (shapeB.GetPosition() - shapeA.GetPosition()).GetNormalized();
+		return result;
+	}
+
+	std::vector<GJKVertex> polygon(simplex.m_vertexes, simplex.m_vertexes + 3);
+	if (CrossProduct2D(Vec2(polygon[1].m_point.x - polygon[0].m_point.x, polygon[1].m_point.y - polygon[0].m_point.y),
+		Vec2(polygon[2].m_point.x - polygon[0].m_point.x, polygon[2].m_point.y - polygon[0].m_point.y)) < 0.0f)
+	{
+		std::swap(polygon[1], polygon[2]);
+	}
+
+	std::vector<GJKVertex> expandedPolygon;
+	std::vector<bool> isEdgeVisible;
+	int closestEdgeIndex = 0;
+	Vec2 closestEdgeNormal;
+	float closestEdgeDist = 0.0f;
+	for (int iterationIndex = 0; iterationIndex < EPA_MAX_ITERATIONS; iterationIndex++)
+	{
+		//counterclockwise edges face out to their right
+		int numEdges = static_cast<int>(polygon.size());
+		closestEdgeDist = FLT_MAX;
+		for (int edgeIndex = 0; edgeIndex < numEdges; edgeIndex++)
+		{
+			Vec3 const& edgeStart = polygon[edgeIndex].m_point;
+			Vec3 const& edgeEnd = polygon[(edgeIndex + 1) % numEdges].m_point;
+			Vec2 edgeNormal = Vec2(edgeEnd.y - edgeStart.y, edgeStart.x - edgeEnd.x).GetNormalized();
+			float edgeDist = DotProduct2D(edgeNormal, Vec2(edgeStart.x, edgeStart.y));
+			if (edgeDist < closestEdgeDist)
+			{
+				closestEdgeIndex = edgeIndex;
+				closestEdgeNormal = edgeNormal;
+				closestEdgeDist = edgeDist;
+			}
+		}
+
+		GJKVertex supportVertex = GetSupportVertex(shapeA, shapeB, Vec3(closestEdgeNormal, 0.0f));
+		float supportDist = DotProduct2D(closestEdgeNormal, Vec2(supportVertex.m_point.x, supportVertex.m_point.y));
+		if (supportDist - closestEdgeDist <= EPA_TOLERANCE * (1.0f + closestEdgeDist))
+		{
+			break;
+		}
+
+		bool isDuplicate = false;
+		for (int vertexIndex = 0; vertexIndex < numEdges && !isDuplicate; vertexIndex++)
+		{
+			isDuplicate = polygon[vertexIndex].m_indexA == supportVertex.m_indexA && polygon[vertexIndex].m_indexB == supportVertex.m_indexB;
+		}
+		if (isDuplicate)
+		{
+			break;
+		}
+
+		//GJK's vertexes aren't always on the boundary, so replace every edge the new point can see rather than just the closest one
+		Vec2 supportPoint = Vec2(supportVertex.m_point.x, supportVertex.m_point.y);
+		isEdgeVisible.resize(numEdges);
+		for (int edgeIndex = 0; edgeIndex < numEdges; edgeIndex++)
+		{
+			Vec3 const& edgeStart = polygon[edgeIndex].m_point;
+			Vec3 const& edgeEnd = polygon[(edgeIndex + 1) % numEdges].m_point;
+			isEdgeVisible[edgeIndex] = CrossProduct2D(Vec2(edgeEnd.x - edgeStart.x, edgeEnd.y - edgeStart.y), supportPoint - Vec2(edgeStart.x, edgeStart.y)) < 0.0f;
+		}
+		isEdgeVisible[closestEdgeIndex] = true;
+
+		expandedPolygon.clear();
+		for (int vertexIndex = 0; vertexIndex < numEdges; vertexIndex++)
+		{
+			bool isIncomingEdgeVisible = isEdgeVisible[(vertexIndex + numEdges - 1) % numEdges];
+			if (!isIncomingEdgeVisible || !isEdgeVisible[vertexIndex])
+			{
+				expandedPolygon.push_back(polygon[vertexIndex]);
+			}
+			if (!isIncomingEdgeVisible && isEdgeVisible[vertexIndex])
+			{
+				expandedPolygon.push_back(supportVertex);
+			}
+		}
+		polygon.swap(expandedPolygon);
+	}
+
+	GJKVertex const& edgeStart = polygon[closestEdgeIndex];
+	GJKVertex const& edgeEnd = polygon[(closestEdgeIndex + 1) % static_cast<int>(polygon.size())];
+	Vec3 edgeDisp = edgeEnd.m_point - edgeStart.m_point;
+	float edgeLengthSquared = edgeDisp.GetLengthSquared();
+	float fractionAlong = (edgeLengthSquared > 0.0f) ? -DotProduct3D(edgeStart.m_point, edgeDisp) / edgeLengthSquared : 0.0f;
+	fractionAlong = GetClamped(fractionAlong, 0.0f, 1.0f);
+	Vec3 contactOnA = edgeStart.m_pointA + (edgeEnd.m_pointA - edgeStart.m_pointA) * fractionAlong;
+	Vec3 contactOnB = edgeStart.m_pointB + (edgeEnd.m_pointB - edgeStart.m_pointB) * fractionAlong;
+
+	result.m_depth = (closestEdgeDist > 0.0f) ? closestEdgeDist : 0.0f;
+	result.m_normal = closestEdgeNormal;
+	result.m_contactPointOnA = Vec2(contactOnA.x, contactOnA.y);
+	result.m_contactPointOnB = Vec2(contactOnB.x, contactOnB.y);
+	return result;
+}
+
+
+PenetrationResult3D GetPenetrationEPA3D(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, GJKSimplexCache* simplexCache)
+{
+	GJKState state = RunGJK(shapeA, shapeB, 4, simplexCache, false);
+	GJKSimplex& simplex = state.m_simplex;
+
+	PenetrationResult3D result;
+	result.m_isOverlapping = state.m_isOverlapping;
+	GetSimplexClosestPoints(simplex, result.m_contactPointOnA, result.m_contactPointOnB);
+	if (!state.m_isOverlapping)
+	{
+		result.m_depth = -state.m_closestPoint.GetLength();
+		result.m_normal = (result.m_contactPointOnB - result.m_contactPointOnA).GetNormalized();
+		return result;
+	}
+	if (simplex.m_numVertexes == 0)
+	{
+		return result;
+	}
+
+	//GJK stops early when the shapes only touch, grow its simplex into a tetrahedron first
+	if (simplex.m_numVertexes == 1)
+	{
+		Vec3 const axisDirections[6] = { Vec3(1.0f, 0.0f, 0.0f), Vec3(-1.0f, 0.0f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.0f, -1.0f, 0.0f), Vec3(0.0f, 0.0f, 1.0f), Vec3(0.0f, 0.0f, -1.0f) };
+		AddSupportVertexInAnyDirection(shapeA, shapeB, simplex, 6, axisDirections, Vec3(), DEGENERATE_TOLERANCE);
+	}
+	if (simplex.m_numVertexes == 2)
+	{
+		Vec3 segmentDirection = (simplex.m_vertexes[1].m_point - simplex.m_vertexes[0].m_point).GetNormalized();
+		Vec3 leastAlignedAxis = (fabsf(segmentDirection.x) < 0.57f) ? Vec3(1.0f, 0.0f, 0.0f) : Vec3(0.0f, 1.0f, 0.0f);
+		Vec3 firstNormal = CrossProduct3D(segmentDirection, leastAlignedAxis).GetNormalized();
+		Vec3 secondNormal = CrossProduct3D(segmentDirection, firstNormal);
+		Vec3 const normalDirections[4] = { firstNormal, -firstNormal, secondNormal, -secondNormal };
+		for (int directionIndex = 0; directionIndex < 4 && simplex.m_numVertexes == 2; directionIndex++)
+		{
+			AddSupportVertexInAnyDirection(shapeA, shapeB, simplex, 1, &normalDirections[directionIndex], normalDirections[directionIndex], DEGENERATE_TOLERANCE);
+		}
+	}
+	if (simplex.m_numVertexes == 3)
+	{
+		Vec3 triangleNormal = CrossProduct3D(simplex.m_vertexes[1].m_point - simplex.m_vertexes[0].m_point, simplex.m_vertexes[2].m_point - simplex.m_vertexes[0].m_point).GetNormalized();
+		Vec3 const normalDirections[2] = { triangleNormal, -triangleNormal };
+		AddSupportVertexInAnyDirection(shapeA, shapeB, simplex, 2, normalDirections, triangleNormal, DEGENERATE_TOLERANCE);
+	}
+	if (simplex.m_numVertexes < 4)
+	{
+		//the difference of the shapes is flat, they only touch
+		result.m_normal = (shapeB.GetTransform().GetTranslation3D() - shapeA.GetTransform().GetTranslation3D()).GetNormalized();
+		return result;
+	}
+
+	std::vector<GJKVertex> polytopeVertexes(simplex.m_vertexes, simplex.m_vertexes + 4);
+	std::vector<EPAFace> faces;
+	faces.reserve(64);
+
+	//wind every face of the tetrahedron to face away from the opposite corner
+	static int const TETRAHEDRON_FACES[4][4] = { { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 } };
+	for (int faceIndex = 0; faceIndex < 4; faceIndex++)
+	{
+		int const* faceVertexes = TETRAHEDRON_FACES[faceIndex];
+		Vec3 const& pointA = polytopeVertexes[faceVertexes[0]].m_point;
+		Vec3 faceNormal = CrossProduct3D(polytopeVertexes[faceVertexes[1]].m_point - pointA, polytopeVertexes[faceVertexes[2]].m_point - pointA);
+		bool isFacingOpposite = DotProduct3D(faceNormal, polytopeVertexes[faceVertexes[3]].m_point - pointA) > 0.0f;
+
+		EPAFace face;
+		MakeEPAFace(polytopeVertexes, faceVertexes[0], isFacingOpposite ? faceVertexes[2] : faceVertexes[1], isFacingOpposite ? faceVertexes[1] : faceVertexes[2], face);
+		faces.push_back(face);
+	}
+
+	std::vector<EPAFace> expandedFaces;
+	std::vector<int> horizonEdges;
+	expandedFaces.reserve(64);
+	horizonEdges.reserve(32);
+	for (int iterationIndex = 0; iterationIndex < EPA_MAX_ITERATIONS; iterationIndex++)
+	{
+		EPAFace const& closestFace = faces[GetClosestEPAFaceIndex(faces)];
+		GJKVertex supportVertex = GetSupportVertex(shapeA, shapeB, closestFace.m_normal);
+		float supportDist = DotProduct3D(closestFace.m_normal, supportVertex.m_point);
+		if (supportDist - closestFace.m_distance <= EPA_TOLERANCE * (1.0f + closestFace.m_distance))
+		{
+			break;
+		}
+
+		bool isDuplicate = false;
+		for (int vertexIndex = 0; vertexIndex < static_cast<int>(polytopeVertexes.size()) && !isDuplicate; vertexIndex++)
+		{
+			isDuplicate = polytopeVertexes[vertexIndex].m_indexA == supportVertex.m_indexA && polytopeVertexes[vertexIndex].m_indexB == supportVertex.m_indexB;
+		}
+		if (isDuplicate)
+		{
+			break;
+		}
+
+		//replace every face the new point can see, the edges left open between seen and unseen faces form the horizon
+		int newVertexIndex = static_cast<int>(polytopeVertexes.size());
+		polytopeVertexes.push_back(supportVertex);
+		expandedFaces.clear();
+		horizonEdges.clear();
+		for (int faceIndex = 0; faceIndex < static_cast<int>(faces.size()); faceIndex++)
+		{
+			EPAFace const& face = faces[faceIndex];
+			if (DotProduct3D(face.m_normal, supportVertex.m_point - polytopeVertexes[face.m_vertexes[0]].m_point) <= 0.0f)
+			{
+				expandedFaces.push_back(face);
+				continue;
+			}
+
+			for (int edgeNumber = 0; edgeNumber < 3; edgeNumber++)
+			{
+				int edgeStart = face.m_vertexes[edgeNumber];
+				int edgeEnd = face.m_vertexes[(edgeNumber + 1) % 3];
+
+				//an edge shared with another seen face shows up again reversed, so it isn't on the horizon
+				bool wasShared = false;
+				for (int edgeIndex = 0; edgeIndex < static_cast<int>(horizonEdges.size()); edgeIndex += 2)
+				{
+					if (horizonEdges[edgeIndex] == edgeEnd && horizonEdges[edgeIndex + 1] == edgeStart)
+					{
+						horizonEdges.erase(horizonEdges.begin() + edgeIndex, horizonEdges.begin() + edgeIndex + 2);
+						wasShared = true;
+						break;
+					}
+				}
+				if (!wasShared)
+				{
+					horizonEdges.push_back(edgeStart);
+					horizonEdges.push_back(edgeEnd);
+				}
+			}
+		}
+
+		//a new point nearly in line with a horizon edge makes a sliver face that would break the polytope, keep what we have instead
+		bool isExpansionValid = !horizonEdges.empty();
+		for (int edgeIndex = 0; edgeIndex < static_cast<int>(horizonEdges.size()) && isExpansionValid; edgeIndex += 2)
+		{
+			EPAFace newFace;
+			isExpansionValid = MakeEPAFace(polytopeVertexes, horizonEdges[edgeIndex], horizonEdges[edgeIndex + 1], newVertexIndex, newFace);
+			expandedFaces.push_back(newFace);
+		}
+		if (!isExpansionValid)
+		{
+			break;
+		}
+
+		faces.swap(expandedFaces);
+	}
+
+	//the contact is where the origin projects onto the closest face
+	//flat spots get split into several triangles, so if the projection misses the closest one use whichever piece of the same flat spot it lands in
+	int closestFaceIndex = GetClosestEPAFaceIndex(faces);
+	EPAFace const& closestFace = faces[closestFaceIndex];
+	float maxCoplanarFaceDist = closestFace.m_distance + EPA_TOLERANCE * (1.0f + fabsf(closestFace.m_distance));
+	GJKSimplex contactSimplex;
+	for (int faceNumber = -1; faceNumber < static_cast<int>(faces.size()); faceNumber++)
+	{
+		int faceIndex = (faceNumber < 0) ? closestFaceIndex : faceNumber;
+		EPAFace const& face = faces[faceIndex];
+		if (faceNumber >= 0 && (faceIndex == closestFaceIndex || face.m_distance > maxCoplanarFaceDist || DotProduct3D(face.m_normal, closestFace.m_normal) < 1.0f - EPA_TOLERANCE))
+		{
+			continue;
+		}
+
+		GJKSimplex faceSimplex;
+		faceSimplex.m_numVertexes = 3;
+		for (int cornerNumber = 0; cornerNumber < 3; cornerNumber++)
+		{
+			faceSimplex.m_vertexes[cornerNumber] = polytopeVertexes[face.m_vertexes[cornerNumber]];
+			faceSimplex.m_vertexes[cornerNumber].m_point -= face.m_normal * face.m_distance;
+		}
+
+		bool isInsideFace = SolveTriangle(faceSimplex);
+		if (faceNumber < 0 || isInsideFace)
+		{
+			contactSimplex = faceSimplex;
+		}
+		if (isInsideFace)
+		{
+			break;
+		}
+	}
+	GetSimplexClosestPoints(contactSimplex, result.m_contactPointOnA, result.m_contactPointOnB);
+
+	result.m_depth = (closestFace.m_distance > 0.0f) ? closestFace.m_distance : 0.0f;
+	result.m_normal = closestFace.m_normal;
+	return result;
+}
@@ -0,0 +1,76 @@
+#pragma once
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+
+//forward declarations
+class ConvexShape2D;
+class ConvexShape3D;
+
+
+//structs
+//keep one per shape pair across frames and GJK starts from last frame's simplex, which usually needs only a step or two for coherent contacts
+struct GJKSimplexCache
+{
+//public member variables
+public:
+	int	m_numVertexes = 0;		//0 means nothing cached yet
+	int	m_indexesA[4] = {};
+	int	m_indexesB[4] = {};
+};
+
+struct GJKResult2D
+{
+//public member variables
+public:
+	bool	m_isOverlapping = false;
+	float	m_distance = 0.0f;
+	Vec2	m_closestPointOnA = Vec2(0.0f, 0.0f);
+	Vec2	m_closestPointOnB = Vec2(0.0f, 0.0f);
+	int		m_numIterations = 0;
+};
+
+struct GJKResult3D
+{
+//public member variables
+public:
+	bool	m_isOverlapping = false;
+	float	m_distance = 0.0f;
+	Vec3	m_closestPointOnA = Vec3();
+	Vec3	m_closestPointOnB = Vec3();
+	int		m_numIterations = 0;
+};
+
+//when the shapes don't overlap the depth is minus the distance between them and the contact points are the closest points
+struct PenetrationResult2D
+{
+//public member variables
+public:
+	bool	m_isOverlapping = false;
+	float	m_depth = 0.0f;
+	Vec2	m_normal = Vec2(0.0f, 0.0f);				//from A to B, move B this far along it (or A against it) to separate them
+	Vec2	m_contactPointOnA = Vec2(0.0f, 0.0f);		//deepest point of A inside B
+	Vec2	m_contactPointOnB = Vec2(0.0f, 0.0f);		//deepest point of B inside A
+};
+
+struct PenetrationResult3D
+{
+//public member variables
+public:
+	bool	m_isOverlapping = false;
+	float	m_depth = 0.0f;
+	Vec3	m_normal = Vec3();
+	Vec3	m_contactPointOnA = Vec3();
+	Vec3	m_contactPointOnB = Vec3();
+};
+
+
+//GJK distance and overlap queries, the cache is optional
+GJKResult2D GetGJKDistance2D(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, GJKSimplexCache* simplexCache = nullptr);
+GJKResult3D GetGJKDistance3D(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, GJKSimplexCache* simplexCache = nullptr);
+bool DoConvexShapesOverlap2D(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, GJKSimplexCache* simplexCache = nullptr);	//stops at the first separating direction
+bool DoConvexShapesOverlap3D(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, GJKSimplexCache* simplexCache = nullptr);
+
+//EPA penetration, runs GJK first and expands its simplex when the shapes overlap
+PenetrationResult2D GetPenetrationEPA2D(ConvexShape2D const& shapeA, ConvexShape2D const& shapeB, GJKSimplexCache* simplexCache = nullptr);
+PenetrationResult3D GetPenetrationEPA3D(ConvexShape3D const& shapeA, ConvexShape3D const& shapeB, GJKSimplexCache* simplexCache = nullptr);
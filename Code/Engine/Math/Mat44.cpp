@@ -1,812 +1,1416 @@
-#include "Engine/Math/Mat44.hpp"
-#include "Engine/Math/Vec2.hpp"
-#include "Engine/Math/Vec3.hpp"
-#include "Engine/Math/Vec4.hpp"
-#include "Engine/Math/MathUtils.hpp"
-#include "Engine/Math/Quaternion.hpp"
-#include <math.h>
-
-
-//
-//constructors
-//
-Mat44::Mat44()
-{
-	//default constructor makes identity matrix
-	m_values[Ix] = 1.0f;
-	m_values[Iy] = 0.0f;
-	m_values[Iz] = 0.0f;
-	m_values[Iw] = 0.0f;
-
-	m_values[Jx] = 0.0f;
-	m_values[Jy] = 1.0f;
-	m_values[Jz] = 0.0f;
-	m_values[Jw] = 0.0f;
-
-	m_values[Kx] = 0.0f;
-	m_values[Ky] = 0.0f;
-	m_values[Kz] = 1.0f;
-	m_values[Kw] = 0.0f;
-
-	m_values[Tx] = 0.0f;
-	m_values[Ty] = 0.0f;
-	m_values[Tz] = 0.0f;
-	m_values[Tw] = 1.0f;
-}
-
-
-Mat44::Mat44(Vec2 const& iBasis2D, Vec2 const& jBasis2D, Vec2 const& translation2D)
-{
-	m_values[Ix] = iBasis2D.x;
-	m_values[Iy] = iBasis2D.y;
-	m_values[Iz] = 0.0f;
-	m_values[Iw] = 0.0f;
-
-	m_values[Jx] = jBasis2D.x;
-	m_values[Jy] = jBasis2D.y;
-	m_values[Jz] = 0.0f;
-	m_values[Jw] = 0.0f;
-
-	m_values[Kx] = 0.0f;
-	m_values[Ky] = 0.0f;
-	m_values[Kz] = 1.0f;
-	m_values[Kw] = 0.0f;
-
-	m_values[Tx] = translation2D.x;
-	m_values[Ty] = translation2D.y;
-	m_values[Tz] = 0.0f;
-	m_values[Tw] = 1.0f;
-}
-
-
-Mat44::Mat44(Vec3 const& iBasis3D, Vec3 const& jBasis3D, Vec3 const& kBasis3D, Vec3 const& translation3D)
-{
-	m_values[Ix] = iBasis3D.x;
-	m_values[Iy] = iBasis3D.y;
-	m_values[Iz] = iBasis3D.z;
-	m_values[Iw] = 0.0f;
-
-	m_values[Jx] = jBasis3D.x;
-	m_values[Jy] = jBasis3D.y;
-	m_values[Jz] = jBasis3D.z;
-	m_values[Jw] = 0.0f;
-
-	m_values[Kx] = kBasis3D.x;
-	m_values[Ky] = kBasis3D.y;
-	m_values[Kz] = kBasis3D.z;
-	m_values[Kw] = 0.0f;
-
-	m_values[Tx] = translation3D.x;
-	m_values[Ty] = translation3D.y;
-	m_values[Tz] = translation3D.z;
-	m_values[Tw] = 1.0f;
-}
-
-
-Mat44::Mat44(Vec4 const& iBasis4D, Vec4 const& jBasis4D, Vec4 const& kBasis4D, Vec4 const& translation4D)
-{
-	m_values[Ix] = iBasis4D.x;
-	m_values[Iy] = iBasis4D.y;
-	m_values[Iz] = iBasis4D.z;
-	m_values[Iw] = iBasis4D.w;
-
-	m_values[Jx] = jBasis4D.x;
-	m_values[Jy] = jBasis4D.y;
-	m_values[Jz] = jBasis4D.z;
-	m_values[Jw] = jBasis4D.w;
-
-	m_values[Kx] = kBasis4D.x;
-	m_values[Ky] = kBasis4D.y;
-	m_values[Kz] = kBasis4D.z;
-	m_values[Kw] = kBasis4D.w;
-
-	m_values[Tx] = translation4D.x;
-	m_values[Ty] = translation4D.y;
-	m_values[Tz] = translation4D.z;
-	m_values[Tw] = translation4D.w;
-}
-
-
-Mat44::Mat44(float const* sixteenValuesBasisMajor)
-{
-	m_values[Ix] = sixteenValuesBasisMajor[0];
-	m_values[Iy] = sixteenValuesBasisMajor[1];
-	m_values[Iz] = sixteenValuesBasisMajor[2];
-	m_values[Iw] = sixteenValuesBasisMajor[3];
-
-	m_values[Jx] = sixteenValuesBasisMajor[4];
-	m_values[Jy] = sixteenValuesBasisMajor[5];
-	m_values[Jz] = sixteenValuesBasisMajor[6];
-	m_values[Jw] = sixteenValuesBasisMajor[7];
-
-	m_values[Kx] = sixteenValuesBasisMajor[8];
-	m_values[Ky] = sixteenValuesBasisMajor[9];
-	m_values[Kz] = sixteenValuesBasisMajor[10];
-	m_values[Kw] = sixteenValuesBasisMajor[11];
-
-	m_values[Tx] = sixteenValuesBasisMajor[12];
-	m_values[Ty] = sixteenValuesBasisMajor[13];
-	m_values[Tz] = sixteenValuesBasisMajor[14];
-	m_values[Tw] = sixteenValuesBasisMajor[15];
-}
-
-
-//
-//static creation functions
-//
-Mat44 const Mat44::CreateTranslation2D(Vec2 const& translationXY)
-{
-	Mat44 trans; //trans rights!
-	trans.m_values[Tx] = translationXY.x;
-	trans.m_values[Ty] = translationXY.y;
-	return trans;
-}
-
-
-Mat44 const Mat44::CreateTranslation3D(Vec3 const& translationXYZ)
-{
-	Mat44 trans;
-	trans.m_values[Tx] = translationXYZ.x;
-	trans.m_values[Ty] = translationXYZ.y;
-	trans.m_values[Tz] = translationXYZ.z;
-	return trans;
-}
-
-
-Mat44 const Mat44::CreateUniformScale2D(float uniformScaleXY)
-{
-	Mat44 scale;
-	scale.m_values[Ix] = uniformScaleXY;
-	scale.m_values[Jy] = uniformScaleXY;
-	return scale;
-}
-
-
-Mat44 const Mat44::CreateUniformScale3D(float uniformScaleXYZ)
-{
-	Mat44 scale;
-	scale.m_values[Ix] = uniformScaleXYZ;
-	scale.m_values[Jy] = uniformScaleXYZ;
-	scale.m_values[Kz] = uniformScaleXYZ;
-	return scale;
-}
-
-
-Mat44 const Mat44::CreateNonUniformScale2D(Vec2 const& nonUniformScaleXY)
-{
-	Mat44 scale;
-	scale.m_values[Ix] = nonUniformScaleXY.x;
-	scale.m_values[Jy] = nonUniformScaleXY.y;
-	return scale;
-}
-
-
-Mat44 const Mat44::CreateNonUniformScale3D(Vec3 const& nonUniformScaleXYZ)
-{
-	Mat44 scale;
-	scale.m_values[Ix] = nonUniformScaleXYZ.x;
-	scale.m_values[Jy] = nonUniformScaleXYZ.y;
-	scale.m_values[Kz] = nonUniformScaleXYZ.z;
-	return scale;
-}
-
-
-Mat44 const Mat44::CreateZRotationDegrees(float rotationDegreesAboutZ)
-{
-	Mat44 rotate;
-	float c = CosDegrees(rotationDegreesAboutZ);
-	float s = SinDegrees(rotationDegreesAboutZ);
-	rotate.m_values[Ix] = c;
-	rotate.m_values[Iy] = s;
-	rotate.m_values[Jx] = -s;
-	rotate.m_values[Jy] = c;
-	return rotate;
-}
-
-
-Mat44 const Mat44::CreateYRotationDegrees(float rotationDegreesAboutY)
-{
-	Mat44 rotate;
-	float c = CosDegrees(rotationDegreesAboutY);
-	float s = SinDegrees(rotationDegreesAboutY);
-	rotate.m_values[Ix] = c;
-	rotate.m_values[Iz] = -s;
-	rotate.m_values[Kx] = s;
-	rotate.m_values[Kz] = c;
-	return rotate;
-}
-
-
-Mat44 const Mat44::CreateXRotationDegrees(float rotationDegreesAboutX)
-{
-	Mat44 rotate;
-	float c = CosDegrees(rotationDegreesAboutX);
-	float s = SinDegrees(rotationDegreesAboutX);
-	rotate.m_values[Jy] = c;
-	rotate.m_values[Jz] = s;
-	rotate.m_values[Ky] = -s;
-	rotate.m_values[Kz] = c;
-	return rotate;
-}
-
-
-Mat44 const Mat44::CreateOrthoProjection(float left, float right, float bottom, float top, float zNear, float zFar)
-{
-	Mat44 orthoProjection;
-
-	orthoProjection.m_values[Ix] = 2 / (right - left);
-	orthoProjection.m_values[Tx] = (left + right) / (left - right);
-
-	orthoProjection.m_values[Jy] = 2 / (top - bottom);
-	orthoProjection.m_values[Ty] = (bottom + top) / (bottom - top);
-
-	orthoProjection.m_values[Kz] = 1 / (zFar - zNear);
-	orthoProjection.m_values[Tz] = -zNear / (zFar - zNear);
-
-	return orthoProjection;
-}
-
-
-Mat44 const Mat44::CreatePerspectiveProjection(float fovYDegrees, float aspect, float zNear, float zFar)
-{
-	Mat44 perspectiveProjection;
-
-	float inverseTanFovDegrees = 1.0f / TanDegrees(fovYDegrees * 0.5f);
-
-	perspectiveProjection.m_values[Ix] = inverseTanFovDegrees / aspect;
-	perspectiveProjection.m_values[Jy] = inverseTanFovDegrees;
-	perspectiveProjection.m_values[Kz] = zFar / (zFar - zNear);
-	perspectiveProjection.m_values[Tz] = -(zFar * zNear) / (zFar - zNear);
-	perspectiveProjection.m_values[Kw] = 1.0f;
-	perspectiveProjection.m_values[Tw] = 0.0f;
-
-	return perspectiveProjection;
-}
-
-
-//
-//transform functions
-//
-Vec2 const Mat44::TransformVectorQuantity2D(Vec2 const& vectorQuantityXY) const
-{
-	float newX = m_values[Ix] * vectorQuantityXY.x + m_values[Jx] * vectorQuantityXY.y;
-	float newY = m_values[Iy] * vectorQuantityXY.x + m_values[Jy] * vectorQuantityXY.y;
-
-	return Vec2(newX, newY);
-}
-
-
-Vec3 const Mat44::TransformVectorQuantity3D(Vec3 const& vectorQuantityXYZ) const
-{
-	float newX = m_values[Ix] * vectorQuantityXYZ.x + m_values[Jx] * vectorQuantityXYZ.y + m_values[Kx] * vectorQuantityXYZ.z;
-	float newY = m_values[Iy] * vectorQuantityXYZ.x + m_values[Jy] * vectorQuantityXYZ.y + m_values[Ky] * vectorQuantityXYZ.z;
-	float newZ = m_values[Iz] * vectorQuantityXYZ.x + m_values[Jz] * vectorQuantityXYZ.y + m_values[Kz] * vectorQuantityXYZ.z;
-
-	return Vec3(newX, newY, newZ);
-}
-
-
-Vec2 const Mat44::TransformPosition2D(Vec2 const& positionXY) const
-{
-	float newX = m_values[Ix] * positionXY.x + m_values[Jx] * positionXY.y + m_values[Tx];
-	float newY = m_values[Iy] * positionXY.x + m_values[Jy] * positionXY.y + m_values[Ty];
-
-	return Vec2(newX, newY);
-}
-
-
-Vec3 const Mat44::TransformPosition3D(Vec3 const& positionXYZ) const
-{
-	float newX = m_values[Ix] * positionXYZ.x + m_values[Jx] * positionXYZ.y + m_values[Kx] * positionXYZ.z + m_values[Tx];
-	float newY = m_values[Iy] * positionXYZ.x + m_values[Jy] * positionXYZ.y + m_values[Ky] * positionXYZ.z + m_values[Ty];
-	float newZ = m_values[Iz] * positionXYZ.x + m_values[Jz] * positionXYZ.y + m_values[Kz] * positionXYZ.z + m_values[Tz];
-
-	return Vec3(newX, newY, newZ);
-}
-
-
-Vec4 const Mat44::TransformHomogeneous3D(Vec4 const& homogeneousPoint3D) const
-{
-	float newX = m_values[Ix] * homogeneousPoint3D.x + m_values[Jx] * homogeneousPoint3D.y + m_values[Kx] * homogeneousPoint3D.z + m_values[Tx] * homogeneousPoint3D.w;
-	float newY = m_values[Iy] * homogeneousPoint3D.x + m_values[Jy] * homogeneousPoint3D.y + m_values[Ky] * homogeneousPoint3D.z + m_values[Ty] * homogeneousPoint3D.w;
-	float newZ = m_values[Iz] * homogeneousPoint3D.x + m_values[Jz] * homogeneousPoint3D.y + m_values[Kz] * homogeneousPoint3D.z + m_values[Tz] * homogeneousPoint3D.w;
-	float newW = m_values[Iw] * homogeneousPoint3D.x + m_values[Jw] * homogeneousPoint3D.y + m_values[Kw] * homogeneousPoint3D.z + m_values[Tw] * homogeneousPoint3D.w;
-
-	return Vec4(newX, newY, newZ, newW);
-}
-
-
-//
-//accessors
-//
-float* Mat44::GetAsFloatArray()
-{
-	return m_values;
-}
-
-
-float const* Mat44::GetAsFloatArray() const
-{
-	return m_values;
-}
-
-
-Quaternion const Mat44::GetAsQuaternion() const
-{
-	Quaternion quat = Quaternion();
-	float t = 0.0f;
-
-	if (m_values[Kz] < 0.0f)
-	{
-		if (m_values[Ix] > m_values[Jy])
-		{
-			t = 1 + m_values[Ix] - m_values[Jy] - m_values[Kz];
-			quat = Quaternion(t, m_values[Iy] + m_values[Jx], m_values[Kx] + m_values[Iz], m_values[Jz] - m_values[Ky]);
-		}
-		else
-		{
-			t = 1 - m_values[Ix] + m_values[Jy] - m_values[Kz];
-			quat = Quaternion(m_values[Iy] + m_values[Jx], t, m_values[Jz] + m_values[Ky], m_values[Kx] - m_values[Iz]);
-		}
-	}
-	else
-	{
-		if (m_values[Ix] < -m_values[Jy])
-		{
-			t = 1 - m_values[Ix] - m_values[Jy] + m_values[Kz];
-			quat = Quaternion(m_values[Kx] + m_values[Iz], m_values[Jz] + m_values[Ky], t, m_values[Iy] - m_values[Jx]);
-		}
-		else
-		{
-			t = 1 + m_values[Ix] + m_values[Jy] + m_values[Kz];
-			quat = Quaternion(m_values[Jz] - m_values[Ky], m_values[Kx] - m_values[Iz], m_values[Iy] - m_values[Jx], t);
-		}
-	}
-
-	quat *= (0.5f / sqrtf(t));
-
-	return quat;
-}
-
-
-Vec2 const Mat44::GetIBasis2D() const
-{
-	return Vec2(m_values[Ix], m_values[Iy]);
-}
-
-
-Vec2 const Mat44::GetJBasis2D() const
-{
-	return Vec2(m_values[Jx], m_values[Jy]);
-}
-
-
-Vec2 const Mat44::GetTranslation2D() const
-{
-	return Vec2(m_values[Tx], m_values[Ty]);
-}
-
-
-Vec3 const Mat44::GetIBasis3D() const
-{
-	return Vec3(m_values[Ix], m_values[Iy], m_values[Iz]);
-}
-
-
-Vec3 const Mat44::GetJBasis3D() const
-{
-	return Vec3(m_values[Jx], m_values[Jy], m_values[Jz]);
-}
-
-
-Vec3 const Mat44::GetKBasis3D() const
-{
-	return Vec3(m_values[Kx], m_values[Ky], m_values[Kz]);
-}
-
-
-Vec3 const Mat44::GetTranslation3D() const
-{
-	return Vec3(m_values[Tx], m_values[Ty], m_values[Tz]);
-}
-
-
-Vec4 const Mat44::GetIBasis4D() const
-{
-	return Vec4(m_values[Ix], m_values[Iy], m_values[Iz], m_values[Iw]);
-}
-
-
-Vec4 const Mat44::GetJBasis4D() const
-{
-	return Vec4(m_values[Jx], m_values[Jy], m_values[Jz], m_values[Jw]);
-}
-
-
-Vec4 const Mat44::GetKBasis4D() const
-{
-	return Vec4(m_values[Kx], m_values[Ky], m_values[Kz], m_values[Kw]);
-}
-
-
-Vec4 const Mat44::GetTranslation4D() const
-{
-	return Vec4(m_values[Tx], m_values[Ty], m_values[Tz], m_values[Tw]);
-}
-
-
-Mat44 const Mat44::GetOrthonormalInverse() const
-{
-	Vec3 iBasis = GetIBasis3D();
-	Vec3 jBasis = GetJBasis3D();
-	Vec3 kBasis = GetKBasis3D();
-
-	Mat44 rotationMatrix;
-	rotationMatrix.SetIJK3D(iBasis, jBasis, kBasis);
-
-	rotationMatrix.Transpose();
-
-	Vec3 translation = GetTranslation3D();
-	translation.x = -translation.x;
-	translation.y = -translation.y;
-	translation.z = -translation.z;
-
-	Mat44 translationMatrix;
-	translationMatrix.SetTranslation3D(translation);
-
-	Mat44 inverseMatrix = rotationMatrix;
-	inverseMatrix.Append(translationMatrix);
-
-	return inverseMatrix;
-}
-
-
-//
-//mutators
-//
-void Mat44::SetTranslation2D(Vec2 const& translationXY)
-{
-	m_values[Tx] = translationXY.x;
-	m_values[Ty] = translationXY.y;
-	m_values[Tz] = 0.0f;
-	m_values[Tw] = 1.0f;
-}
-
-
-void Mat44::SetTranslation3D(Vec3 const& translationXYZ)
-{
-	m_values[Tx] = translationXYZ.x;
-	m_values[Ty] = translationXYZ.y;
-	m_values[Tz] = translationXYZ.z;
-	m_values[Tw] = 1.0f;
-}
-
-
-void Mat44::SetIJ2D(Vec2 const& iBasis2D, Vec2 const& jBasis2D)
-{
-	m_values[Ix] = iBasis2D.x;
-	m_values[Iy] = iBasis2D.y;
-	m_values[Iz] = 0.0f;
-	m_values[Iw] = 0.0f;
-
-	m_values[Jx] = jBasis2D.x;
-	m_values[Jy] = jBasis2D.y;
-	m_values[Jz] = 0.0f;
-	m_values[Jw] = 0.0f;
-}
-
-
-void Mat44::SetIJT2D(Vec2 const& iBasis2D, Vec2 const& jBasis2D, Vec2 const& translationXY)
-{
-	m_values[Ix] = iBasis2D.x;
-	m_values[Iy] = iBasis2D.y;
-	m_values[Iz] = 0.0f;
-	m_values[Iw] = 0.0f;
-
-	m_values[Jx] = jBasis2D.x;
-	m_values[Jy] = jBasis2D.y;
-	m_values[Jz] = 0.0f;
-	m_values[Jw] = 0.0f;
-
-	m_values[Tx] = translationXY.x;
-	m_values[Ty] = translationXY.y;
-	m_values[Tz] = 0.0f;
-	m_values[Tw] = 1.0f;
-}
-
-
-void Mat44::SetIJK3D(Vec3 const& iBasis3D, Vec3 const& jBasis3D, Vec3 const& kBasis3D)
-{
-	m_values[Ix] = iBasis3D.x;
-	m_values[Iy] = iBasis3D.y;
-	m_values[Iz] = iBasis3D.z;
-	m_values[Iw] = 0.0f;
-						 
-	m_values[Jx] = jBasis3D.x;
-	m_values[Jy] = jBasis3D.y;
-	m_values[Jz] = jBasis3D.z;
-	m_values[Jw] = 0.0f;
-
-	m_values[Kx] = kBasis3D.x;
-	m_values[Ky] = kBasis3D.y;
-	m_values[Kz] = kBasis3D.z;
-	m_values[Kw] = 0.0f;
-}
-
-void Mat44::SetIJKT3D(Vec3 const& iBasis3D, Vec3 const& jBasis3D, Vec3 const& kBasis3D, Vec3 const& translationXYZ)
-{
-	m_values[Ix] = iBasis3D.x;
-	m_values[Iy] = iBasis3D.y;
-	m_values[Iz] = iBasis3D.z;
-	m_values[Iw] = 0.0f;
-
-	m_values[Jx] = jBasis3D.x;
-	m_values[Jy] = jBasis3D.y;
-	m_values[Jz] = jBasis3D.z;
-	m_values[Jw] = 0.0f;
-
-	m_values[Kx] = kBasis3D.x;
-	m_values[Ky] = kBasis3D.y;
-	m_values[Kz] = kBasis3D.z;
-	m_values[Kw] = 0.0f;
-
-	m_values[Tx] = translationXYZ.x;
-	m_values[Ty] = translationXYZ.y;
-	m_values[Tz] = translationXYZ.z;
-	m_values[Tw] = 1.0f;
-}
-
-
-void Mat44::SetIJKT4D(Vec4 const& iBasis4D, Vec4 const& jBasis4D, Vec4 const& kBasis4D, Vec4 const& translation4D)
-{
-	m_values[Ix] = iBasis4D.x;
-	m_values[Iy] = iBasis4D.y;
-	m_values[Iz] = iBasis4D.z;
-	m_values[Iw] = iBasis4D.w;
-
-	m_values[Jx] = jBasis4D.x;
-	m_values[Jy] = jBasis4D.y;
-	m_values[Jz] = jBasis4D.z;
-	m_values[Jw] = jBasis4D.w;
-
-	m_values[Kx] = kBasis4D.x;
-	m_values[Ky] = kBasis4D.y;
-	m_values[Kz] = kBasis4D.z;
-	m_values[Kw] = kBasis4D.w;
-
-	m_values[Tx] = translation4D.x;
-	m_values[Ty] = translation4D.y;
-	m_values[Tz] = translation4D.z;
-	m_values[Tw] = translation4D.w;
-}
-
-
-void Mat44::Transpose()
-{
-	Mat44 copyOfThis = *this;
-	float const* oldValues = copyOfThis.m_values;
-
-	m_values[Iy] = oldValues[Jx];
-	m_values[Iz] = oldValues[Kx];
-	m_values[Iw] = oldValues[Tx];
-
-	m_values[Jx] = oldValues[Iy];
-	m_values[Jz] = oldValues[Ky];
-	m_values[Jw] = oldValues[Ty];
-
-	m_values[Kx] = oldValues[Iz];
-	m_values[Ky] = oldValues[Jz];
-	m_values[Kw] = oldValues[Tz];
-
-	m_values[Tx] = oldValues[Iw];
-	m_values[Ty] = oldValues[Jw];
-	m_values[Tz] = oldValues[Kw];
-}
-
-
-void Mat44::Orthonormalize_XFwd_YLeft_ZUp()
-{
-	Vec3 iBasis = GetIBasis3D();
-	Vec3 jBasis = GetJBasis3D();
-	Vec3 kBasis = GetKBasis3D();
-
-	iBasis.Normalize();
-	
-	float kDotI = DotProduct3D(kBasis, iBasis);
-	Vec3 kProjectedOnI = iBasis * kDotI;
-	kBasis -= kProjectedOnI;
-	kBasis.Normalize();
-
-	float jDotI = DotProduct3D(jBasis, iBasis);
-	Vec3 jProjectedOnI = iBasis * jDotI;
-	jBasis -= jProjectedOnI;
-	float jDotK = DotProduct3D(jBasis, kBasis);
-	Vec3 jProjectedOnK = kBasis * jDotK;
-	jBasis -= jProjectedOnK;
-	jBasis.Normalize();
-
-	SetIJK3D(iBasis, jBasis, kBasis);
-}
-
-
-//
-//append functions
-//
-void Mat44::Append(Mat44 const& matToAppend)
-{
-	Mat44 copyOfThis = *this;
-	float const* oldValues = copyOfThis.m_values;
-	float const* newValues = matToAppend.m_values;
-
-	m_values[Ix] = oldValues[Ix] * newValues[Ix] + oldValues[Jx] * newValues[Iy] + oldValues[Kx] * newValues[Iz] + oldValues[Tx] * newValues[Iw];
-	m_values[Iy] = oldValues[Iy] * newValues[Ix] + oldValues[Jy] * newValues[Iy] + oldValues[Ky] * newValues[Iz] + oldValues[Ty] * newValues[Iw];
-	m_values[Iz] = oldValues[Iz] * newValues[Ix] + oldValues[Jz] * newValues[Iy] + oldValues[Kz] * newValues[Iz] + oldValues[Tz] * newValues[Iw];
-	m_values[Iw] = oldValues[Iw] * newValues[Ix] + oldValues[Jw] * newValues[Iy] + oldValues[Kw] * newValues[Iz] + oldValues[Tw] * newValues[Iw];
-
-	m_values[Jx] = oldValues[Ix] * newValues[Jx] + oldValues[Jx] * newValues[Jy] + oldValues[Kx] * newValues[Jz] + oldValues[Tx] * newValues[Jw];
-	m_values[Jy] = oldValues[Iy] * newValues[Jx] + oldValues[Jy] * newValues[Jy] + oldValues[Ky] * newValues[Jz] + oldValues[Ty] * newValues[Jw];
-	m_values[Jz] = oldValues[Iz] * newValues[Jx] + oldValues[Jz] * newValues[Jy] + oldValues[Kz] * newValues[Jz] + oldValues[Tz] * newValues[Jw];
-	m_values[Jw] = oldValues[Iw] * newValues[Jx] + oldValues[Jw] * newValues[Jy] + oldValues[Kw] * newValues[Jz] + oldValues[Tw] * newValues[Jw];
-
-	m_values[Kx] = oldValues[Ix] * newValues[Kx] + oldValues[Jx] * newValues[Ky] + oldValues[Kx] * newValues[Kz] + oldValues[Tx] * newValues[Kw];
-	m_values[Ky] = oldValues[Iy] * newValues[Kx] + oldValues[Jy] * newValues[Ky] + oldValues[Ky] * newValues[Kz] + oldValues[Ty] * newValues[Kw];
-	m_values[Kz] = oldValues[Iz] * newValues[Kx] + oldValues[Jz] * newValues[Ky] + oldValues[Kz] * newValues[Kz] + oldValues[Tz] * newValues[Kw];
-	m_values[Kw] = oldValues[Iw] * newValues[Kx] + oldValues[Jw] * newValues[Ky] + oldValues[Kw] * newValues[Kz] + oldValues[Tw] * newValues[Kw];
-
-	m_values[Tx] = oldValues[Ix] * newValues[Tx] + oldValues[Jx] * newValues[Ty] + oldValues[Kx] * newValues[Tz] + oldValues[Tx] * newValues[Tw];
-	m_values[Ty] = oldValues[Iy] * newValues[Tx] + oldValues[Jy] * newValues[Ty] + oldValues[Ky] * newValues[Tz] + oldValues[Ty] * newValues[Tw];
-	m_values[Tz] = oldValues[Iz] * newValues[Tx] + oldValues[Jz] * newValues[Ty] + oldValues[Kz] * newValues[Tz] + oldValues[Tz] * newValues[Tw];
-	m_values[Tw] = oldValues[Iw] * newValues[Tx] + oldValues[Jw] * newValues[Ty] + oldValues[Kw] * newValues[Tz] + oldValues[Tw] * newValues[Tw];
-}
-
-
-void Mat44::AppendZRotation(float degreesRotationAboutZ)
-{
-	Mat44 copyOfThis = *this;
-	float const* oldValues = copyOfThis.m_values;
-
-	float c = CosDegrees(degreesRotationAboutZ);
-	float s = SinDegrees(degreesRotationAboutZ);
-
-	m_values[Ix] = oldValues[Ix] * c + oldValues[Jx] * s;
-	m_values[Iy] = oldValues[Iy] * c + oldValues[Jy] * s;
-	m_values[Iz] = oldValues[Iz] * c + oldValues[Jz] * s;
-	m_values[Iw] = oldValues[Iw] * c + oldValues[Jw] * s;
-
-	m_values[Jx] = oldValues[Ix] * -s + oldValues[Jx] * c;
-	m_values[Jy] = oldValues[Iy] * -s + oldValues[Jy] * c;
-	m_values[Jz] = oldValues[Iz] * -s + oldValues[Jz] * c;
-	m_values[Jw] = oldValues[Iw] * -s + oldValues[Jw] * c;
-}
-
-
-void Mat44::AppendYRotation(float degreesRotationAboutY)
-{
-	Mat44 copyOfThis = *this;
-	float const* oldValues = copyOfThis.m_values;
-
-	float c = CosDegrees(degreesRotationAboutY);
-	float s = SinDegrees(degreesRotationAboutY);
-
-	m_values[Ix] = oldValues[Ix] * c + oldValues[Kx] * -s;
-	m_values[Iy] = oldValues[Iy] * c + oldValues[Ky] * -s;
-	m_values[Iz] = oldValues[Iz] * c + oldValues[Kz] * -s;
-	m_values[Iw] = oldValues[Iw] * c + oldValues[Kw] * -s;
-
-	m_values[Kx] = oldValues[Ix] * s + oldValues[Kx] * c;
-	m_values[Ky] = oldValues[Iy] * s + oldValues[Ky] * c;
-	m_values[Kz] = oldValues[Iz] * s + oldValues[Kz] * c;
-	m_values[Kw] = oldValues[Iw] * s + oldValues[Kw] * c;
-}
-
-
-void Mat44::AppendXRotation(float degreesRotationAboutX)
-{
-	Mat44 copyOfThis = *this;
-	float const* oldValues = copyOfThis.m_values;
-
-	float c = CosDegrees(degreesRotationAboutX);
-	float s = SinDegrees(degreesRotationAboutX);
-
-	m_values[Jx] = oldValues[Jx] * c + oldValues[Kx] * s;
-	m_values[Jy] = oldValues[Jy] * c + oldValues[Ky] * s;
-	m_values[Jz] = oldValues[Jz] * c + oldValues[Kz] * s;
-	m_values[Jw] = oldValues[Jw] * c + oldValues[Kw] * s;
-
-	m_values[Kx] = oldValues[Jx] * -s + oldValues[Kx] * c;
-	m_values[Ky] = oldValues[Jy] * -s + oldValues[Ky] * c;
-	m_values[Kz] = oldValues[Jz] * -s + oldValues[Kz] * c;
-	m_values[Kw] = oldValues[Jw] * -s + oldValues[Kw] * c;
-}
-
-
-void Mat44::AppendTranslation2D(Vec2 const& translationXY)
-{
-	Mat44 copyOfThis = *this;
-
-	float const* oldValues = copyOfThis.m_values;
-
-	m_values[Tx] = oldValues[Ix] * translationXY.x + oldValues[Jx] * translationXY.y + oldValues[Tx];
-	m_values[Ty] = oldValues[Iy] * translationXY.x + oldValues[Jy] * translationXY.y + oldValues[Ty];
-	m_values[Tz] = oldValues[Iz] * translationXY.x + oldValues[Jz] * translationXY.y + oldValues[Tz];
-	m_values[Tw] = oldValues[Iw] * translationXY.x + oldValues[Jw] * translationXY.y + oldValues[Tw];
-}
-
-
-void Mat44::AppendTranslation3D(Vec3 const& translationXYZ)
-{
-	Mat44 copyOfThis = *this;
-
-	float const* oldValues = copyOfThis.m_values;
-	
-	m_values[Tx] = oldValues[Ix] * translationXYZ.x + oldValues[Jx] * translationXYZ.y + oldValues[Kx] * translationXYZ.z + oldValues[Tx];
-	m_values[Ty] = oldValues[Iy] * translationXYZ.x + oldValues[Jy] * translationXYZ.y + oldValues[Ky] * translationXYZ.z + oldValues[Ty];
-	m_values[Tz] = oldValues[Iz] * translationXYZ.x + oldValues[Jz] * translationXYZ.y + oldValues[Kz] * translationXYZ.z + oldValues[Tz];
-	m_values[Tw] = oldValues[Iw] * translationXYZ.x + oldValues[Jw] * translationXYZ.y + oldValues[Kw] * translationXYZ.z + oldValues[Tw];
-}
-
-
-void Mat44::AppendScaleUniform2D(float uniformScaleXY)
-{
-	m_values[Ix] *= uniformScaleXY;
-	m_values[Iy] *= uniformScaleXY;
-	m_values[Iz] *= uniformScaleXY;
-	m_values[Iw] *= uniformScaleXY;
-				    
-	m_values[Jx] *= uniformScaleXY;
-	m_values[Jy] *= uniformScaleXY;
-	m_values[Jz] *= uniformScaleXY;
-	m_values[Jw] *= uniformScaleXY;
-}
-
-
-void Mat44::AppendScaleUniform3D(float uniformScaleXYZ)
-{
-	m_values[Ix] *= uniformScaleXYZ;
-	m_values[Iy] *= uniformScaleXYZ;
-	m_values[Iz] *= uniformScaleXYZ;
-	m_values[Iw] *= uniformScaleXYZ;
-
-	m_values[Jx] *= uniformScaleXYZ;
-	m_values[Jy] *= uniformScaleXYZ;
-	m_values[Jz] *= uniformScaleXYZ;
-	m_values[Jw] *= uniformScaleXYZ;
-
-	m_values[Kx] *= uniformScaleXYZ;
-	m_values[Ky] *= uniformScaleXYZ;
-	m_values[Kz] *= uniformScaleXYZ;
-	m_values[Kw] *= uniformScaleXYZ;
-}
-
-
-void Mat44::AppendScaleNonUniform2D(Vec2 const& nonUniformScaleXY)
-{
-	m_values[Ix] *= nonUniformScaleXY.x;
-	m_values[Iy] *= nonUniformScaleXY.x;
-	m_values[Iz] *= nonUniformScaleXY.x;
-	m_values[Iw] *= nonUniformScaleXY.x;
-
-	m_values[Jx] *= nonUniformScaleXY.y;
-	m_values[Jy] *= nonUniformScaleXY.y;
-	m_values[Jz] *= nonUniformScaleXY.y;
-	m_values[Jw] *= nonUniformScaleXY.y;
-}
-
-
-void Mat44::AppendScaleNonUniform3D(Vec3 const& nonUniformScaleXYZ)
-{
-	m_values[Ix] *= nonUniformScaleXYZ.x;
-	m_values[Iy] *= nonUniformScaleXYZ.x;
-	m_values[Iz] *= nonUniformScaleXYZ.x;
-	m_values[Iw] *= nonUniformScaleXYZ.x;
-
-	m_values[Jx] *= nonUniformScaleXYZ.y;
-	m_values[Jy] *= nonUniformScaleXYZ.y;
-	m_values[Jz] *= nonUniformScaleXYZ.y;
-	m_values[Jw] *= nonUniformScaleXYZ.y;
-
-	m_values[Kx] *= nonUniformScaleXYZ.z;
-	m_values[Ky] *= nonUniformScaleXYZ.z;
-	m_values[Kz] *= nonUniformScaleXYZ.z;
-	m_values[Kw] *= nonUniformScaleXYZ.z;
-}
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Math/Vec4.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/Quaternion.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include <math.h>
+
+
+//
+//batch transform kernels
+//
+//translationScale is 1 for positions and 0 for vector quantities, so one kernel covers both
+static void TransformVec3Array_Scalar(float const* matrix, int numElements, unsigned char* firstElement, int strideBytes, float translationScale)
+{
+	for (int elementIndex = 0; elementIndex < numElements; elementIndex++)
+	{
+		float* element = reinterpret_cast<float*>(firstElement + elementIndex * strideBytes);
+		float x = element[0];
+		float y = element[1];
+		float z = element[2];
+
+		element[0] = matrix[Mat44::Ix] * x + matrix[Mat44::Jx] * y + matrix[Mat44::Kx] * z + matrix[Mat44::Tx] * translationScale;
+		element[1] = matrix[Mat44::Iy] * x + matrix[Mat44::Jy] * y + matrix[Mat44::Ky] * z + matrix[Mat44::Ty] * translationScale;
+		element[2] = matrix[Mat44::Iz] * x + matrix[Mat44::Jz] * y + matrix[Mat44::Kz] * z + matrix[Mat44::Tz] * translationScale;
+	}
+}
+
+
+#if defined(ENGINE_SIMD_X86)
+static void TransformVec3Array_SSE2(float const* matrix, int numElements, unsigned char* firstElement, int strideBytes, float translationScale)
+{
+	__m128 iBasis = _mm_loadu_ps(&matrix[Mat44::Ix]);
+	__m128 jBasis = _mm_loadu_ps(&matrix[Mat44::Jx]);
+	__m128 kBasis = _mm_loadu_ps(&matrix[Mat44::Kx]);
+	__m128 translation = _mm_mul_ps(_mm_loadu_ps(&matrix[Mat44::Tx]), _mm_set1_ps(translationScale));
+
+	for (int elementIndex = 0; elementIndex < numElements; elementIndex++)
+	{
+		float* element = reinterpret_cast<float*>(firstElement + elementIndex * strideBytes);
+
+		__m128 result = _mm_mul_ps(iBasis, _mm_set1_ps(element[0]));
+		result = _mm_add_ps(result, _mm_mul_ps(jBasis, _mm_set1_ps(element[1])));
+		result = _mm_add_ps(result, _mm_mul_ps(kBasis, _mm_set1_ps(element[2])));
+		result = _mm_add_ps(result, translation);
+
+		//write exactly 12 bytes, the next 4 belong to whatever follows in the vertex
+		_mm_storel_pi(reinterpret_cast<__m64*>(element), result);
+		_mm_store_ss(&element[2], _mm_movehl_ps(result, result));
+	}
+}
+
+
+SIMD_AVX2_FUNCTION static void TransformVec3Array_AVX2(float const* matrix, int numElements, unsigned char* firstElement, int strideBytes, float translationScale)
+{
+	__m256 ix = _mm256_set1_ps(matrix[Mat44::Ix]);
+	__m256 iy = _mm256_set1_ps(matrix[Mat44::Iy]);
+	__m256 iz = _mm256_set1_ps(matrix[Mat44::Iz]);
+	__m256 jx = _mm256_set1_ps(matrix[Mat44::Jx]);
+	__m256 jy = _mm256_set1_ps(matrix[Mat44::Jy]);
+	__m256 jz = _mm256_set1_ps(matrix[Mat44::Jz]);
+	__m256 kx = _mm256_set1_ps(matrix[Mat44::Kx]);
+	__m256 ky = _mm256_set1_ps(matrix[Mat44::Ky]);
+	__m256 kz = _mm256_set1_ps(matrix[Mat44::Kz]);
+	__m256 tx = _mm256_set1_ps(matrix[Mat44::Tx] * translationScale);
+	__m256 ty = _mm256_set1_ps(matrix[Mat44::Ty] * translationScale);
+	__m256 tz = _mm256_set1_ps(matrix[Mat44::Tz] * translationScale);
+
+	//eight elements at a time, gathered into x/y/z registers so each lane is one element
+	__m256i laneOffsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(strideBytes));
+	float resultZ[8];
+
+	int elementIndex = 0;
+	for (; elementIndex + 8 <= numElements; elementIndex += 8)
+	{
+		unsigned char* firstLaneElement = firstElement + elementIndex * strideBytes;
+		float const* firstLaneFloats = reinterpret_cast<float const*>(firstLaneElement);
+
+		__m256 x = _mm256_i32gather_ps(firstLaneFloats, laneOffsets, 1);
+		__m256 y = _mm256_i32gather_ps(firstLaneFloats + 1, laneOffsets, 1);
+		__m256 z = _mm256_i32gather_ps(firstLaneFloats + 2, laneOffsets, 1);
+
+		__m256 newX = _mm256_fmadd_ps(ix, x, _mm256_fmadd_ps(jx, y, _mm256_fmadd_ps(kx, z, tx)));
+		__m256 newY = _mm256_fmadd_ps(iy, x, _mm256_fmadd_ps(jy, y, _mm256_fmadd_ps(ky, z, ty)));
+		_mm256_storeu_ps(resultZ, _mm256_fmadd_ps(iz, x, _mm256_fmadd_ps(jz, y, _mm256_fmadd_ps(kz, z, tz))));
+
+		//interleave x and y so every lane's xy pair can go out as one 8 byte store
+		__m256 lowXY = _mm256_unpacklo_ps(newX, newY);		//lanes 0, 1 | 4, 5
+		__m256 highXY = _mm256_unpackhi_ps(newX, newY);		//lanes 2, 3 | 6, 7
+		__m128 laneXYs[4] = { _mm256_castps256_ps128(lowXY), _mm256_castps256_ps128(highXY), _mm256_extractf128_ps(lowXY, 1), _mm256_extractf128_ps(highXY, 1) };
+
+		for (int laneIndex = 0; laneIndex < 8; laneIndex += 2)
+		{
+			float* evenElement = reinterpret_cast<float*>(firstLaneElement + laneIndex * strideBytes);
+			float* oddElement = reinterpret_cast<float*>(firstLaneElement + (laneIndex + 1) * strideBytes);
+
+			_mm_storel_pi(reinterpret_cast<__m64*>(evenElement), laneXYs[laneIndex / 2]);
+			_mm_storeh_pi(reinterpret_cast<__m64*>(oddElement), laneXYs[laneIndex / 2]);
+			evenElement[2] = resultZ[laneIndex];
+			oddElement[2] = resultZ[laneIndex + 1];
+		}
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	TransformVec3Array_SSE2(matrix, numElements - elementIndex, firstElement + elementIndex * strideBytes, strideBytes, translationScale);
+}
+#endif
+
+
+static void TransformVec3Array(float const* matrix, int numElements, unsigned char* firstElement, int strideBytes, float translationScale)
+{
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		TransformVec3Array_AVX2(matrix, numElements, firstElement, strideBytes, translationScale);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		TransformVec3Array_SSE2(matrix, numElements, firstElement, strideBytes, translationScale);
+		return;
+	}
+#endif
+
+	TransformVec3Array_Scalar(matrix, numElements, firstElement, strideBytes, translationScale);
+}
+
+
+//
+//inverse kernels
+//
+//the general kernels treat the 16 floats as four rows, which works for column major storage too since inverse(transpose(M)) = transpose(inverse(M))
+//singular matrices (determinant 0) come out as all zeros instead of infinities
+static void InvertMatrix_Scalar(float const* matrix, float* out_inverse)
+{
+	float a00 = matrix[0];	float a01 = matrix[1];	float a02 = matrix[2];	float a03 = matrix[3];
+	float a10 = matrix[4];	float a11 = matrix[5];	float a12 = matrix[6];	float a13 = matrix[7];
+	float a20 = matrix[8];	float a21 = matrix[9];	float a22 = matrix[10];	float a23 = matrix[11];
+	float a30 = matrix[12];	float a31 = matrix[13];	float a32 = matrix[14];	float a33 = matrix[15];
+
+	//2x2 determinants of the top two and bottom two rows, the Laplace expansion builds every cofactor from them
+	float s0 = a00 * a11 - a10 * a01;
+	float s1 = a00 * a12 - a10 * a02;
+	float s2 = a00 * a13 - a10 * a03;
+	float s3 = a01 * a12 - a11 * a02;
+	float s4 = a01 * a13 - a11 * a03;
+	float s5 = a02 * a13 - a12 * a03;
+
+	float c0 = a20 * a31 - a30 * a21;
+	float c1 = a20 * a32 - a30 * a22;
+	float c2 = a20 * a33 - a30 * a23;
+	float c3 = a21 * a32 - a31 * a22;
+	float c4 = a21 * a33 - a31 * a23;
+	float c5 = a22 * a33 - a32 * a23;
+
+	float determinant = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+	float inverseDeterminant = (determinant != 0.0f) ? 1.0f / determinant : 0.0f;
+
+	out_inverse[0] = ( a11 * c5 - a12 * c4 + a13 * c3) * inverseDeterminant;
+	out_inverse[1] = (-a01 * c5 + a02 * c4 - a03 * c3) * inverseDeterminant;
+	out_inverse[2] = ( a31 * s5 - a32 * s4 + a33 * s3) * inverseDeterminant;
+	out_inverse[3] = (-a21 * s5 + a22 * s4 - a23 * s3) * inverseDeterminant;
+
+	out_inverse[4] = (-a10 * c5 + a12 * c2 - a13 * c1) * inverseDeterminant;
+	out_inverse[5] = ( a00 * c5 - a02 * c2 + a03 * c1) * inverseDeterminant;
+	out_inverse[6] = (-a30 * s5 + a32 * s2 - a33 * s1) * inverseDeterminant;
+	out_inverse[7] = ( a20 * s5 - a22 * s2 + a23 * s1) * inverseDeterminant;
+
+	out_inverse[8] = ( a10 * c4 - a11 * c2 + a13 * c0) * inverseDeterminant;
+	out_inverse[9] = (-a00 * c4 + a01 * c2 - a03 * c0) * inverseDeterminant;
+	out_inverse[10] = ( a30 * s4 - a31 * s2 + a33 * s0) * inverseDeterminant;
+	out_inverse[11] = (-a20 * s4 + a21 * s2 - a23 * s0) * inverseDeterminant;
+
+	out_inverse[12] = (-a10 * c3 + a11 * c1 - a12 * c0) * inverseDeterminant;
+	out_inverse[13] = ( a00 * c3 - a01 * c1 + a02 * c0) * inverseDeterminant;
+	out_inverse[14] = (-a30 * s3 + a31 * s1 - a32 * s0) * inverseDeterminant;
+	out_inverse[15] = ( a20 * s3 - a21 * s1 + a22 * s0) * inverseDeterminant;
+}
+
+
+//the upper 3x3's inverse is its basis cross products over the determinant, the translation is then undone in the new basis
+static void InvertAffineMatrix_Scalar(float const* matrix, float* out_inverse)
+{
+	Vec3 iBasis(matrix[Mat44::Ix], matrix[Mat44::Iy], matrix[Mat44::Iz]);
+	Vec3 jBasis(matrix[Mat44::Jx], matrix[Mat44::Jy], matrix[Mat44::Jz]);
+	Vec3 kBasis(matrix[Mat44::Kx], matrix[Mat44::Ky], matrix[Mat44::Kz]);
+	Vec3 translation(matrix[Mat44::Tx], matrix[Mat44::Ty], matrix[Mat44::Tz]);
+
+	Vec3 xRow = CrossProduct3D(jBasis, kBasis);
+	Vec3 yRow = CrossProduct3D(kBasis, iBasis);
+	Vec3 zRow = CrossProduct3D(iBasis, jBasis);
+	float determinant = DotProduct3D(iBasis, xRow);
+	float inverseDeterminant = (determinant != 0.0f) ? 1.0f / determinant : 0.0f;
+	xRow *= inverseDeterminant;
+	yRow *= inverseDeterminant;
+	zRow *= inverseDeterminant;
+
+	out_inverse[Mat44::Ix] = xRow.x;	out_inverse[Mat44::Iy] = yRow.x;	out_inverse[Mat44::Iz] = zRow.x;	out_inverse[Mat44::Iw] = 0.0f;
+	out_inverse[Mat44::Jx] = xRow.y;	out_inverse[Mat44::Jy] = yRow.y;	out_inverse[Mat44::Jz] = zRow.y;	out_inverse[Mat44::Jw] = 0.0f;
+	out_inverse[Mat44::Kx] = xRow.z;	out_inverse[Mat44::Ky] = yRow.z;	out_inverse[Mat44::Kz] = zRow.z;	out_inverse[Mat44::Kw] = 0.0f;
+	out_inverse[Mat44::Tx] = -DotProduct3D(xRow, translation);
+	out_inverse[Mat44::Ty] = -DotProduct3D(yRow, translation);
+	out_inverse[Mat44::Tz] = -DotProduct3D(zRow, translation);
+	out_inverse[Mat44::Tw] = 1.0f;
+}
+
+
+#if defined(ENGINE_SIMD_X86)
+//2x2 matrices are packed row by row into one register for the block inverse below, # is the adjugate
+static inline __m128 Mat22Multiply_SSE2(__m128 matA, __m128 matB)		//A * B
+{
+	return _mm_add_ps(_mm_mul_ps(matA, _mm_shuffle_ps(matB, matB, _MM_SHUFFLE(3, 0, 3, 0))),
+		_mm_mul_ps(_mm_shuffle_ps(matA, matA, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(matB, matB, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+
+static inline __m128 Mat22AdjugateMultiply_SSE2(__m128 matA, __m128 matB)	//A# * B
+{
+	return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(matA, matA, _MM_SHUFFLE(0, 0, 3, 3)), matB),
+		_mm_mul_ps(_mm_shuffle_ps(matA, matA, _MM_SHUFFLE(2, 2, 1, 1)), _mm_shuffle_ps(matB, matB, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+
+static inline __m128 Mat22MultiplyAdjugate_SSE2(__m128 matA, __m128 matB)	//A * B#
+{
+	return _mm_sub_ps(_mm_mul_ps(matA, _mm_shuffle_ps(matB, matB, _MM_SHUFFLE(0, 3, 0, 3))),
+		_mm_mul_ps(_mm_shuffle_ps(matA, matA, _MM_SHUFFLE(2, 3, 0, 1)), _mm_shuffle_ps(matB, matB, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+
+//block inverse: split M into 2x2 blocks A B / C D, then every block of the inverse is a few 2x2 products over |M|
+static void InvertMatrix_SSE2(float const* matrix, float* out_inverse)
+{
+	__m128 row0 = _mm_loadu_ps(&matrix[0]);
+	__m128 row1 = _mm_loadu_ps(&matrix[4]);
+	__m128 row2 = _mm_loadu_ps(&matrix[8]);
+	__m128 row3 = _mm_loadu_ps(&matrix[12]);
+
+	__m128 blockA = _mm_movelh_ps(row0, row1);
+	__m128 blockB = _mm_movehl_ps(row1, row0);
+	__m128 blockC = _mm_movelh_ps(row2, row3);
+	__m128 blockD = _mm_movehl_ps(row3, row2);
+
+	//|A| |B| |C| |D| in one go
+	__m128 blockDeterminants = _mm_sub_ps(
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(3, 1, 3, 1))),
+		_mm_mul_ps(_mm_shuffle_ps(row0, row2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(row1, row3, _MM_SHUFFLE(2, 0, 2, 0))));
+	__m128 determinantA = _mm_shuffle_ps(blockDeterminants, blockDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+	__m128 determinantB = _mm_shuffle_ps(blockDeterminants, blockDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+	__m128 determinantC = _mm_shuffle_ps(blockDeterminants, blockDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+	__m128 determinantD = _mm_shuffle_ps(blockDeterminants, blockDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+	__m128 adjugateDTimesC = Mat22AdjugateMultiply_SSE2(blockD, blockC);
+	__m128 adjugateATimesB = Mat22AdjugateMultiply_SSE2(blockA, blockB);
+
+	//adjugates of the inverse's blocks, scaled by |M| below
+	__m128 blockX = _mm_sub_ps(_mm_mul_ps(determinantD, blockA), Mat22Multiply_SSE2(blockB, adjugateDTimesC));
+	__m128 blockW = _mm_sub_ps(_mm_mul_ps(determinantA, blockD), Mat22Multiply_SSE2(blockC, adjugateATimesB));
+	__m128 blockY = _mm_sub_ps(_mm_mul_ps(determinantB, blockC), Mat22MultiplyAdjugate_SSE2(blockD, adjugateATimesB));
+	__m128 blockZ = _mm_sub_ps(_mm_mul_ps(determinantC, blockB), Mat22MultiplyAdjugate_SSE2(blockA, adjugateDTimesC));
+
+	//|M| = |A||D| + |B||C| - trace((A#B)(D#C))
+	__m128 trace = _mm_mul_ps(adjugateATimesB, _mm_shuffle_ps(adjugateDTimesC, adjugateDTimesC, _MM_SHUFFLE(3, 1, 2, 0)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(2, 3, 0, 1)));
+	trace = _mm_add_ps(trace, _mm_shuffle_ps(trace, trace, _MM_SHUFFLE(1, 0, 3, 2)));
+	__m128 determinant = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(determinantA, determinantD), _mm_mul_ps(determinantB, determinantC)), trace);
+
+	//the adjugate's sign pattern rides along with 1/|M|
+	__m128 inverseDeterminant = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), determinant);
+	inverseDeterminant = _mm_and_ps(inverseDeterminant, _mm_cmpneq_ps(determinant, _mm_setzero_ps()));
+	blockX = _mm_mul_ps(blockX, inverseDeterminant);
+	blockY = _mm_mul_ps(blockY, inverseDeterminant);
+	blockZ = _mm_mul_ps(blockZ, inverseDeterminant);
+	blockW = _mm_mul_ps(blockW, inverseDeterminant);
+
+	//the final adjugate shuffle doubles as putting the blocks back into rows
+	_mm_storeu_ps(&out_inverse[0], _mm_shuffle_ps(blockX, blockY, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(&out_inverse[4], _mm_shuffle_ps(blockX, blockY, _MM_SHUFFLE(0, 2, 0, 2)));
+	_mm_storeu_ps(&out_inverse[8], _mm_shuffle_ps(blockZ, blockW, _MM_SHUFFLE(1, 3, 1, 3)));
+	_mm_storeu_ps(&out_inverse[12], _mm_shuffle_ps(blockZ, blockW, _MM_SHUFFLE(0, 2, 0, 2)));
+}
+
+
+static inline __m128 CrossProduct3D_SSE2(__m128 vectorA, __m128 vectorB)
+{
+	__m128 aYZX = _mm_shuffle_ps(vectorA, vectorA, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 bYZX = _mm_shuffle_ps(vectorB, vectorB, _MM_SHUFFLE(3, 0, 2, 1));
+	__m128 crossZXY = _mm_sub_ps(_mm_mul_ps(vectorA, bYZX), _mm_mul_ps(aYZX, vectorB));
+	return _mm_shuffle_ps(crossZXY, crossZXY, _MM_SHUFFLE(3, 0, 2, 1));
+}
+
+
+static void InvertAffineMatrix_SSE2(float const* matrix, float* out_inverse)
+{
+	__m128 xyzMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+	__m128 iBasis = _mm_and_ps(_mm_loadu_ps(&matrix[Mat44::Ix]), xyzMask);
+	__m128 jBasis = _mm_and_ps(_mm_loadu_ps(&matrix[Mat44::Jx]), xyzMask);
+	__m128 kBasis = _mm_and_ps(_mm_loadu_ps(&matrix[Mat44::Kx]), xyzMask);
+	__m128 translation = _mm_loadu_ps(&matrix[Mat44::Tx]);
+
+	__m128 xRow = CrossProduct3D_SSE2(jBasis, kBasis);
+	__m128 yRow = CrossProduct3D_SSE2(kBasis, iBasis);
+	__m128 zRow = CrossProduct3D_SSE2(iBasis, jBasis);
+
+	__m128 determinant = _mm_mul_ps(iBasis, xRow);
+	determinant = _mm_add_ps(determinant, _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(2, 3, 0, 1)));
+	determinant = _mm_add_ps(determinant, _mm_shuffle_ps(determinant, determinant, _MM_SHUFFLE(1, 0, 3, 2)));
+	__m128 inverseDeterminant = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), determinant), _mm_cmpneq_ps(determinant, _mm_setzero_ps()));
+	xRow = _mm_mul_ps(xRow, inverseDeterminant);
+	yRow = _mm_mul_ps(yRow, inverseDeterminant);
+	zRow = _mm_mul_ps(zRow, inverseDeterminant);
+
+	//rows to columns, the fourth row is all zeros so every w comes out 0
+	__m128 wRow = _mm_setzero_ps();
+	_MM_TRANSPOSE4_PS(xRow, yRow, zRow, wRow);
+
+	__m128 newTranslation = _mm_mul_ps(xRow, _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(0, 0, 0, 0)));
+	newTranslation = _mm_add_ps(newTranslation, _mm_mul_ps(yRow, _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(1, 1, 1, 1))));
+	newTranslation = _mm_add_ps(newTranslation, _mm_mul_ps(zRow, _mm_shuffle_ps(translation, translation, _MM_SHUFFLE(2, 2, 2, 2))));
+	newTranslation = _mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f), newTranslation);
+
+	_mm_storeu_ps(&out_inverse[Mat44::Ix], xRow);
+	_mm_storeu_ps(&out_inverse[Mat44::Jx], yRow);
+	_mm_storeu_ps(&out_inverse[Mat44::Kx], zRow);
+	_mm_storeu_ps(&out_inverse[Mat44::Tx], newTranslation);
+}
+
+
+//same block inverse as the SSE2 kernel with two matrices side by side, AVX shuffles stay within each 128 bit half
+SIMD_AVX2_FUNCTION static inline __m256 Mat22Multiply_AVX2(__m256 matA, __m256 matB)
+{
+	return _mm256_add_ps(_mm256_mul_ps(matA, _mm256_permute_ps(matB, _MM_SHUFFLE(3, 0, 3, 0))),
+		_mm256_mul_ps(_mm256_permute_ps(matA, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_permute_ps(matB, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+
+SIMD_AVX2_FUNCTION static inline __m256 Mat22AdjugateMultiply_AVX2(__m256 matA, __m256 matB)
+{
+	return _mm256_sub_ps(_mm256_mul_ps(_mm256_permute_ps(matA, _MM_SHUFFLE(0, 0, 3, 3)), matB),
+		_mm256_mul_ps(_mm256_permute_ps(matA, _MM_SHUFFLE(2, 2, 1, 1)), _mm256_permute_ps(matB, _MM_SHUFFLE(1, 0, 3, 2))));
+}
+
+
+SIMD_AVX2_FUNCTION static inline __m256 Mat22MultiplyAdjugate_AVX2(__m256 matA, __m256 matB)
+{
+	return _mm256_sub_ps(_mm256_mul_ps(matA, _mm256_permute_ps(matB, _MM_SHUFFLE(0, 3, 0, 3))),
+		_mm256_mul_ps(_mm256_permute_ps(matA, _MM_SHUFFLE(2, 3, 0, 1)), _mm256_permute_ps(matB, _MM_SHUFFLE(1, 2, 1, 2))));
+}
+
+
+SIMD_AVX2_FUNCTION static void InvertMatrixArray_AVX2(int numMatrices, float const* matrices, float* out_inverses)
+{
+	int matrixIndex = 0;
+	for (; matrixIndex + 2 <= numMatrices; matrixIndex += 2)
+	{
+		float const* firstMatrix = &matrices[matrixIndex * 16];
+		__m256 rows[4];
+		for (int rowIndex = 0; rowIndex < 4; rowIndex++)
+		{
+			rows[rowIndex] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&firstMatrix[rowIndex * 4])), _mm_loadu_ps(&firstMatrix[16 + rowIndex * 4]), 1);
+		}
+
+		__m256 blockA = _mm256_shuffle_ps(rows[0], rows[1], _MM_SHUFFLE(1, 0, 1, 0));
+		__m256 blockB = _mm256_shuffle_ps(rows[0], rows[1], _MM_SHUFFLE(3, 2, 3, 2));
+		__m256 blockC = _mm256_shuffle_ps(rows[2], rows[3], _MM_SHUFFLE(1, 0, 1, 0));
+		__m256 blockD = _mm256_shuffle_ps(rows[2], rows[3], _MM_SHUFFLE(3, 2, 3, 2));
+
+		__m256 blockDeterminants = _mm256_fmsub_ps(_mm256_shuffle_ps(rows[0], rows[2], _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_ps(rows[1], rows[3], _MM_SHUFFLE(3, 1, 3, 1)),
+			_mm256_mul_ps(_mm256_shuffle_ps(rows[0], rows[2], _MM_SHUFFLE(3, 1, 3, 1)), _mm256_shuffle_ps(rows[1], rows[3], _MM_SHUFFLE(2, 0, 2, 0))));
+		__m256 determinantA = _mm256_permute_ps(blockDeterminants, _MM_SHUFFLE(0, 0, 0, 0));
+		__m256 determinantB = _mm256_permute_ps(blockDeterminants, _MM_SHUFFLE(1, 1, 1, 1));
+		__m256 determinantC = _mm256_permute_ps(blockDeterminants, _MM_SHUFFLE(2, 2, 2, 2));
+		__m256 determinantD = _mm256_permute_ps(blockDeterminants, _MM_SHUFFLE(3, 3, 3, 3));
+
+		__m256 adjugateDTimesC = Mat22AdjugateMultiply_AVX2(blockD, blockC);
+		__m256 adjugateATimesB = Mat22AdjugateMultiply_AVX2(blockA, blockB);
+
+		__m256 blockX = _mm256_fmsub_ps(determinantD, blockA, Mat22Multiply_AVX2(blockB, adjugateDTimesC));
+		__m256 blockW = _mm256_fmsub_ps(determinantA, blockD, Mat22Multiply_AVX2(blockC, adjugateATimesB));
+		__m256 blockY = _mm256_fmsub_ps(determinantB, blockC, Mat22MultiplyAdjugate_AVX2(blockD, adjugateATimesB));
+		__m256 blockZ = _mm256_fmsub_ps(determinantC, blockB, Mat22MultiplyAdjugate_AVX2(blockA, adjugateDTimesC));
+
+		__m256 trace = _mm256_mul_ps(adjugateATimesB, _mm256_permute_ps(adjugateDTimesC, _MM_SHUFFLE(3, 1, 2, 0)));
+		trace = _mm256_add_ps(trace, _mm256_permute_ps(trace, _MM_SHUFFLE(2, 3, 0, 1)));
+		trace = _mm256_add_ps(trace, _mm256_permute_ps(trace, _MM_SHUFFLE(1, 0, 3, 2)));
+		__m256 determinant = _mm256_sub_ps(_mm256_fmadd_ps(determinantA, determinantD, _mm256_mul_ps(determinantB, determinantC)), trace);
+
+		__m256 inverseDeterminant = _mm256_div_ps(_mm256_setr_ps(1.0f, -1.0f, -1.0f, 1.0f, 1.0f, -1.0f, -1.0f, 1.0f), determinant);
+		inverseDeterminant = _mm256_and_ps(inverseDeterminant, _mm256_cmp_ps(determinant, _mm256_setzero_ps(), _CMP_NEQ_UQ));
+		blockX = _mm256_mul_ps(blockX, inverseDeterminant);
+		blockY = _mm256_mul_ps(blockY, inverseDeterminant);
+		blockZ = _mm256_mul_ps(blockZ, inverseDeterminant);
+		blockW = _mm256_mul_ps(blockW, inverseDeterminant);
+
+		//written only after both matrices were read, so the arrays may be the same
+		float* firstInverse = &out_inverses[matrixIndex * 16];
+		rows[0] = _mm256_shuffle_ps(blockX, blockY, _MM_SHUFFLE(1, 3, 1, 3));
+		rows[1] = _mm256_shuffle_ps(blockX, blockY, _MM_SHUFFLE(0, 2, 0, 2));
+		rows[2] = _mm256_shuffle_ps(blockZ, blockW, _MM_SHUFFLE(1, 3, 1, 3));
+		rows[3] = _mm256_shuffle_ps(blockZ, blockW, _MM_SHUFFLE(0, 2, 0, 2));
+		for (int rowIndex = 0; rowIndex < 4; rowIndex++)
+		{
+			_mm_storeu_ps(&firstInverse[rowIndex * 4], _mm256_castps256_ps128(rows[rowIndex]));
+			_mm_storeu_ps(&firstInverse[16 + rowIndex * 4], _mm256_extractf128_ps(rows[rowIndex], 1));
+		}
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	if (matrixIndex < numMatrices)
+	{
+		InvertMatrix_SSE2(&matrices[matrixIndex * 16], &out_inverses[matrixIndex * 16]);
+	}
+}
+#endif
+
+
+//
+//constructors
+//
+Mat44::Mat44()
+{
+	//default constructor makes identity matrix
+	m_values[Ix] = 1.0f;
+	m_values[Iy] = 0.0f;
+	m_values[Iz] = 0.0f;
+	m_values[Iw] = 0.0f;
+
+	m_values[Jx] = 0.0f;
+	m_values[Jy] = 1.0f;
+	m_values[Jz] = 0.0f;
+	m_values[Jw] = 0.0f;
+
+	m_values[Kx] = 0.0f;
+	m_values[Ky] = 0.0f;
+	m_values[Kz] = 1.0f;
+	m_values[Kw] = 0.0f;
+
+	m_values[Tx] = 0.0f;
+	m_values[Ty] = 0.0f;
+	m_values[Tz] = 0.0f;
+	m_values[Tw] = 1.0f;
+}
+
+
+Mat44::Mat44(Vec2 const& iBasis2D, Vec2 const& jBasis2D, Vec2 const& translation2D)
+{
+	m_values[Ix] = iBasis2D.x;
+	m_values[Iy] = iBasis2D.y;
+	m_values[Iz] = 0.0f;
+	m_values[Iw] = 0.0f;
+
+	m_values[Jx] = jBasis2D.x;
+	m_values[Jy] = jBasis2D.y;
+	m_values[Jz] = 0.0f;
+	m_values[Jw] = 0.0f;
+
+	m_values[Kx] = 0.0f;
+	m_values[Ky] = 0.0f;
+	m_values[Kz] = 1.0f;
+	m_values[Kw] = 0.0f;
+
+	m_values[Tx] = translation2D.x;
+	m_values[Ty] = translation2D.y;
+	m_values[Tz] = 0.0f;
+	m_values[Tw] = 1.0f;
+}
+
+
+Mat44::Mat44(Vec3 const& iBasis3D, Vec3 const& jBasis3D, Vec3 const& kBasis3D, Vec3 const& translation3D)
+{
+	m_values[Ix] = iBasis3D.x;
+	m_values[Iy] = iBasis3D.y;
+	m_values[Iz] = iBasis3D.z;
+	m_values[Iw] = 0.0f;
+
+	m_values[Jx] = jBasis3D.x;
+	m_values[Jy] = jBasis3D.y;
+	m_values[Jz] = jBasis3D.z;
+	m_values[Jw] = 0.0f;
+
+	m_values[Kx] = kBasis3D.x;
+	m_values[Ky] = kBasis3D.y;
+	m_values[Kz] = kBasis3D.z;
+	m_values[Kw] = 0.0f;
+
+	m_values[Tx] = translation3D.x;
+	m_values[Ty] = translation3D.y;
+	m_values[Tz] = translation3D.z;
+	m_values[Tw] = 1.0f;
+}
+
+
+Mat44::Mat44(Vec4 const& iBasis4D, Vec4 const& jBasis4D, Vec4 const& kBasis4D, Vec4 const& translation4D)
+{
+	m_values[Ix] = iBasis4D.x;
+	m_values[Iy] = iBasis4D.y;
+	m_values[Iz] = iBasis4D.z;
+	m_values[Iw] = iBasis4D.w;
+
+	m_values[Jx] = jBasis4D.x;
+	m_values[Jy] = jBasis4D.y;
+	m_values[Jz] = jBasis4D.z;
+	m_values[Jw] = jBasis4D.w;
+
+	m_values[Kx] = kBasis4D.x;
+	m_values[Ky] = kBasis4D.y;
+	m_values[Kz] = kBasis4D.z;
+	m_values[Kw] = kBasis4D.w;
+
+	m_values[Tx] = translation4D.x;
+	m_values[Ty] = translation4D.y;
+	m_values[Tz] = translation4D.z;
+	m_values[Tw] = translation4D.w;
+}
+
+
+Mat44::Mat44(float const* sixteenValuesBasisMajor)
+{
+	m_values[Ix] = sixteenValuesBasisMajor[0];
+	m_values[Iy] = sixteenValuesBasisMajor[1];
+	m_values[Iz] = sixteenValuesBasisMajor[2];
+	m_values[Iw] = sixteenValuesBasisMajor[3];
+
+	m_values[Jx] = sixteenValuesBasisMajor[4];
+	m_values[Jy] = sixteenValuesBasisMajor[5];
+	m_values[Jz] = sixteenValuesBasisMajor[6];
+	m_values[Jw] = sixteenValuesBasisMajor[7];
+
+	m_values[Kx] = sixteenValuesBasisMajor[8];
+	m_values[Ky] = sixteenValuesBasisMajor[9];
+	m_values[Kz] = sixteenValuesBasisMajor[10];
+	m_values[Kw] = sixteenValuesBasisMajor[11];
+
+	m_values[Tx] = sixteenValuesBasisMajor[12];
+	m_values[Ty] = sixteenValuesBasisMajor[13];
+	m_values[Tz] = sixteenValuesBasisMajor[14];
+	m_values[Tw] = sixteenValuesBasisMajor[15];
+}
+
+
+//
+//static creation functions
+//
+Mat44 const Mat44::CreateTranslation2D(Vec2 const& translationXY)
+{
+	Mat44 trans; //trans rights!
+	trans.m_values[Tx] = translationXY.x;
+	trans.m_values[Ty] = translationXY.y;
+	return trans;
+}
+
+
+Mat44 const Mat44::CreateTranslation3D(Vec3 const& translationXYZ)
+{
+	Mat44 trans;
+	trans.m_values[Tx] = translationXYZ.x;
+	trans.m_values[Ty] = translationXYZ.y;
+	trans.m_values[Tz] = translationXYZ.z;
+	return trans;
+}
+
+
+Mat44 const Mat44::CreateUniformScale2D(float uniformScaleXY)
+{
+	Mat44 scale;
+	scale.m_values[Ix] = uniformScaleXY;
+	scale.m_values[Jy] = uniformScaleXY;
+	return scale;
+}
+
+
+Mat44 const Mat44::CreateUniformScale3D(float uniformScaleXYZ)
+{
+	Mat44 scale;
+	scale.m_values[Ix] = uniformScaleXYZ;
+	scale.m_values[Jy] = uniformScaleXYZ;
+	scale.m_values[Kz] = uniformScaleXYZ;
+	return scale;
+}
+
+
+Mat44 const Mat44::CreateNonUniformScale2D(Vec2 const& nonUniformScaleXY)
+{
+	Mat44 scale;
+	scale.m_values[Ix] = nonUniformScaleXY.x;
+	scale.m_values[Jy] = nonUniformScaleXY.y;
+	return scale;
+}
+
+
+Mat44 const Mat44::CreateNonUniformScale3D(Vec3 const& nonUniformScaleXYZ)
+{
+	Mat44 scale;
+	scale.m_values[Ix] = nonUniformScaleXYZ.x;
+	scale.m_values[Jy] = nonUniformScaleXYZ.y;
+	scale.m_values[Kz] = nonUniformScaleXYZ.z;
+	return scale;
+}
+
+
+Mat44 const Mat44::CreateZRotationDegrees(float rotationDegreesAboutZ)
+{
+	Mat44 rotate;
+	float c = CosDegrees(rotationDegreesAboutZ);
+	float s = SinDegrees(rotationDegreesAboutZ);
+	rotate.m_values[Ix] = c;
+	rotate.m_values[Iy] = s;
+	rotate.m_values[Jx] = -s;
+	rotate.m_values[Jy] = c;
+	return rotate;
+}
+
+
+Mat44 const Mat44::CreateYRotationDegrees(float rotationDegreesAboutY)
+{
+	Mat44 rotate;
+	float c = CosDegrees(rotationDegreesAboutY);
+	float s = SinDegrees(rotationDegreesAboutY);
+	rotate.m_values[Ix] = c;
+	rotate.m_values[Iz] = -s;
+	rotate.m_values[Kx] = s;
+	rotate.m_values[Kz] = c;
+	return rotate;
+}
+
+
+Mat44 const Mat44::CreateXRotationDegrees(float rotationDegreesAboutX)
+{
+	Mat44 rotate;
+	float c = CosDegrees(rotationDegreesAboutX);
+	float s = SinDegrees(rotationDegreesAboutX);
+	rotate.m_values[Jy] = c;
+	rotate.m_values[Jz] = s;
+	rotate.m_values[Ky] = -s;
+	rotate.m_values[Kz] = c;
+	return rotate;
+}
+
+
+Mat44 const Mat44::CreateOrthoProjection(float left, float right, float bottom, float top, float zNear, float zFar)
+{
+	Mat44 orthoProjection;
+
+	orthoProjection.m_values[Ix] = 2 / (right - left);
+	orthoProjection.m_values[Tx] = (left + right) / (left - right);
+
+	orthoProjection.m_values[Jy] = 2 / (top - bottom);
+	orthoProjection.m_values[Ty] = (bottom + top) / (bottom - top);
+
+	orthoProjection.m_values[Kz] = 1 / (zFar - zNear);
+	orthoProjection.m_values[Tz] = -zNear / (zFar - zNear);
+
+	return orthoProjection;
+}
+
+
+Mat44 const Mat44::CreatePerspectiveProjection(float fovYDegrees, float aspect, float zNear, float zFar)
+{
+	Mat44 perspectiveProjection;
+
+	float inverseTanFovDegrees = 1.0f / TanDegrees(fovYDegrees * 0.5f);
+
+	perspectiveProjection.m_values[Ix] = inverseTanFovDegrees / aspect;
+	perspectiveProjection.m_values[Jy] = inverseTanFovDegrees;
+	perspectiveProjection.m_values[Kz] = zFar / (zFar - zNear);
+	perspectiveProjection.m_values[Tz] = -(zFar * zNear) / (zFar - zNear);
+	perspectiveProjection.m_values[Kw] = 1.0f;
+	perspectiveProjection.m_values[Tw] = 0.0f;
+
+	return perspectiveProjection;
+}
+
+
+//
+//transform functions
+//
+Vec2 const Mat44::TransformVectorQuantity2D(Vec2 const& vectorQuantityXY) const
+{
+	float newX = m_values[Ix] * vectorQuantityXY.x + m_values[Jx] * vectorQuantityXY.y;
+	float newY = m_values[Iy] * vectorQuantityXY.x + m_values[Jy] * vectorQuantityXY.y;
+
+	return Vec2(newX, newY);
+}
+
+
+Vec3 const Mat44::TransformVectorQuantity3D(Vec3 const& vectorQuantityXYZ) const
+{
+	float newX = m_values[Ix] * vectorQuantityXYZ.x + m_values[Jx] * vectorQuantityXYZ.y + m_values[Kx] * vectorQuantityXYZ.z;
+	float newY = m_values[Iy] * vectorQuantityXYZ.x + m_values[Jy] * vectorQuantityXYZ.y + m_values[Ky] * vectorQuantityXYZ.z;
+	float newZ = m_values[Iz] * vectorQuantityXYZ.x + m_values[Jz] * vectorQuantityXYZ.y + m_values[Kz] * vectorQuantityXYZ.z;
+
+	return Vec3(newX, newY, newZ);
+}
+
+
+Vec2 const Mat44::TransformPosition2D(Vec2 const& positionXY) const
+{
+	float newX = m_values[Ix] * positionXY.x + m_values[Jx] * positionXY.y + m_values[Tx];
+	float newY = m_values[Iy] * positionXY.x + m_values[Jy] * positionXY.y + m_values[Ty];
+
+	return Vec2(newX, newY);
+}
+
+
+Vec3 const Mat44::TransformPosition3D(Vec3 const& positionXYZ) const
+{
+	float newX = m_values[Ix] * positionXYZ.x + m_values[Jx] * positionXYZ.y + m_values[Kx] * positionXYZ.z + m_values[Tx];
+	float newY = m_values[Iy] * positionXYZ.x + m_values[Jy] * positionXYZ.y + m_values[Ky] * positionXYZ.z + m_values[Ty];
+	float newZ = m_values[Iz] * positionXYZ.x + m_values[Jz] * positionXYZ.y + m_values[Kz] * positionXYZ.z + m_values[Tz];
+
+	return Vec3(newX, newY, newZ);
+}
+
+
+Vec4 const Mat44::TransformHomogeneous3D(Vec4 const& homogeneousPoint3D) const
+{
+	float newX = m_values[Ix] * homogeneousPoint3D.x + m_values[Jx] * homogeneousPoint3D.y + m_values[Kx] * homogeneousPoint3D.z + m_values[Tx] * homogeneousPoint3D.w;
+	float newY = m_values[Iy] * homogeneousPoint3D.x + m_values[Jy] * homogeneousPoint3D.y + m_values[Ky] * homogeneousPoint3D.z + m_values[Ty] * homogeneousPoint3D.w;
+	float newZ = m_values[Iz] * homogeneousPoint3D.x + m_values[Jz] * homogeneousPoint3D.y + m_values[Kz] * homogeneousPoint3D.z + m_values[Tz] * homogeneousPoint3D.w;
+	float newW = m_values[Iw] * homogeneousPoint3D.x + m_values[Jw] * homogeneousPoint3D.y + m_values[Kw] * homogeneousPoint3D.z + m_values[Tw] * homogeneousPoint3D.w;
+
+	return Vec4(newX, newY, newZ, newW);
+}
+
+
+//
+//batch transform functions
+//
+void Mat44::TransformPositions3D(int numPositions, Vec3* positions) const
+{
+	TransformVec3Array(m_values, numPositions, reinterpret_cast<unsigned char*>(positions), static_cast<int>(sizeof(Vec3)), 1.0f);
+}
+
+
+void Mat44::TransformPositions3D(int numPositions, Vec3* firstPosition, int strideBytes) const
+{
+	TransformVec3Array(m_values, numPositions, reinterpret_cast<unsigned char*>(firstPosition), strideBytes, 1.0f);
+}
+
+
+void Mat44::TransformVectorQuantities3D(int numVectorQuantities, Vec3* vectorQuantities) const
+{
+	TransformVec3Array(m_values, numVectorQuantities, reinterpret_cast<unsigned char*>(vectorQuantities), static_cast<int>(sizeof(Vec3)), 0.0f);
+}
+
+
+void Mat44::TransformVectorQuantities3D(int numVectorQuantities, Vec3* firstVectorQuantity, int strideBytes) const
+{
+	TransformVec3Array(m_values, numVectorQuantities, reinterpret_cast<unsigned char*>(firstVectorQuantity), strideBytes, 0.0f);
+}
+
+
+void Mat44::TransformHomogeneousArray3D(int numPoints, Vec4* homogeneousPoints) const
+{
+#if defined(ENGINE_SIMD_X86)
+	//a Vec4 fills an SSE register exactly, AVX2 wouldn't gain anything over this
+	if (GetSIMDLevel() != SIMDLevel::SCALAR)
+	{
+		__m128 iBasis = _mm_loadu_ps(&m_values[Ix]);
+		__m128 jBasis = _mm_loadu_ps(&m_values[Jx]);
+		__m128 kBasis = _mm_loadu_ps(&m_values[Kx]);
+		__m128 translation = _mm_loadu_ps(&m_values[Tx]);
+
+		for (int pointIndex = 0; pointIndex < numPoints; pointIndex++)
+		{
+			float* point = &homogeneousPoints[pointIndex].x;
+
+			__m128 result = _mm_mul_ps(iBasis, _mm_set1_ps(point[0]));
+			result = _mm_add_ps(result, _mm_mul_ps(jBasis, _mm_set1_ps(point[1])));
+			result = _mm_add_ps(result, _mm_mul_ps(kBasis, _mm_set1_ps(point[2])));
+			result = _mm_add_ps(result, _mm_mul_ps(translation, _mm_set1_ps(point[3])));
+
+			_mm_storeu_ps(point, result);
+		}
+
+		return;
+	}
+#endif
+
+	for (int pointIndex = 0; pointIndex < numPoints; pointIndex++)
+	{
+		homogeneousPoints[pointIndex] = TransformHomogeneous3D(homogeneousPoints[pointIndex]);
+	}
+}
+
+
+//
+//batch inverse functions
+//
+void Mat44::GetInverses(int numMatrices, Mat44 const* matrices, Mat44* out_inverses)
+{
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		InvertMatrixArray_AVX2(numMatrices, reinterpret_cast<float const*>(matrices), reinterpret_cast<float*>(out_inverses));
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		for (int matrixIndex = 0; matrixIndex < numMatrices; matrixIndex++)
+		{
+			InvertMatrix_SSE2(matrices[matrixIndex].m_values, out_inverses[matrixIndex].m_values);
+		}
+		return;
+	}
+#endif
+
+	for (int matrixIndex = 0; matrixIndex < numMatrices; matrixIndex++)
+	{
+		InvertMatrix_Scalar(matrices[matrixIndex].m_values, out_inverses[matrixIndex].m_values);
+	}
+}
+
+
+void Mat44::GetAffineInverses(int numMatrices, Mat44 const* matrices, Mat44* out_inverses)
+{
+#if defined(ENGINE_SIMD_X86)
+	//the affine kernel is mostly shuffles, pairing matrices up for AVX2 wouldn't gain anything over this
+	if (GetSIMDLevel() != SIMDLevel::SCALAR)
+	{
+		for (int matrixIndex = 0; matrixIndex < numMatrices; matrixIndex++)
+		{
+			InvertAffineMatrix_SSE2(matrices[matrixIndex].m_values, out_inverses[matrixIndex].m_values);
+		}
+		return;
+	}
+#endif
+
+	for (int matrixIndex = 0; matrixIndex < numMatrices; matrixIndex++)
+	{
+		InvertAffineMatrix_Scalar(matrices[matrixIndex].m_values, out_inverses[matrixIndex].m_values);
+	}
+}
+
+
+//
+//accessors
+//
+float* Mat44::GetAsFloatArray()
+{
+	return m_values;
+}
+
+
+float const* Mat44::GetAsFloatArray() const
+{
+	return m_values;
+}
+
+
+Quaternion const Mat44::GetAsQuaternion() const
+{
+	Quaternion quat = Quaternion();
+	float t = 0.0f;
+
+	if (m_values[Kz] < 0.0f)
+	{
+		if (m_values[Ix] > m_values[Jy])
+		{
+			t = 1 + m_values[Ix] - m_values[Jy] - m_values[Kz];
+			quat = Quaternion(t, m_values[Iy] + m_values[Jx], m_values[Kx] + m_values[Iz], m_values[Jz] - m_values[Ky]);
+		}
+		else
+		{
+			t = 1 - m_values[Ix] + m_values[Jy] - m_values[Kz];
+			quat = Quaternion(m_values[Iy] + m_values[Jx], t, m_values[Jz] + m_values[Ky], m_values[Kx] - m_values[Iz]);
+		}
+	}
+	else
+	{
+		if (m_values[Ix] < -m_values[Jy])
+		{
+			t = 1 - m_values[Ix] - m_values[Jy] + m_values[Kz];
+			quat = Quaternion(m_values[Kx] + m_values[Iz], m_values[Jz] + m_values[Ky], t, m_values[Iy] - m_values[Jx]);
+		}
+		else
+		{
+			t = 1 + m_values[Ix] + m_values[Jy] + m_values[Kz];
+			quat = Quaternion(m_values[Jz] - m_values[Ky], m_values[Kx] - m_values[Iz], m_values[Iy] - m_values[Jx], t);
+		}
+	}
+
+	quat *= (0.5f / sqrtf(t));
+
+	return quat;
+}
+
+
+Vec2 const Mat44::GetIBasis2D() const
+{
+	return Vec2(m_values[Ix], m_values[Iy]);
+}
+
+
+Vec2 const Mat44::GetJBasis2D() const
+{
+	return Vec2(m_values[Jx], m_values[Jy]);
+}
+
+
+Vec2 const Mat44::GetTranslation2D() const
+{
+	return Vec2(m_values[Tx], m_values[Ty]);
+}
+
+
+Vec3 const Mat44::GetIBasis3D() const
+{
+	return Vec3(m_values[Ix], m_values[Iy], m_values[Iz]);
+}
+
+
+Vec3 const Mat44::GetJBasis3D() const
+{
+	return Vec3(m_values[Jx], m_values[Jy], m_values[Jz]);
+}
+
+
+Vec3 const Mat44::GetKBasis3D() const
+{
+	return Vec3(m_values[Kx], m_values[Ky], m_values[Kz]);
+}
+
+
+Vec3 const Mat44::GetTranslation3D() const
+{
+	return Vec3(m_values[Tx], m_values[Ty], m_values[Tz]);
+}
+
+
+Vec4 const Mat44::GetIBasis4D() const
+{
+	return Vec4(m_values[Ix], m_values[Iy], m_values[Iz], m_values[Iw]);
+}
+
+
+Vec4 const Mat44::GetJBasis4D() const
+{
+	return Vec4(m_values[Jx], m_values[Jy], m_values[Jz], m_values[Jw]);
+}
+
+
+Vec4 const Mat44::GetKBasis4D() const
+{
+	return Vec4(m_values[Kx], m_values[Ky], m_values[Kz], m_values[Kw]);
+}
+
+
+Vec4 const Mat44::GetTranslation4D() const
+{
+	return Vec4(m_values[Tx], m_values[Ty], m_values[Tz], m_values[Tw]);
+}
+
+
+float Mat44::GetDeterminant() const
+{
+	float const* m = m_values;
+	float s0 = m[0] * m[5] - m[4] * m[1];
+	float s1 = m[0] * m[6] - m[4] * m[2];
+	float s2 = m[0] * m[7] - m[4] * m[3];
+	float s3 = m[1] * m[6] - m[5] * m[2];
+	float s4 = m[1] * m[7] - m[5] * m[3];
+	float s5 = m[2] * m[7] - m[6] * m[3];
+
+	float c0 = m[8] * m[13] - m[12] * m[9];
+	float c1 = m[8] * m[14] - m[12] * m[10];
+	float c2 = m[8] * m[15] - m[12] * m[11];
+	float c3 = m[9] * m[14] - m[13] * m[10];
+	float c4 = m[9] * m[15] - m[13] * m[11];
+	float c5 = m[10] * m[15] - m[14] * m[11];
+
+	return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+
+Mat44 const Mat44::GetOrthonormalInverse() const
+{
+	Vec3 iBasis = GetIBasis3D();
+	Vec3 jBasis = GetJBasis3D();
+	Vec3 kBasis = GetKBasis3D();
+
+	Mat44 rotationMatrix;
+	rotationMatrix.SetIJK3D(iBasis, jBasis, kBasis);
+
+	rotationMatrix.Transpose();
+
+	Vec3 translation = GetTranslation3D();
+	translation.x = -translation.x;
+	translation.y = -translation.y;
+	translation.z = -translation.z;
+
+	Mat44 translationMatrix;
+	translationMatrix.SetTranslation3D(translation);
+
+	Mat44 inverseMatrix = rotationMatrix;
+	inverseMatrix.Append(translationMatrix);
+
+	return inverseMatrix;
+}
+
+
+Mat44 const Mat44::GetAffineInverse() const
+{
+	Mat44 inverseMatrix;
+#if defined(ENGINE_SIMD_X86)
+	if (GetSIMDLevel() != SIMDLevel::SCALAR)
+	{
+		InvertAffineMatrix_SSE2(m_values, inverseMatrix.m_values);
+		return inverseMatrix;
+	}
+#endif
+
+	InvertAffineMatrix_Scalar(m_values, inverseMatrix.m_values);
+	return inverseMatrix;
+}
+
+
+Mat44 const Mat44::GetInverse() const
+{
+	Mat44 inverseMatrix;
+#if defined(ENGINE_SIMD_X86)
+	if (GetSIMDLevel() != SIMDLevel::SCALAR)
+	{
+		InvertMatrix_SSE2(m_values, inverseMatrix.m_values);
+		return inverseMatrix;
+	}
+#endif
+
+	InvertMatrix_Scalar(m_values, inverseMatrix.m_values);
+	return inverseMatrix;
+}
+
+
+//
+//mutators
+//
+void Mat44::SetTranslation2D(Vec2 const& translationXY)
+{
+	m_values[Tx] = translationXY.x;
+	m_values[Ty] = translationXY.y;
+	m_values[Tz] = 0.0f;
+	m_values[Tw] = 1.0f;
+}
+
+
+void Mat44::SetTranslation3D(Vec3 const& translationXYZ)
+{
+	m_values[Tx] = translationXYZ.x;
+	m_values[Ty] = translationXYZ.y;
+	m_values[Tz] = translationXYZ.z;
+	m_values[Tw] = 1.0f;
+}
+
+
+void Mat44::SetIJ2D(Vec2 const& iBasis2D, Vec2 const& jBasis2D)
+{
+	m_values[Ix] = iBasis2D.x;
+	m_values[Iy] = iBasis2D.y;
+	m_values[Iz] = 0.0f;
+	m_values[Iw] = 0.0f;
+
+	m_values[Jx] = jBasis2D.x;
+	m_values[Jy] = jBasis2D.y;
+	m_values[Jz] = 0.0f;
+	m_values[Jw] = 0.0f;
+}
+
+
+void Mat44::SetIJT2D(Vec2 const& iBasis2D, Vec2 const& jBasis2D, Vec2 const& translationXY)
+{
+	m_values[Ix] = iBasis2D.x;
+	m_values[Iy] = iBasis2D.y;
+	m_values[Iz] = 0.0f;
+	m_values[Iw] = 0.0f;
+
+	m_values[Jx] = jBasis2D.x;
+	m_values[Jy] = jBasis2D.y;
+	m_values[Jz] = 0.0f;
+	m_values[Jw] = 0.0f;
+
+	m_values[Tx] = translationXY.x;
+	m_values[Ty] = translationXY.y;
+	m_values[Tz] = 0.0f;
+	m_values[Tw] = 1.0f;
+}
+
+
+void Mat44::SetIJK3D(Vec3 const& iBasis3D, Vec3 const& jBasis3D, Vec3 const& kBasis3D)
+{
+	m_values[Ix] = iBasis3D.x;
+	m_values[Iy] = iBasis3D.y;
+	m_values[Iz] = iBasis3D.z;
+	m_values[Iw] = 0.0f;
+						 
+	m_values[Jx] = jBasis3D.x;
+	m_values[Jy] = jBasis3D.y;
+	m_values[Jz] = jBasis3D.z;
+	m_values[Jw] = 0.0f;
+
+	m_values[Kx] = kBasis3D.x;
+	m_values[Ky] = kBasis3D.y;
+	m_values[Kz] = kBasis3D.z;
+	m_values[Kw] = 0.0f;
+}
+
+void Mat44::SetIJKT3D(Vec3 const& iBasis3D, Vec3 const& jBasis3D, Vec3 const& kBasis3D, Vec3 const& translationXYZ)
+{
+	m_values[Ix] = iBasis3D.x;
+	m_values[Iy] = iBasis3D.y;
+	m_values[Iz] = iBasis3D.z;
+	m_values[Iw] = 0.0f;
+
+	m_values[Jx] = jBasis3D.x;
+	m_values[Jy] = jBasis3D.y;
+	m_values[Jz] = jBasis3D.z;
+	m_values[Jw] = 0.0f;
+
+	m_values[Kx] = kBasis3D.x;
+	m_values[Ky] = kBasis3D.y;
+	m_values[Kz] = kBasis3D.z;
+	m_values[Kw] = 0.0f;
+
+	m_values[Tx] = translationXYZ.x;
+	m_values[Ty] = translationXYZ.y;
+	m_values[Tz] = translationXYZ.z;
+	m_values[Tw] = 1.0f;
+}
+
+
+void Mat44::SetIJKT4D(Vec4 const& iBasis4D, Vec4 const& jBasis4D, Vec4 const& kBasis4D, Vec4 const& translation4D)
+{
+	m_values[Ix] = iBasis4D.x;
+	m_values[Iy] = iBasis4D.y;
+	m_values[Iz] = iBasis4D.z;
+	m_values[Iw] = iBasis4D.w;
+
+	m_values[Jx] = jBasis4D.x;
+	m_values[Jy] = jBasis4D.y;
+	m_values[Jz] = jBasis4D.z;
+	m_values[Jw] = jBasis4D.w;
+
+	m_values[Kx] = kBasis4D.x;
+	m_values[Ky] = kBasis4D.y;
+	m_values[Kz] = kBasis4D.z;
+	m_values[Kw] = kBasis4D.w;
+
+	m_values[Tx] = translation4D.x;
+	m_values[Ty] = translation4D.y;
+	m_values[Tz] = translation4D.z;
+	m_values[Tw] = translation4D.w;
+}
+
+
+void Mat44::Transpose()
+{
+	Mat44 copyOfThis = *this;
+	float const* oldValues = copyOfThis.m_values;
+
+	m_values[Iy] = oldValues[Jx];
+	m_values[Iz] = oldValues[Kx];
+	m_values[Iw] = oldValues[Tx];
+
+	m_values[Jx] = oldValues[Iy];
+	m_values[Jz] = oldValues[Ky];
+	m_values[Jw] = oldValues[Ty];
+
+	m_values[Kx] = oldValues[Iz];
+	m_values[Ky] = oldValues[Jz];
+	m_values[Kw] = oldValues[Tz];
+
+	m_values[Tx] = oldValues[Iw];
+	m_values[Ty] = oldValues[Jw];
+	m_values[Tz] = oldValues[Kw];
+}
+
+
+void Mat44::Orthonormalize_XFwd_YLeft_ZUp()
+{
+	Vec3 iBasis = GetIBasis3D();
+	Vec3 jBasis = GetJBasis3D();
+	Vec3 kBasis = GetKBasis3D();
+
+	iBasis.Normalize();
+	
+	float kDotI = DotProduct3D(kBasis, iBasis);
+	Vec3 kProjectedOnI = iBasis * kDotI;
+	kBasis -= kProjectedOnI;
+	kBasis.Normalize();
+
+	float jDotI = DotProduct3D(jBasis, iBasis);
+	Vec3 jProjectedOnI = iBasis * jDotI;
+	jBasis -= jProjectedOnI;
+	float jDotK = DotProduct3D(jBasis, kBasis);
+	Vec3 jProjectedOnK = kBasis * jDotK;
+	jBasis -= jProjectedOnK;
+	jBasis.Normalize();
+
+	SetIJK3D(iBasis, jBasis, kBasis);
+}
+
+
+//
+//append functions
+//
+void Mat44::Append(Mat44 const& matToAppend)
+{
+#if defined(ENGINE_SIMD_X86)
+	//each new basis is the old bases weighted by the appended basis, same multiply/add order as the scalar version below
+	__m128 oldIBasis = _mm_loadu_ps(&m_values[Ix]);
+	__m128 oldJBasis = _mm_loadu_ps(&m_values[Jx]);
+	__m128 oldKBasis = _mm_loadu_ps(&m_values[Kx]);
+	__m128 oldTranslation = _mm_loadu_ps(&m_values[Tx]);
+
+	//load the appended matrix up front too, it may be this matrix
+	__m128 appendedBases[4];
+	for (int basisIndex = 0; basisIndex < 4; basisIndex++)
+	{
+		appendedBases[basisIndex] = _mm_loadu_ps(&matToAppend.m_values[basisIndex * 4]);
+	}
+
+	for (int basisIndex = 0; basisIndex < 4; basisIndex++)
+	{
+		__m128 appendedBasis = appendedBases[basisIndex];
+
+		__m128 newBasis = _mm_mul_ps(oldIBasis, _mm_shuffle_ps(appendedBasis, appendedBasis, _MM_SHUFFLE(0, 0, 0, 0)));
+		newBasis = _mm_add_ps(newBasis, _mm_mul_ps(oldJBasis, _mm_shuffle_ps(appendedBasis, appendedBasis, _MM_SHUFFLE(1, 1, 1, 1))));
+		newBasis = _mm_add_ps(newBasis, _mm_mul_ps(oldKBasis, _mm_shuffle_ps(appendedBasis, appendedBasis, _MM_SHUFFLE(2, 2, 2, 2))));
+		newBasis = _mm_add_ps(newBasis, _mm_mul_ps(oldTranslation, _mm_shuffle_ps(appendedBasis, appendedBasis, _MM_SHUFFLE(3, 3, 3, 3))));
+
+		_mm_storeu_ps(&m_values[basisIndex * 4], newBasis);
+	}
+#else
+	Mat44 copyOfThis = *this;
+	float const* oldValues = copyOfThis.m_values;
+	float const* newValues = matToAppend.m_values;
+
+	m_values[Ix] = oldValues[Ix] * newValues[Ix] + oldValues[Jx] * newValues[Iy] + oldValues[Kx] * newValues[Iz] + oldValues[Tx] * newValues[Iw];
+	m_values[Iy] = oldValues[Iy] * newValues[Ix] + oldValues[Jy] * newValues[Iy] + oldValues[Ky] * newValues[Iz] + oldValues[Ty] * newValues[Iw];
+	m_values[Iz] = oldValues[Iz] * newValues[Ix] + oldValues[Jz] * newValues[Iy] + oldValues[Kz] * newValues[Iz] + oldValues[Tz] * newValues[Iw];
+	m_values[Iw] = oldValues[Iw] * newValues[Ix] + oldValues[Jw] * newValues[Iy] + oldValues[Kw] * newValues[Iz] + oldValues[Tw] * newValues[Iw];
+
+	m_values[Jx] = oldValues[Ix] * newValues[Jx] + oldValues[Jx] * newValues[Jy] + oldValues[Kx] * newValues[Jz] + oldValues[Tx] * newValues[Jw];
+	m_values[Jy] = oldValues[Iy] * newValues[Jx] + oldValues[Jy] * newValues[Jy] + oldValues[Ky] * newValues[Jz] + oldValues[Ty] * newValues[Jw];
+	m_values[Jz] = oldValues[Iz] * newValues[Jx] + oldValues[Jz] * newValues[Jy] + oldValues[Kz] * newValues[Jz] + oldValues[Tz] * newValues[Jw];
+	m_values[Jw] = oldValues[Iw] * newValues[Jx] + oldValues[Jw] * newValues[Jy] + oldValues[Kw] * newValues[Jz] + oldValues[Tw] * newValues[Jw];
+
+	m_values[Kx] = oldValues[Ix] * newValues[Kx] + oldValues[Jx] * newValues[Ky] + oldValues[Kx] * newValues[Kz] + oldValues[Tx] * newValues[Kw];
+	m_values[Ky] = oldValues[Iy] * newValues[Kx] + oldValues[Jy] * newValues[Ky] + oldValues[Ky] * newValues[Kz] + oldValues[Ty] * newValues[Kw];
+	m_values[Kz] = oldValues[Iz] * newValues[Kx] + oldValues[Jz] * newValues[Ky] + oldValues[Kz] * newValues[Kz] + oldValues[Tz] * newValues[Kw];
+	m_values[Kw] = oldValues[Iw] * newValues[Kx] + oldValues[Jw] * newValues[Ky] + oldValues[Kw] * newValues[Kz] + oldValues[Tw] * newValues[Kw];
+
+	m_values[Tx] = oldValues[Ix] * newValues[Tx] + oldValues[Jx] * newValues[Ty] + oldValues[Kx] * newValues[Tz] + oldValues[Tx] * newValues[Tw];
+	m_values[Ty] = oldValues[Iy] * newValues[Tx] + oldValues[Jy] * newValues[Ty] + oldValues[Ky] * newValues[Tz] + oldValues[Ty] * newValues[Tw];
+	m_values[Tz] = oldValues[Iz] * newValues[Tx] + oldValues[Jz] * newValues[Ty] + oldValues[Kz] * newValues[Tz] + oldValues[Tz] * newValues[Tw];
+	m_values[Tw] = oldValues[Iw] * newValues[Tx] + oldValues[Jw] * newValues[Ty] + oldValues[Kw] * newValues[Tz] + oldValues[Tw] * newValues[Tw];
+#endif
+}
+
+
+void Mat44::AppendZRotation(float degreesRotationAboutZ)
+{
+	Mat44 copyOfThis = *this;
+	float const* oldValues = copyOfThis.m_values;
+
+	float c = CosDegrees(degreesRotationAboutZ);
+	float s = SinDegrees(degreesRotationAboutZ);
+
+	m_values[Ix] = oldValues[Ix] * c + oldValues[Jx] * s;
+	m_values[Iy] = oldValues[Iy] * c + oldValues[Jy] * s;
+	m_values[Iz] = oldValues[Iz] * c + oldValues[Jz] * s;
+	m_values[Iw] = oldValues[Iw] * c + oldValues[Jw] * s;
+
+	m_values[Jx] = oldValues[Ix] * -s + oldValues[Jx] * c;
+	m_values[Jy] = oldValues[Iy] * -s + oldValues[Jy] * c;
+	m_values[Jz] = oldValues[Iz] * -s + oldValues[Jz] * c;
+	m_values[Jw] = oldValues[Iw] * -s + oldValues[Jw] * c;
+}
+
+
+void Mat44::AppendYRotation(float degreesRotationAboutY)
+{
+	Mat44 copyOfThis = *this;
+	float const* oldValues = copyOfThis.m_values;
+
+	float c = CosDegrees(degreesRotationAboutY);
+	float s = SinDegrees(degreesRotationAboutY);
+
+	m_values[Ix] = oldValues[Ix] * c + oldValues[Kx] * -s;
+	m_values[Iy] = oldValues[Iy] * c + oldValues[Ky] * -s;
+	m_values[Iz] = oldValues[Iz] * c + oldValues[Kz] * -s;
+	m_values[Iw] = oldValues[Iw] * c + oldValues[Kw] * -s;
+
+	m_values[Kx] = oldValues[Ix] * s + oldValues[Kx] * c;
+	m_values[Ky] = oldValues[Iy] * s + oldValues[Ky] * c;
+	m_values[Kz] = oldValues[Iz] * s + oldValues[Kz] * c;
+	m_values[Kw] = oldValues[Iw] * s + oldValues[Kw] * c;
+}
+
+
+void Mat44::AppendXRotation(float degreesRotationAboutX)
+{
+	Mat44 copyOfThis = *this;
+	float const* oldValues = copyOfThis.m_values;
+
+	float c = CosDegrees(degreesRotationAboutX);
+	float s = SinDegrees(degreesRotationAboutX);
+
+	m_values[Jx] = oldValues[Jx] * c + oldValues[Kx] * s;
+	m_values[Jy] = oldValues[Jy] * c + oldValues[Ky] * s;
+	m_values[Jz] = oldValues[Jz] * c + oldValues[Kz] * s;
+	m_values[Jw] = oldValues[Jw] * c + oldValues[Kw] * s;
+
+	m_values[Kx] = oldValues[Jx] * -s + oldValues[Kx] * c;
+	m_values[Ky] = oldValues[Jy] * -s + oldValues[Ky] * c;
+	m_values[Kz] = oldValues[Jz] * -s + oldValues[Kz] * c;
+	m_values[Kw] = oldValues[Jw] * -s + oldValues[Kw] * c;
+}
+
+
+void Mat44::AppendTranslation2D(Vec2 const& translationXY)
+{
+	Mat44 copyOfThis = *this;
+
+	float const* oldValues = copyOfThis.m_values;
+
+	m_values[Tx] = oldValues[Ix] * translationXY.x + oldValues[Jx] * translationXY.y + oldValues[Tx];
+	m_values[Ty] = oldValues[Iy] * translationXY.x + oldValues[Jy] * translationXY.y + oldValues[Ty];
+	m_values[Tz] = oldValues[Iz] * translationXY.x + oldValues[Jz] * translationXY.y + oldValues[Tz];
+	m_values[Tw] = oldValues[Iw] * translationXY.x + oldValues[Jw] * translationXY.y + oldValues[Tw];
+}
+
+
+void Mat44::AppendTranslation3D(Vec3 const& translationXYZ)
+{
+	Mat44 copyOfThis = *this;
+
+	float const* oldValues = copyOfThis.m_values;
+	
+	m_values[Tx] = oldValues[Ix] * translationXYZ.x + oldValues[Jx] * translationXYZ.y + oldValues[Kx] * translationXYZ.z + oldValues[Tx];
+	m_values[Ty] = oldValues[Iy] * translationXYZ.x + oldValues[Jy] * translationXYZ.y + oldValues[Ky] * translationXYZ.z + oldValues[Ty];
+	m_values[Tz] = oldValues[Iz] * translationXYZ.x + oldValues[Jz] * translationXYZ.y + oldValues[Kz] * translationXYZ.z + oldValues[Tz];
+	m_values[Tw] = oldValues[Iw] * translationXYZ.x + oldValues[Jw] * translationXYZ.y + oldValues[Kw] * translationXYZ.z + oldValues[Tw];
+}
+
+
+void Mat44::AppendScaleUniform2D(float uniformScaleXY)
+{
+	m_values[Ix] *= uniformScaleXY;
+	m_values[Iy] *= uniformScaleXY;
+	m_values[Iz] *= uniformScaleXY;
+	m_values[Iw] *= uniformScaleXY;
+				    
+	m_values[Jx] *= uniformScaleXY;
+	m_values[Jy] *= uniformScaleXY;
+	m_values[Jz] *= uniformScaleXY;
+	m_values[Jw] *= uniformScaleXY;
+}
+
+
+void Mat44::AppendScaleUniform3D(float uniformScaleXYZ)
+{
+	m_values[Ix] *= uniformScaleXYZ;
+	m_values[Iy] *= uniformScaleXYZ;
+	m_values[Iz] *= uniformScaleXYZ;
+	m_values[Iw] *= uniformScaleXYZ;
+
+	m_values[Jx] *= uniformScaleXYZ;
+	m_values[Jy] *= uniformScaleXYZ;
+	m_values[Jz] *= uniformScaleXYZ;
+	m_values[Jw] *= uniformScaleXYZ;
+
+	m_values[Kx] *= uniformScaleXYZ;
+	m_values[Ky] *= uniformScaleXYZ;
+	m_values[Kz] *= uniformScaleXYZ;
+	m_values[Kw] *= uniformScaleXYZ;
+}
+
+
+void Mat44::AppendScaleNonUniform2D(Vec2 const& nonUniformScaleXY)
+{
+	m_values[Ix] *= nonUniformScaleXY.x;
+	m_values[Iy] *= nonUniformScaleXY.x;
+	m_values[Iz] *= nonUniformScaleXY.x;
+	m_values[Iw] *= nonUniformScaleXY.x;
+
+	m_values[Jx] *= nonUniformScaleXY.y;
+	m_values[Jy] *= nonUniformScaleXY.y;
+	m_values[Jz] *= nonUniformScaleXY.y;
+	m_values[Jw] *= nonUniformScaleXY.y;
+}
+
+
+void Mat44::AppendScaleNonUniform3D(Vec3 const& nonUniformScaleXYZ)
+{
+	m_values[Ix] *= nonUniformScaleXYZ.x;
+	m_values[Iy] *= nonUniformScaleXYZ.x;
+	m_values[Iz] *= nonUniformScaleXYZ.x;
+	m_values[Iw] *= nonUniformScaleXYZ.x;
+
+	m_values[Jx] *= nonUniformScaleXYZ.y;
+	m_values[Jy] *= nonUniformScaleXYZ.y;
+	m_values[Jz] *= nonUniformScaleXYZ.y;
+	m_values[Jw] *= nonUniformScaleXYZ.y;
+
+	m_values[Kx] *= nonUniformScaleXYZ.z;
+	m_values[Ky] *= nonUniformScaleXYZ.z;
+	m_values[Kz] *= nonUniformScaleXYZ.z;
+	m_values[Kw] *= nonUniformScaleXYZ.z;
+}
@@ -0,0 +1,759 @@
+#include "Engine/Math/NoiseUtils.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/RawNoiseSIMD.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/JobSystem/ParallelUtils.hpp"
+#include "ThirdParty/Squirrel/RawNoise.hpp"
+#include <math.h>
+#include <vector>
+
+
+//these mirror SmoothNoise.cpp and RawNoise.hpp, the grids only match the single-sample functions while they agree
+constexpr float		   NOISE_OCTAVE_OFFSET = 0.636764989593174f;
+constexpr unsigned int NOISE_PRIME_Y = 198491317;
+constexpr unsigned int NOISE_PRIME_Z = 6542989;
+constexpr float		   PERLIN_2D_GRADIENT_LONG_LEG = 0.923879533f;
+constexpr float		   PERLIN_2D_GRADIENT_SHORT_LEG = 0.382683432f;
+constexpr float		   PERLIN_3D_GRADIENT_COMPONENT = 0.57735026918962576450914878050196f;
+constexpr float		   PERLIN_2D_NORMALIZER = 1.f / 0.662578106f;
+constexpr float		   PERLIN_3D_NORMALIZER = 1.f / 0.793856621f;
+
+//rows are handed to the job workers in chunks of about this many samples
+constexpr int NOISE_GRID_SAMPLES_PER_CHUNK = 4096;
+
+
+//enums
+enum class NoiseGridType
+{
+	FRACTAL_2D,
+	PERLIN_2D,
+	FRACTAL_3D,
+	PERLIN_3D,
+	COUNT
+};
+
+
+//lattice cells along one grid axis for every octave, worked out once and shared by every row that crosses the axis
+struct NoiseGridAxis
+{
+//public member variables
+public:
+	int				   m_numSamples = 0;
+	std::vector<int>   m_cellMins;					//all arrays are [octaveIndex * m_numSamples + sampleIndex]
+	std::vector<float> m_displacementsFromMins;
+	std::vector<float> m_displacementsFromMaxs;
+	std::vector<float> m_highWeights;				//east, north or above
+	std::vector<float> m_lowWeights;				//west, south or below
+};
+
+
+//one octave's x axis data, what the row kernels walk along
+struct NoiseGridColumns
+{
+//public member variables
+public:
+	int const*	 m_cellMins = nullptr;
+	float const* m_displacementsFromMins = nullptr;
+	float const* m_displacementsFromMaxs = nullptr;
+	float const* m_eastWeights = nullptr;
+	float const* m_westWeights = nullptr;
+};
+
+
+//one octave's data for a row of samples along x, the same for every sample in the row
+struct NoiseGridRowOctave
+{
+//public member variables
+public:
+	unsigned int m_cornerOffsets[4] = {};	//lattice hash offsets (PRIME_Y * y + PRIME_Z * z) of the below south, below north, above south and above north corners
+	float		 m_yFromMin = 0.f;
+	float		 m_yFromMax = 0.f;
+	float		 m_northWeight = 0.f;
+	float		 m_southWeight = 0.f;
+	float		 m_zFromMin = 0.f;
+	float		 m_zFromMax = 0.f;
+	float		 m_aboveWeight = 0.f;
+	float		 m_belowWeight = 0.f;
+	unsigned int m_seed = 0;
+	float		 m_amplitude = 0.f;
+};
+
+
+//
+//static functions
+//
+static Vec2 const GetPerlinGradient2d(unsigned int noise)
+{
+	static Vec2 const gradients[8] =
+	{
+		Vec2(+PERLIN_2D_GRADIENT_LONG_LEG, +PERLIN_2D_GRADIENT_SHORT_LEG),
+		Vec2(+PERLIN_2D_GRADIENT_SHORT_LEG, +PERLIN_2D_GRADIENT_LONG_LEG),
+		Vec2(-PERLIN_2D_GRADIENT_SHORT_LEG, +PERLIN_2D_GRADIENT_LONG_LEG),
+		Vec2(-PERLIN_2D_GRADIENT_LONG_LEG, +PERLIN_2D_GRADIENT_SHORT_LEG),
+		Vec2(-PERLIN_2D_GRADIENT_LONG_LEG, -PERLIN_2D_GRADIENT_SHORT_LEG),
+		Vec2(-PERLIN_2D_GRADIENT_SHORT_LEG, -PERLIN_2D_GRADIENT_LONG_LEG),
+		Vec2(+PERLIN_2D_GRADIENT_SHORT_LEG, -PERLIN_2D_GRADIENT_LONG_LEG),
+		Vec2(+PERLIN_2D_GRADIENT_LONG_LEG, -PERLIN_2D_GRADIENT_SHORT_LEG)
+	};
+
+	return gradients[noise & 0x00000007];
+}
+
+
+static Vec3 const GetPerlinGradient3d(unsigned int noise)
+{
+	//cube corner directions, bits 0, 1, 2 of the noise flip x, y, z
+	float x = (noise & 0x00000001) ? -PERLIN_3D_GRADIENT_COMPONENT : PERLIN_3D_GRADIENT_COMPONENT;
+	float y = (noise & 0x00000002) ? -PERLIN_3D_GRADIENT_COMPONENT : PERLIN_3D_GRADIENT_COMPONENT;
+	float z = (noise & 0x00000004) ? -PERLIN_3D_GRADIENT_COMPONENT : PERLIN_3D_GRADIENT_COMPONENT;
+	return Vec3(x, y, z);
+}
+
+
+//x + offset is the same wrapped sum the Get2d/3dNoise functions hash
+static int GetLatticeIndex(int cellX, unsigned int cornerOffset)
+{
+	return static_cast<int>(static_cast<unsigned int>(cellX) + cornerOffset);
+}
+
+
+static float GetFractalNoise2dOctave(NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int sampleIndex)
+{
+	int westX = columns.m_cellMins[sampleIndex];
+	int eastX = westX + 1;
+	float valueSouthWest = Get1dNoiseZeroToOne(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed);
+	float valueSouthEast = Get1dNoiseZeroToOne(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed);
+	float valueNorthWest = Get1dNoiseZeroToOne(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed);
+	float valueNorthEast = Get1dNoiseZeroToOne(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed);
+
+	float weightEast = columns.m_eastWeights[sampleIndex];
+	float weightWest = columns.m_westWeights[sampleIndex];
+	float blendSouth = (weightEast * valueSouthEast) + (weightWest * valueSouthWest);
+	float blendNorth = (weightEast * valueNorthEast) + (weightWest * valueNorthWest);
+	float blendTotal = (rowOctave.m_southWeight * blendSouth) + (rowOctave.m_northWeight * blendNorth);
+	return 2.f * (blendTotal - 0.5f);
+}
+
+
+static float GetPerlinNoise2dOctave(NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int sampleIndex)
+{
+	int westX = columns.m_cellMins[sampleIndex];
+	int eastX = westX + 1;
+	Vec2 gradientSouthWest = GetPerlinGradient2d(Get1dNoiseUint(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed));
+	Vec2 gradientSouthEast = GetPerlinGradient2d(Get1dNoiseUint(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed));
+	Vec2 gradientNorthWest = GetPerlinGradient2d(Get1dNoiseUint(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed));
+	Vec2 gradientNorthEast = GetPerlinGradient2d(Get1dNoiseUint(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed));
+
+	float xFromMin = columns.m_displacementsFromMins[sampleIndex];
+	float xFromMax = columns.m_displacementsFromMaxs[sampleIndex];
+	float dotSouthWest = DotProduct2D(gradientSouthWest, Vec2(xFromMin, rowOctave.m_yFromMin));
+	float dotSouthEast = DotProduct2D(gradientSouthEast, Vec2(xFromMax, rowOctave.m_yFromMin));
+	float dotNorthWest = DotProduct2D(gradientNorthWest, Vec2(xFromMin, rowOctave.m_yFromMax));
+	float dotNorthEast = DotProduct2D(gradientNorthEast, Vec2(xFromMax, rowOctave.m_yFromMax));
+
+	float weightEast = columns.m_eastWeights[sampleIndex];
+	float weightWest = columns.m_westWeights[sampleIndex];
+	float blendSouth = (weightEast * dotSouthEast) + (weightWest * dotSouthWest);
+	float blendNorth = (weightEast * dotNorthEast) + (weightWest * dotNorthWest);
+	float blendTotal = (rowOctave.m_southWeight * blendSouth) + (rowOctave.m_northWeight * blendNorth);
+	return blendTotal * PERLIN_2D_NORMALIZER;
+}
+
+
+static float GetFractalNoise3dOctave(NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int sampleIndex)
+{
+	int westX = columns.m_cellMins[sampleIndex];
+	int eastX = westX + 1;
+	float belowSouthWest = Get1dNoiseZeroToOne(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed);
+	float belowSouthEast = Get1dNoiseZeroToOne(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed);
+	float belowNorthWest = Get1dNoiseZeroToOne(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed);
+	float belowNorthEast = Get1dNoiseZeroToOne(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed);
+	float aboveSouthWest = Get1dNoiseZeroToOne(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[2]), rowOctave.m_seed);
+	float aboveSouthEast = Get1dNoiseZeroToOne(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[2]), rowOctave.m_seed);
+	float aboveNorthWest = Get1dNoiseZeroToOne(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[3]), rowOctave.m_seed);
+	float aboveNorthEast = Get1dNoiseZeroToOne(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[3]), rowOctave.m_seed);
+
+	float weightEast = columns.m_eastWeights[sampleIndex];
+	float weightWest = columns.m_westWeights[sampleIndex];
+	float blendBelowSouth = (weightEast * belowSouthEast) + (weightWest * belowSouthWest);
+	float blendBelowNorth = (weightEast * belowNorthEast) + (weightWest * belowNorthWest);
+	float blendAboveSouth = (weightEast * aboveSouthEast) + (weightWest * aboveSouthWest);
+	float blendAboveNorth = (weightEast * aboveNorthEast) + (weightWest * aboveNorthWest);
+	float blendBelow = (rowOctave.m_southWeight * blendBelowSouth) + (rowOctave.m_northWeight * blendBelowNorth);
+	float blendAbove = (rowOctave.m_southWeight * blendAboveSouth) + (rowOctave.m_northWeight * blendAboveNorth);
+	float blendTotal = (rowOctave.m_belowWeight * blendBelow) + (rowOctave.m_aboveWeight * blendAbove);
+	return 2.f * (blendTotal - 0.5f);
+}
+
+
+static float GetPerlinNoise3dOctave(NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int sampleIndex)
+{
+	int westX = columns.m_cellMins[sampleIndex];
+	int eastX = westX + 1;
+	Vec3 gradientBelowSW = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed));
+	Vec3 gradientBelowSE = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[0]), rowOctave.m_seed));
+	Vec3 gradientBelowNW = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed));
+	Vec3 gradientBelowNE = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[1]), rowOctave.m_seed));
+	Vec3 gradientAboveSW = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[2]), rowOctave.m_seed));
+	Vec3 gradientAboveSE = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[2]), rowOctave.m_seed));
+	Vec3 gradientAboveNW = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(westX, rowOctave.m_cornerOffsets[3]), rowOctave.m_seed));
+	Vec3 gradientAboveNE = GetPerlinGradient3d(Get1dNoiseUint(GetLatticeIndex(eastX, rowOctave.m_cornerOffsets[3]), rowOctave.m_seed));
+
+	float xFromMin = columns.m_displacementsFromMins[sampleIndex];
+	float xFromMax = columns.m_displacementsFromMaxs[sampleIndex];
+	float dotBelowSW = DotProduct3D(gradientBelowSW, Vec3(xFromMin, rowOctave.m_yFromMin, rowOctave.m_zFromMin));
+	float dotBelowSE = DotProduct3D(gradientBelowSE, Vec3(xFromMax, rowOctave.m_yFromMin, rowOctave.m_zFromMin));
+	float dotBelowNW = DotProduct3D(gradientBelowNW, Vec3(xFromMin, rowOctave.m_yFromMax, rowOctave.m_zFromMin));
+	float dotBelowNE = DotProduct3D(gradientBelowNE, Vec3(xFromMax, rowOctave.m_yFromMax, rowOctave.m_zFromMin));
+	float dotAboveSW = DotProduct3D(gradientAboveSW, Vec3(xFromMin, rowOctave.m_yFromMin, rowOctave.m_zFromMax));
+	float dotAboveSE = DotProduct3D(gradientAboveSE, Vec3(xFromMax, rowOctave.m_yFromMin, rowOctave.m_zFromMax));
+	float dotAboveNW = DotProduct3D(gradientAboveNW, Vec3(xFromMin, rowOctave.m_yFromMax, rowOctave.m_zFromMax));
+	float dotAboveNE = DotProduct3D(gradientAboveNE, Vec3(xFromMax, rowOctave.m_yFromMax, rowOctave.m_zFromMax));
+
+	float weightEast = columns.m_eastWeights[sampleIndex];
+	float weightWest = columns.m_westWeights[sampleIndex];
+	float blendBelowSouth = (weightEast * dotBelowSE) + (weightWest * dotBelowSW);
+	float blendBelowNorth = (weightEast * dotBelowNE) + (weightWest * dotBelowNW);
+	float blendAboveSouth = (weightEast * dotAboveSE) + (weightWest * dotAboveSW);
+	float blendAboveNorth = (weightEast * dotAboveNE) + (weightWest * dotAboveNW);
+	float blendBelow = (rowOctave.m_southWeight * blendBelowSouth) + (rowOctave.m_northWeight * blendBelowNorth);
+	float blendAbove = (rowOctave.m_southWeight * blendAboveSouth) + (rowOctave.m_northWeight * blendAboveNorth);
+	float blendTotal = (rowOctave.m_belowWeight * blendBelow) + (rowOctave.m_aboveWeight * blendAbove);
+	return blendTotal * PERLIN_3D_NORMALIZER;
+}
+
+
+static float GetNoiseOctave(NoiseGridType gridType, NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int sampleIndex)
+{
+	switch (gridType)
+	{
+		case NoiseGridType::FRACTAL_2D:	return GetFractalNoise2dOctave(columns, rowOctave, sampleIndex);
+		case NoiseGridType::PERLIN_2D:	return GetPerlinNoise2dOctave(columns, rowOctave, sampleIndex);
+		case NoiseGridType::FRACTAL_3D:	return GetFractalNoise3dOctave(columns, rowOctave, sampleIndex);
+		default:						return GetPerlinNoise3dOctave(columns, rowOctave, sampleIndex);
+	}
+}
+
+
+static void AddNoiseRowOctave_Scalar(NoiseGridType gridType, NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int numSamples, float* inout_totals, int firstIndex)
+{
+	for (int sampleIndex = firstIndex; sampleIndex < numSamples; sampleIndex++)
+	{
+		inout_totals[sampleIndex] += GetNoiseOctave(gridType, columns, rowOctave, sampleIndex) * rowOctave.m_amplitude;
+	}
+}
+
+
+static void RenormalizeNoiseRow_Scalar(float totalAmplitude, int numSamples, float* inout_totals, int firstIndex)
+{
+	for (int sampleIndex = firstIndex; sampleIndex < numSamples; sampleIndex++)
+	{
+		float totalNoise = inout_totals[sampleIndex] / totalAmplitude;
+		totalNoise = (totalNoise * 0.5f) + 0.5f;
+		totalNoise = SmoothStep3(totalNoise);
+		inout_totals[sampleIndex] = (totalNoise * 2.0f) - 1.f;
+	}
+}
+
+
+//the SIMD kernels below avoid FMA and keep Squirrel's operation order, so every SIMD level gives bit-identical results to the scalar functions
+//(the AVX2 ones are tagged SIMD_AVX2_EXACT_FUNCTION so the compiler can't contract their multiply-adds either)
+#if defined(ENGINE_SIMD_X86)
+static inline __m128 GetCornerValues_SSE2(__m128i cellXs, unsigned int cornerOffset, __m128i seed)
+{
+	return GetNoiseZeroToOne_SSE2(GetNoiseUints_SSE2(_mm_add_epi32(cellXs, _mm_set1_epi32(static_cast<int>(cornerOffset))), seed));
+}
+
+
+static inline __m128 GetPerlinCornerDots2d_SSE2(__m128i cellXs, unsigned int cornerOffset, __m128i seed, __m128 xDisplacements, __m128 yDisplacements)
+{
+	__m128i noiseUints = GetNoiseUints_SSE2(_mm_add_epi32(cellXs, _mm_set1_epi32(static_cast<int>(cornerOffset))), seed);
+
+	//the 8 gradients sit at 22.5 + 45k degrees, so each component is the long or short leg (short x when bits 0 and 1 differ)
+	//with x negated when bits 1 and 2 differ and y negated when bit 2 is set
+	__m128i one = _mm_set1_epi32(1);
+	__m128 isShortX = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(_mm_xor_si128(noiseUints, _mm_srli_epi32(noiseUints, 1)), one), one));
+	__m128 longLeg = _mm_set1_ps(PERLIN_2D_GRADIENT_LONG_LEG);
+	__m128 shortLeg = _mm_set1_ps(PERLIN_2D_GRADIENT_SHORT_LEG);
+	__m128 gradientXs = _mm_or_ps(_mm_and_ps(isShortX, shortLeg), _mm_andnot_ps(isShortX, longLeg));
+	__m128 gradientYs = _mm_or_ps(_mm_and_ps(isShortX, longLeg), _mm_andnot_ps(isShortX, shortLeg));
+	gradientXs = _mm_xor_ps(gradientXs, _mm_castsi128_ps(_mm_slli_epi32(_mm_xor_si128(_mm_srli_epi32(noiseUints, 1), _mm_srli_epi32(noiseUints, 2)), 31)));
+	gradientYs = _mm_xor_ps(gradientYs, _mm_castsi128_ps(_mm_slli_epi32(_mm_srli_epi32(noiseUints, 2), 31)));
+
+	return _mm_add_ps(_mm_mul_ps(gradientXs, xDisplacements), _mm_mul_ps(gradientYs, yDisplacements));
+}
+
+
+static inline __m128 GetPerlinCornerDots3d_SSE2(__m128i cellXs, unsigned int cornerOffset, __m128i seed, __m128 xDisplacements, __m128 yDisplacements, __m128 zDisplacements)
+{
+	__m128i noiseUints = GetNoiseUints_SSE2(_mm_add_epi32(cellXs, _mm_set1_epi32(static_cast<int>(cornerOffset))), seed);
+
+	__m128 component = _mm_set1_ps(PERLIN_3D_GRADIENT_COMPONENT);
+	__m128 gradientXs = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(noiseUints, 31)));
+	__m128 gradientYs = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_srli_epi32(noiseUints, 1), 31)));
+	__m128 gradientZs = _mm_xor_ps(component, _mm_castsi128_ps(_mm_slli_epi32(_mm_srli_epi32(noiseUints, 2), 31)));
+
+	return _mm_add_ps(_mm_add_ps(_mm_mul_ps(gradientXs, xDisplacements), _mm_mul_ps(gradientYs, yDisplacements)), _mm_mul_ps(gradientZs, zDisplacements));
+}
+
+
+static inline __m128 BlendCorners_SSE2(__m128 highWeights, __m128 highValues, __m128 lowWeights, __m128 lowValues)
+{
+	return _mm_add_ps(_mm_mul_ps(highWeights, highValues), _mm_mul_ps(lowWeights, lowValues));
+}
+
+
+//each kernel runs from firstIndex to the end of the row, AVX2 hands its leftovers to SSE2 and SSE2 to the scalar code
+static void AddNoiseRowOctave_SSE2(NoiseGridType gridType, NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int numSamples, float* inout_totals, int firstIndex)
+{
+	__m128i seed = _mm_set1_epi32(static_cast<int>(rowOctave.m_seed));
+	__m128i one = _mm_set1_epi32(1);
+	__m128 southWeight = _mm_set1_ps(rowOctave.m_southWeight);
+	__m128 northWeight = _mm_set1_ps(rowOctave.m_northWeight);
+	__m128 belowWeight = _mm_set1_ps(rowOctave.m_belowWeight);
+	__m128 aboveWeight = _mm_set1_ps(rowOctave.m_aboveWeight);
+	__m128 yFromMin = _mm_set1_ps(rowOctave.m_yFromMin);
+	__m128 yFromMax = _mm_set1_ps(rowOctave.m_yFromMax);
+	__m128 zFromMin = _mm_set1_ps(rowOctave.m_zFromMin);
+	__m128 zFromMax = _mm_set1_ps(rowOctave.m_zFromMax);
+	__m128 amplitude = _mm_set1_ps(rowOctave.m_amplitude);
+	unsigned int const* cornerOffsets = rowOctave.m_cornerOffsets;
+
+	int sampleIndex = firstIndex;
+	for (; sampleIndex + 4 <= numSamples; sampleIndex += 4)
+	{
+		__m128i westXs = _mm_loadu_si128(reinterpret_cast<__m128i const*>(&columns.m_cellMins[sampleIndex]));
+		__m128i eastXs = _mm_add_epi32(westXs, one);
+		__m128 eastWeights = _mm_loadu_ps(&columns.m_eastWeights[sampleIndex]);
+		__m128 westWeights = _mm_loadu_ps(&columns.m_westWeights[sampleIndex]);
+
+		__m128 noiseThisOctave;
+		if (gridType == NoiseGridType::FRACTAL_2D || gridType == NoiseGridType::FRACTAL_3D)
+		{
+			__m128 blendSouth = BlendCorners_SSE2(eastWeights, GetCornerValues_SSE2(eastXs, cornerOffsets[0], seed), westWeights, GetCornerValues_SSE2(westXs, cornerOffsets[0], seed));
+			__m128 blendNorth = BlendCorners_SSE2(eastWeights, GetCornerValues_SSE2(eastXs, cornerOffsets[1], seed), westWeights, GetCornerValues_SSE2(westXs, cornerOffsets[1], seed));
+			__m128 blendTotal = BlendCorners_SSE2(southWeight, blendSouth, northWeight, blendNorth);
+			if (gridType == NoiseGridType::FRACTAL_3D)
+			{
+				__m128 blendAboveSouth = BlendCorners_SSE2(eastWeights, GetCornerValues_SSE2(eastXs, cornerOffsets[2], seed), westWeights, GetCornerValues_SSE2(westXs, cornerOffsets[2], seed));
+				__m128 blendAboveNorth = BlendCorners_SSE2(eastWeights, GetCornerValues_SSE2(eastXs, cornerOffsets[3], seed), westWeights, GetCornerValues_SSE2(westXs, cornerOffsets[3], seed));
+				__m128 blendAbove = BlendCorners_SSE2(southWeight, blendAboveSouth, northWeight, blendAboveNorth);
+				blendTotal = BlendCorners_SSE2(belowWeight, blendTotal, aboveWeight, blendAbove);
+			}
+			noiseThisOctave = _mm_mul_ps(_mm_set1_ps(2.f), _mm_sub_ps(blendTotal, _mm_set1_ps(0.5f)));
+		}
+		else
+		{
+			__m128 xFromMins = _mm_loadu_ps(&columns.m_displacementsFromMins[sampleIndex]);
+			__m128 xFromMaxs = _mm_loadu_ps(&columns.m_displacementsFromMaxs[sampleIndex]);
+			if (gridType == NoiseGridType::PERLIN_2D)
+			{
+				__m128 blendSouth = BlendCorners_SSE2(eastWeights, GetPerlinCornerDots2d_SSE2(eastXs, cornerOffsets[0], seed, xFromMaxs, yFromMin),
+					westWeights, GetPerlinCornerDots2d_SSE2(westXs, cornerOffsets[0], seed, xFromMins, yFromMin));
+				__m128 blendNorth = BlendCorners_SSE2(eastWeights, GetPerlinCornerDots2d_SSE2(eastXs, cornerOffsets[1], seed, xFromMaxs, yFromMax),
+					westWeights, GetPerlinCornerDots2d_SSE2(westXs, cornerOffsets[1], seed, xFromMins, yFromMax));
+				__m128 blendTotal = BlendCorners_SSE2(southWeight, blendSouth, northWeight, blendNorth);
+				noiseThisOctave = _mm_mul_ps(blendTotal, _mm_set1_ps(PERLIN_2D_NORMALIZER));
+			}
+			else
+			{
+				__m128 blendBelowSouth = BlendCorners_SSE2(eastWeights, GetPerlinCornerDots3d_SSE2(eastXs, cornerOffsets[0], seed, xFromMaxs, yFromMin, zFromMin),
+					westWeights, GetPerlinCornerDots3d_SSE2(westXs, cornerOffsets[0], seed, xFromMins, yFromMin, zFromMin));
+				__m128 blendBelowNorth = BlendCorners_SSE2(eastWeights, GetPerlinCornerDots3d_SSE2(eastXs, cornerOffsets[1], seed, xFromMaxs, yFromMax, zFromMin),
+					westWeights, GetPerlinCornerDots3d_SSE2(westXs, cornerOffsets[1], seed, xFromMins, yFromMax, zFromMin));
+				__m128 blendAboveSouth = BlendCorners_SSE2(eastWeights, GetPerlinCornerDots3d_SSE2(eastXs, cornerOffsets[2], seed, xFromMaxs, yFromMin, zFromMax),
+					westWeights, GetPerlinCornerDots3d_SSE2(westXs, cornerOffsets[2], seed, xFromMins, yFromMin, zFromMax));
+				__m128 blendAboveNorth = BlendCorners_SSE2(eastWeights, GetPerlinCornerDots3d_SSE2(eastXs, cornerOffsets[3], seed, xFromMaxs, yFromMax, zFromMax),
+					westWeights, GetPerlinCornerDots3d_SSE2(westXs, cornerOffsets[3], seed, xFromMins, yFromMax, zFromMax));
+				__m128 blendBelow = BlendCorners_SSE2(southWeight, blendBelowSouth, northWeight, blendBelowNorth);
+				__m128 blendAbove = BlendCorners_SSE2(southWeight, blendAboveSouth, northWeight, blendAboveNorth);
+				__m128 blendTotal = BlendCorners_SSE2(belowWeight, blendBelow, aboveWeight, blendAbove);
+				noiseThisOctave = _mm_mul_ps(blendTotal, _mm_set1_ps(PERLIN_3D_NORMALIZER));
+			}
+		}
+
+		__m128 totals = _mm_add_ps(_mm_loadu_ps(&inout_totals[sampleIndex]), _mm_mul_ps(noiseThisOctave, amplitude));
+		_mm_storeu_ps(&inout_totals[sampleIndex], totals);
+	}
+
+	AddNoiseRowOctave_Scalar(gridType, columns, rowOctave, numSamples, inout_totals, sampleIndex);
+}
+
+
+static void RenormalizeNoiseRow_SSE2(float totalAmplitude, int numSamples, float* inout_totals, int firstIndex)
+{
+	__m128 amplitudeLanes = _mm_set1_ps(totalAmplitude);
+	__m128 half = _mm_set1_ps(0.5f);
+	__m128 one = _mm_set1_ps(1.f);
+	__m128 two = _mm_set1_ps(2.f);
+
+	int sampleIndex = firstIndex;
+	for (; sampleIndex + 4 <= numSamples; sampleIndex += 4)
+	{
+		__m128 t = _mm_add_ps(_mm_mul_ps(_mm_div_ps(_mm_loadu_ps(&inout_totals[sampleIndex]), amplitudeLanes), half), half);
+
+		//SmoothStep3, term for term
+		__m128 s = _mm_sub_ps(one, t);
+		__m128 st = _mm_mul_ps(s, t);
+		t = _mm_add_ps(_mm_mul_ps(st, t), _mm_mul_ps(t, _mm_add_ps(st, _mm_mul_ps(t, _mm_add_ps(s, t)))));
+
+		_mm_storeu_ps(&inout_totals[sampleIndex], _mm_sub_ps(_mm_mul_ps(t, two), one));
+	}
+
+	RenormalizeNoiseRow_Scalar(totalAmplitude, numSamples, inout_totals, sampleIndex);
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static inline __m256 GetCornerValues_AVX2(__m256i cellXs, unsigned int cornerOffset, __m256i seed)
+{
+	return GetNoiseZeroToOne_AVX2(GetNoiseUints_AVX2(_mm256_add_epi32(cellXs, _mm256_set1_epi32(static_cast<int>(cornerOffset))), seed));
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static inline __m256 GetPerlinCornerDots2d_AVX2(__m256i cellXs, unsigned int cornerOffset, __m256i seed, __m256 xDisplacements, __m256 yDisplacements)
+{
+	__m256i noiseUints = GetNoiseUints_AVX2(_mm256_add_epi32(cellXs, _mm256_set1_epi32(static_cast<int>(cornerOffset))), seed);
+
+	//AVX2 can look the gradients straight up, 8 entries is exactly one permute
+	__m256i gradientIndexes = _mm256_and_si256(noiseUints, _mm256_set1_epi32(0x00000007));
+	__m256 gradientXTable = _mm256_setr_ps(+PERLIN_2D_GRADIENT_LONG_LEG, +PERLIN_2D_GRADIENT_SHORT_LEG, -PERLIN_2D_GRADIENT_SHORT_LEG, -PERLIN_2D_GRADIENT_LONG_LEG,
+		-PERLIN_2D_GRADIENT_LONG_LEG, -PERLIN_2D_GRADIENT_SHORT_LEG, +PERLIN_2D_GRADIENT_SHORT_LEG, +PERLIN_2D_GRADIENT_LONG_LEG);
+	__m256 gradientYTable = _mm256_setr_ps(+PERLIN_2D_GRADIENT_SHORT_LEG, +PERLIN_2D_GRADIENT_LONG_LEG, +PERLIN_2D_GRADIENT_LONG_LEG, +PERLIN_2D_GRADIENT_SHORT_LEG,
+		-PERLIN_2D_GRADIENT_SHORT_LEG, -PERLIN_2D_GRADIENT_LONG_LEG, -PERLIN_2D_GRADIENT_LONG_LEG, -PERLIN_2D_GRADIENT_SHORT_LEG);
+	__m256 gradientXs = _mm256_permutevar8x32_ps(gradientXTable, gradientIndexes);
+	__m256 gradientYs = _mm256_permutevar8x32_ps(gradientYTable, gradientIndexes);
+
+	return _mm256_add_ps(_mm256_mul_ps(gradientXs, xDisplacements), _mm256_mul_ps(gradientYs, yDisplacements));
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static inline __m256 GetPerlinCornerDots3d_AVX2(__m256i cellXs, unsigned int cornerOffset, __m256i seed, __m256 xDisplacements, __m256 yDisplacements, __m256 zDisplacements)
+{
+	__m256i noiseUints = GetNoiseUints_AVX2(_mm256_add_epi32(cellXs, _mm256_set1_epi32(static_cast<int>(cornerOffset))), seed);
+
+	__m256 component = _mm256_set1_ps(PERLIN_3D_GRADIENT_COMPONENT);
+	__m256 gradientXs = _mm256_xor_ps(component, _mm256_castsi256_ps(_mm256_slli_epi32(noiseUints, 31)));
+	__m256 gradientYs = _mm256_xor_ps(component, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_srli_epi32(noiseUints, 1), 31)));
+	__m256 gradientZs = _mm256_xor_ps(component, _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_srli_epi32(noiseUints, 2), 31)));
+
+	return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(gradientXs, xDisplacements), _mm256_mul_ps(gradientYs, yDisplacements)), _mm256_mul_ps(gradientZs, zDisplacements));
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static inline __m256 BlendCorners_AVX2(__m256 highWeights, __m256 highValues, __m256 lowWeights, __m256 lowValues)
+{
+	return _mm256_add_ps(_mm256_mul_ps(highWeights, highValues), _mm256_mul_ps(lowWeights, lowValues));
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static void AddNoiseRowOctave_AVX2(NoiseGridType gridType, NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int numSamples, float* inout_totals)
+{
+	__m256i seed = _mm256_set1_epi32(static_cast<int>(rowOctave.m_seed));
+	__m256i one = _mm256_set1_epi32(1);
+	__m256 southWeight = _mm256_set1_ps(rowOctave.m_southWeight);
+	__m256 northWeight = _mm256_set1_ps(rowOctave.m_northWeight);
+	__m256 belowWeight = _mm256_set1_ps(rowOctave.m_belowWeight);
+	__m256 aboveWeight = _mm256_set1_ps(rowOctave.m_aboveWeight);
+	__m256 yFromMin = _mm256_set1_ps(rowOctave.m_yFromMin);
+	__m256 yFromMax = _mm256_set1_ps(rowOctave.m_yFromMax);
+	__m256 zFromMin = _mm256_set1_ps(rowOctave.m_zFromMin);
+	__m256 zFromMax = _mm256_set1_ps(rowOctave.m_zFromMax);
+	__m256 amplitude = _mm256_set1_ps(rowOctave.m_amplitude);
+	unsigned int const* cornerOffsets = rowOctave.m_cornerOffsets;
+
+	int sampleIndex = 0;
+	for (; sampleIndex + 8 <= numSamples; sampleIndex += 8)
+	{
+		__m256i westXs = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(&columns.m_cellMins[sampleIndex]));
+		__m256i eastXs = _mm256_add_epi32(westXs, one);
+		__m256 eastWeights = _mm256_loadu_ps(&columns.m_eastWeights[sampleIndex]);
+		__m256 westWeights = _mm256_loadu_ps(&columns.m_westWeights[sampleIndex]);
+
+		__m256 noiseThisOctave;
+		if (gridType == NoiseGridType::FRACTAL_2D || gridType == NoiseGridType::FRACTAL_3D)
+		{
+			__m256 blendSouth = BlendCorners_AVX2(eastWeights, GetCornerValues_AVX2(eastXs, cornerOffsets[0], seed), westWeights, GetCornerValues_AVX2(westXs, cornerOffsets[0], seed));
+			__m256 blendNorth = BlendCorners_AVX2(eastWeights, GetCornerValues_AVX2(eastXs, cornerOffsets[1], seed), westWeights, GetCornerValues_AVX2(westXs, cornerOffsets[1], seed));
+			__m256 blendTotal = BlendCorners_AVX2(southWeight, blendSouth, northWeight, blendNorth);
+			if (gridType == NoiseGridType::FRACTAL_3D)
+			{
+				__m256 blendAboveSouth = BlendCorners_AVX2(eastWeights, GetCornerValues_AVX2(eastXs, cornerOffsets[2], seed), westWeights, GetCornerValues_AVX2(westXs, cornerOffsets[2], seed));
+				__m256 blendAboveNorth = BlendCorners_AVX2(eastWeights, GetCornerValues_AVX2(eastXs, cornerOffsets[3], seed), westWeights, GetCornerValues_AVX2(westXs, cornerOffsets[3], seed));
+				__m256 blendAbove = BlendCorners_AVX2(southWeight, blendAboveSouth, northWeight, blendAboveNorth);
+				blendTotal = BlendCorners_AVX2(belowWeight, blendTotal, aboveWeight, blendAbove);
+			}
+			noiseThisOctave = _mm256_mul_ps(_mm256_set1_ps(2.f), _mm256_sub_ps(blendTotal, _mm256_set1_ps(0.5f)));
+		}
+		else
+		{
+			__m256 xFromMins = _mm256_loadu_ps(&columns.m_displacementsFromMins[sampleIndex]);
+			__m256 xFromMaxs = _mm256_loadu_ps(&columns.m_displacementsFromMaxs[sampleIndex]);
+			if (gridType == NoiseGridType::PERLIN_2D)
+			{
+				__m256 blendSouth = BlendCorners_AVX2(eastWeights, GetPerlinCornerDots2d_AVX2(eastXs, cornerOffsets[0], seed, xFromMaxs, yFromMin),
+					westWeights, GetPerlinCornerDots2d_AVX2(westXs, cornerOffsets[0], seed, xFromMins, yFromMin));
+				__m256 blendNorth = BlendCorners_AVX2(eastWeights, GetPerlinCornerDots2d_AVX2(eastXs, cornerOffsets[1], seed, xFromMaxs, yFromMax),
+					westWeights, GetPerlinCornerDots2d_AVX2(westXs, cornerOffsets[1], seed, xFromMins, yFromMax));
+				__m256 blendTotal = BlendCorners_AVX2(southWeight, blendSouth, northWeight, blendNorth);
+				noiseThisOctave = _mm256_mul_ps(blendTotal, _mm256_set1_ps(PERLIN_2D_NORMALIZER));
+			}
+			else
+			{
+				__m256 blendBelowSouth = BlendCorners_AVX2(eastWeights, GetPerlinCornerDots3d_AVX2(eastXs, cornerOffsets[0], seed, xFromMaxs, yFromMin, zFromMin),
+					westWeights, GetPerlinCornerDots3d_AVX2(westXs, cornerOffsets[0], seed, xFromMins, yFromMin, zFromMin));
+				__m256 blendBelowNorth = BlendCorners_AVX2(eastWeights, GetPerlinCornerDots3d_AVX2(eastXs, cornerOffsets[1], seed, xFromMaxs, yFromMax, zFromMin),
+					westWeights, GetPerlinCornerDots3d_AVX2(westXs, cornerOffsets[1], seed, xFromMins, yFromMax, zFromMin));
+				__m256 blendAboveSouth = BlendCorners_AVX2(eastWeights, GetPerlinCornerDots3d_AVX2(eastXs, cornerOffsets[2], seed, xFromMaxs, yFromMin, zFromMax),
+					westWeights, GetPerlinCornerDots3d_AVX2(westXs, cornerOffsets[2], seed, xFromMins, yFromMin, zFromMax));
+				__m256 blendAboveNorth = BlendCorners_AVX2(eastWeights, GetPerlinCornerDots3d_AVX2(eastXs, cornerOffsets[3], seed, xFromMaxs, yFromMax, zFromMax),
+					westWeights, GetPerlinCornerDots3d_AVX2(westXs, cornerOffsets[3], seed, xFromMins, yFromMax, zFromMax));
+				__m256 blendBelow = BlendCorners_AVX2(southWeight, blendBelowSouth, northWeight, blendBelowNorth);
+				__m256 blendAbove = BlendCorners_AVX2(southWeight, blendAboveSouth, northWeight, blendAboveNorth);
+				__m256 blendTotal = BlendCorners_AVX2(belowWeight, blendBelow, aboveWeight, blendAbove);
+				noiseThisOctave = _mm256_mul_ps(blendTotal, _mm256_set1_ps(PERLIN_3D_NORMALIZER));
+			}
+		}
+
+		__m256 totals = _mm256_add_ps(_mm256_loadu_ps(&inout_totals[sampleIndex]), _mm256_mul_ps(noiseThisOctave, amplitude));
+		_mm256_storeu_ps(&inout_totals[sampleIndex], totals);
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	AddNoiseRowOctave_SSE2(gridType, columns, rowOctave, numSamples, inout_totals, sampleIndex);
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static void RenormalizeNoiseRow_AVX2(float totalAmplitude, int numSamples, float* inout_totals)
+{
+	__m256 amplitudeLanes = _mm256_set1_ps(totalAmplitude);
+	__m256 half = _mm256_set1_ps(0.5f);
+	__m256 one = _mm256_set1_ps(1.f);
+	__m256 two = _mm256_set1_ps(2.f);
+
+	int sampleIndex = 0;
+	for (; sampleIndex + 8 <= numSamples; sampleIndex += 8)
+	{
+		__m256 t = _mm256_add_ps(_mm256_mul_ps(_mm256_div_ps(_mm256_loadu_ps(&inout_totals[sampleIndex]), amplitudeLanes), half), half);
+
+		__m256 s = _mm256_sub_ps(one, t);
+		__m256 st = _mm256_mul_ps(s, t);
+		t = _mm256_add_ps(_mm256_mul_ps(st, t), _mm256_mul_ps(t, _mm256_add_ps(st, _mm256_mul_ps(t, _mm256_add_ps(s, t)))));
+
+		_mm256_storeu_ps(&inout_totals[sampleIndex], _mm256_sub_ps(_mm256_mul_ps(t, two), one));
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	RenormalizeNoiseRow_SSE2(totalAmplitude, numSamples, inout_totals, sampleIndex);
+}
+#endif
+
+
+static void AddNoiseRowOctave(NoiseGridType gridType, SIMDLevel simdLevel, NoiseGridColumns const& columns, NoiseGridRowOctave const& rowOctave, int numSamples, float* inout_totals)
+{
+#if defined(ENGINE_SIMD_X86)
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		AddNoiseRowOctave_AVX2(gridType, columns, rowOctave, numSamples, inout_totals);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		AddNoiseRowOctave_SSE2(gridType, columns, rowOctave, numSamples, inout_totals, 0);
+		return;
+	}
+#endif
+
+	AddNoiseRowOctave_Scalar(gridType, columns, rowOctave, numSamples, inout_totals, 0);
+}
+
+
+static void RenormalizeNoiseRow(SIMDLevel simdLevel, float totalAmplitude, int numSamples, float* inout_totals)
+{
+#if defined(ENGINE_SIMD_X86)
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		RenormalizeNoiseRow_AVX2(totalAmplitude, numSamples, inout_totals);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		RenormalizeNoiseRow_SSE2(totalAmplitude, numSamples, inout_totals, 0);
+		return;
+	}
+#endif
+
+	RenormalizeNoiseRow_Scalar(totalAmplitude, numSamples, inout_totals, 0);
+}
+
+
+static void BuildNoiseGridAxis(int numSamples, float originCoord, float sampleSpacing, float inverseScale, unsigned int numOctaves, float octaveScale, NoiseGridAxis& out_axis)
+{
+	int numEntries = numSamples * static_cast<int>(numOctaves);
+	out_axis.m_numSamples = numSamples;
+	out_axis.m_cellMins.resize(numEntries);
+	out_axis.m_displacementsFromMins.resize(numEntries);
+	out_axis.m_displacementsFromMaxs.resize(numEntries);
+	out_axis.m_highWeights.resize(numEntries);
+	out_axis.m_lowWeights.resize(numEntries);
+
+	for (int sampleIndex = 0; sampleIndex < numSamples; sampleIndex++)
+	{
+		//same steps, in the same order, as each component of currentPos in the single-sample functions
+		float samplePosition = originCoord + (static_cast<float>(sampleIndex) * sampleSpacing);
+		float currentPosition = samplePosition * inverseScale;
+		for (int octaveIndex = 0; octaveIndex < static_cast<int>(numOctaves); octaveIndex++)
+		{
+			int entryIndex = (octaveIndex * numSamples) + sampleIndex;
+			float cellMin = floorf(currentPosition);
+			out_axis.m_cellMins[entryIndex] = static_cast<int>(cellMin);
+			out_axis.m_displacementsFromMins[entryIndex] = currentPosition - cellMin;
+			out_axis.m_displacementsFromMaxs[entryIndex] = currentPosition - (cellMin + 1.f);
+			out_axis.m_highWeights[entryIndex] = SmoothStep3(currentPosition - cellMin);
+			out_axis.m_lowWeights[entryIndex] = 1.f - out_axis.m_highWeights[entryIndex];
+
+			currentPosition *= octaveScale;
+			currentPosition += NOISE_OCTAVE_OFFSET;
+		}
+	}
+}
+
+
+static NoiseGridColumns const GetNoiseGridColumns(NoiseGridAxis const& xAxis, int octaveIndex)
+{
+	int firstEntryIndex = octaveIndex * xAxis.m_numSamples;
+
+	NoiseGridColumns columns;
+	columns.m_cellMins = &xAxis.m_cellMins[firstEntryIndex];
+	columns.m_displacementsFromMins = &xAxis.m_displacementsFromMins[firstEntryIndex];
+	columns.m_displacementsFromMaxs = &xAxis.m_displacementsFromMaxs[firstEntryIndex];
+	columns.m_eastWeights = &xAxis.m_highWeights[firstEntryIndex];
+	columns.m_westWeights = &xAxis.m_lowWeights[firstEntryIndex];
+	return columns;
+}
+
+
+//2D grids pass a one-sample z axis and ignore its values
+static void ComputeNoiseGrid(NoiseGridType gridType, IntVec3 const& gridDimensions, Vec3 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale,
+	unsigned int numOctaves, float octavePersistence, float octaveScale, bool renormalize, unsigned int seed, bool isParallel)
+{
+	if (gridDimensions.x <= 0 || gridDimensions.y <= 0 || gridDimensions.z <= 0)
+	{
+		return;
+	}
+
+	bool is3D = (gridType == NoiseGridType::FRACTAL_3D || gridType == NoiseGridType::PERLIN_3D);
+	float inverseScale = (1.f / scale);
+
+	NoiseGridAxis xAxis;
+	NoiseGridAxis yAxis;
+	NoiseGridAxis zAxis;
+	BuildNoiseGridAxis(gridDimensions.x, gridOrigin.x, sampleSpacing, inverseScale, numOctaves, octaveScale, xAxis);
+	BuildNoiseGridAxis(gridDimensions.y, gridOrigin.y, sampleSpacing, inverseScale, numOctaves, octaveScale, yAxis);
+	BuildNoiseGridAxis(gridDimensions.z, gridOrigin.z, sampleSpacing, inverseScale, numOctaves, octaveScale, zAxis);
+
+	std::vector<float> octaveAmplitudes(numOctaves);
+	float totalAmplitude = 0.f;
+	float currentAmplitude = 1.f;
+	for (int octaveIndex = 0; octaveIndex < static_cast<int>(numOctaves); octaveIndex++)
+	{
+		octaveAmplitudes[octaveIndex] = currentAmplitude;
+		totalAmplitude += currentAmplitude;
+		currentAmplitude *= octavePersistence;
+	}
+
+	SIMDLevel simdLevel = GetSIMDLevel();
+	auto computeRows = [&](int firstRowIndex, int endRowIndex)
+	{
+		for (int rowIndex = firstRowIndex; rowIndex < endRowIndex; rowIndex++)
+		{
+			int yIndex = rowIndex % gridDimensions.y;
+			int zIndex = rowIndex / gridDimensions.y;
+			float* rowValues = &out_noiseValues[rowIndex * gridDimensions.x];
+			for (int sampleIndex = 0; sampleIndex < gridDimensions.x; sampleIndex++)
+			{
+				rowValues[sampleIndex] = 0.f;
+			}
+
+			for (int octaveIndex = 0; octaveIndex < static_cast<int>(numOctaves); octaveIndex++)
+			{
+				int yEntryIndex = (octaveIndex * gridDimensions.y) + yIndex;
+				int zEntryIndex = (octaveIndex * gridDimensions.z) + zIndex;
+				unsigned int southOffset = NOISE_PRIME_Y * static_cast<unsigned int>(yAxis.m_cellMins[yEntryIndex]);
+				unsigned int northOffset = southOffset + NOISE_PRIME_Y;
+				unsigned int belowOffset = is3D ? NOISE_PRIME_Z * static_cast<unsigned int>(zAxis.m_cellMins[zEntryIndex]) : 0;
+				unsigned int aboveOffset = belowOffset + NOISE_PRIME_Z;
+
+				NoiseGridRowOctave rowOctave;
+				rowOctave.m_cornerOffsets[0] = southOffset + belowOffset;
+				rowOctave.m_cornerOffsets[1] = northOffset + belowOffset;
+				rowOctave.m_cornerOffsets[2] = southOffset + aboveOffset;
+				rowOctave.m_cornerOffsets[3] = northOffset + aboveOffset;
+				rowOctave.m_yFromMin = yAxis.m_displacementsFromMins[yEntryIndex];
+				rowOctave.m_yFromMax = yAxis.m_displacementsFromMaxs[yEntryIndex];
+				rowOctave.m_northWeight = yAxis.m_highWeights[yEntryIndex];
+				rowOctave.m_southWeight = yAxis.m_lowWeights[yEntryIndex];
+				rowOctave.m_zFromMin = zAxis.m_displacementsFromMins[zEntryIndex];
+				rowOctave.m_zFromMax = zAxis.m_displacementsFromMaxs[zEntryIndex];
+				rowOctave.m_aboveWeight = zAxis.m_highWeights[zEntryIndex];
+				rowOctave.m_belowWeight = zAxis.m_lowWeights[zEntryIndex];
+				rowOctave.m_seed = seed + static_cast<unsigned int>(octaveIndex);
+				rowOctave.m_amplitude = octaveAmplitudes[octaveIndex];
+
+				AddNoiseRowOctave(gridType, simdLevel, GetNoiseGridColumns(xAxis, octaveIndex), rowOctave, gridDimensions.x, rowValues);
+			}
+
+			if (renormalize && totalAmplitude > 0.f)
+			{
+				RenormalizeNoiseRow(simdLevel, totalAmplitude, gridDimensions.x, rowValues);
+			}
+		}
+	};
+
+	int numRows = gridDimensions.y * gridDimensions.z;
+	if (isParallel)
+	{
+		int rowsPerChunk = NOISE_GRID_SAMPLES_PER_CHUNK / gridDimensions.x;
+		ParallelForChunks(0, numRows, (rowsPerChunk > 1) ? rowsPerChunk : 1, computeRows);
+	}
+	else
+	{
+		computeRows(0, numRows);
+	}
+}
+
+
+//
+//noise grid functions
+//
+void Compute2dFractalNoiseGrid(IntVec2 const& gridDimensions, Vec2 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale, unsigned int numOctaves,
+	float octavePersistence, float octaveScale, bool renormalize, unsigned int seed, bool isParallel)
+{
+	ComputeNoiseGrid(NoiseGridType::FRACTAL_2D, IntVec3(gridDimensions.x, gridDimensions.y, 1), Vec3(gridOrigin.x, gridOrigin.y, 0.f), sampleSpacing, out_noiseValues,
+		scale, numOctaves, octavePersistence, octaveScale, renormalize, seed, isParallel);
+}
+
+
+void Compute2dPerlinNoiseGrid(IntVec2 const& gridDimensions, Vec2 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale, unsigned int numOctaves,
+	float octavePersistence, float octaveScale, bool renormalize, unsigned int seed, bool isParallel)
+{
+	ComputeNoiseGrid(NoiseGridType::PERLIN_2D, IntVec3(gridDimensions.x, gridDimensions.y, 1), Vec3(gridOrigin.x, gridOrigin.y, 0.f), sampleSpacing, out_noiseValues,
+		scale, numOctaves, octavePersistence, octaveScale, renormalize, seed, isParallel);
+}
+
+
+void Compute3dFractalNoiseGrid(IntVec3 const& gridDimensions, Vec3 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale, unsigned int numOctaves,
+	float octavePersistence, float octaveScale, bool renormalize, unsigned int seed, bool isParallel)
+{
+	ComputeNoiseGrid(NoiseGridType::FRACTAL_3D, gridDimensions, gridOrigin, sampleSpacing, out_noiseValues, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed, isParallel);
+}
+
+
+void Compute3dPerlinNoiseGrid(IntVec3 const& gridDimensions, Vec3 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale, unsigned int numOctaves,
+	float octavePersistence, float octaveScale, bool renormalize, unsigned int seed, bool isParallel)
+{
+	ComputeNoiseGrid(NoiseGridType::PERLIN_3D, gridDimensions, gridOrigin, sampleSpacing, out_noiseValues, scale, numOctaves, octavePersistence, octaveScale, renormalize, seed, isParallel);
+}
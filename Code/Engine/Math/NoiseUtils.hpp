@@ -0,0 +1,20 @@
+#pragma once
+#include "Engine/Math/IntVec2.hpp"
+#include "Engine/Math/IntVec3.hpp"
+#include "Engine/Math/Vec2.hpp"
+#include "Engine/Math/Vec3.hpp"
+
+
+//grid versions of Squirrel's Compute2d/3dFractalNoise and Compute2d/3dPerlinNoise (see SmoothNoise.hpp for the noise parameters)
+//sample (x, y, z) is taken at gridOrigin + (x, y, z) * sampleSpacing and written to out_noiseValues[x + (y * dims.x) + (z * dims.x * dims.y)],
+//and matches the single-sample function called at that position exactly, on every SIMD level
+//lattice cells and blend weights along each axis are found once per grid rather than once per sample, and x runs 4 (SSE2) or 8 (AVX2) samples at a time
+//isParallel splits the rows across the job system's workers, the calling thread helps and the call returns once the grid is full
+void Compute2dFractalNoiseGrid(IntVec2 const& gridDimensions, Vec2 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale = 1.f, unsigned int numOctaves = 1,
+		float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, bool isParallel = false);
+void Compute2dPerlinNoiseGrid(IntVec2 const& gridDimensions, Vec2 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale = 1.f, unsigned int numOctaves = 1,
+		float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, bool isParallel = false);
+void Compute3dFractalNoiseGrid(IntVec3 const& gridDimensions, Vec3 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale = 1.f, unsigned int numOctaves = 1,
+		float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, bool isParallel = false);
+void Compute3dPerlinNoiseGrid(IntVec3 const& gridDimensions, Vec3 const& gridOrigin, float sampleSpacing, float* out_noiseValues, float scale = 1.f, unsigned int numOctaves = 1,
+		float octavePersistence = 0.5f, float octaveScale = 2.f, bool renormalize = true, unsigned int seed = 0, bool isParallel = false);
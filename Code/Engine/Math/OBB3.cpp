@@ -0,0 +1,46 @@
+#include "Engine/Math/OBB3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+
+
+//
+//constructors
+//
+OBB3::OBB3(Vec3 const& center, Vec3 const& iBasisNormal, Vec3 const& jBasisNormal, Vec3 const& halfDimensions)
+	: m_center(center)
+	, m_iBasisNormal(iBasisNormal)
+	, m_jBasisNormal(jBasisNormal)
+	, m_kBasisNormal(CrossProduct3D(iBasisNormal, jBasisNormal))
+	, m_halfDimensions(halfDimensions)
+{
+}
+
+
+OBB3::OBB3(Vec3 const& center, Vec3 const& iBasisNormal, Vec3 const& jBasisNormal, Vec3 const& kBasisNormal, Vec3 const& halfDimensions)
+	: m_center(center)
+	, m_iBasisNormal(iBasisNormal)
+	, m_jBasisNormal(jBasisNormal)
+	, m_kBasisNormal(kBasisNormal)
+	, m_halfDimensions(halfDimensions)
+{
+}
+
+
+//
+//accessors
+//
+Vec3 const OBB3::GetLocalPositionForWorldPosition(Vec3 const& worldPosition) const
+{
+	return GetLocalVectorForWorldVector(worldPosition - m_center);
+}
+
+
+Vec3 const OBB3::GetLocalVectorForWorldVector(Vec3 const& worldVector) const
+{
+	return Vec3(DotProduct3D(worldVector, m_iBasisNormal), DotProduct3D(worldVector, m_jBasisNormal), DotProduct3D(worldVector, m_kBasisNormal));
+}
+
+
+Vec3 const OBB3::GetWorldVectorForLocalVector(Vec3 const& localVector) const
+{
+	return (m_iBasisNormal * localVector.x) + (m_jBasisNormal * localVector.y) + (m_kBasisNormal * localVector.z);
+}
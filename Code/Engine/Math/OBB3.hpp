@@ -0,0 +1,24 @@
+#pragma once
+#include "Engine/Math/Vec3.hpp"
+
+struct OBB3
+{
+//public member variables
+public:
+	Vec3 m_center;
+	Vec3 m_iBasisNormal;
+	Vec3 m_jBasisNormal;
+	Vec3 m_kBasisNormal;
+	Vec3 m_halfDimensions;
+
+//public member functions
+public:
+	OBB3() = default;
+	explicit OBB3(Vec3 const& center, Vec3 const& iBasisNormal, Vec3 const& jBasisNormal, Vec3 const& halfDimensions);	//k basis is i cross j
+	explicit OBB3(Vec3 const& center, Vec3 const& iBasisNormal, Vec3 const& jBasisNormal, Vec3 const& kBasisNormal, Vec3 const& halfDimensions);
+
+	//accessors
+	Vec3 const GetLocalPositionForWorldPosition(Vec3 const& worldPosition) const;
+	Vec3 const GetLocalVectorForWorldVector(Vec3 const& worldVector) const;
+	Vec3 const GetWorldVectorForLocalVector(Vec3 const& localVector) const;
+};
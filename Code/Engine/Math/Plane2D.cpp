@@ -1,4 +1,4 @@
-#include "Engine/Math/Plane2D.hpp"
-
-
-
+#include "Engine/Math/Plane2D.hpp"
+
+
+
@@ -1,4 +1,4 @@
-#include "Engine/Math/Plane3D.hpp"
-
-
-
+#include "Engine/Math/Plane3D.hpp"
+
+
+
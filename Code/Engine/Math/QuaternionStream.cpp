@@ -0,0 +1,679 @@
+#include "Engine/Math/QuaternionStream.hpp"
+#include "Engine/Math/Mat44.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include <math.h>
+
+
+//pairs closer than this (cosine of the angle between them) are nlerped, slerp's weights lose precision there and the two agree anyway
+constexpr float SLERP_NLERP_COSINE_THRESHOLD = 0.9995f;
+
+//the SIMD slerp evaluates acos on [0, 1] as sqrt(1 - x) * polynomial (Abramowitz and Stegun 4.4.46) and sin on [0, pi/2] as its Taylor series
+constexpr float SLERP_ACOS_COEFFICIENTS[8] = { 1.5707963050f, -0.2145988016f, 0.0889789874f, -0.0501743046f, 0.0308918810f, -0.0170881256f, 0.0066700901f, -0.0012624911f };
+constexpr float SLERP_SINE_COEFFICIENTS[5] = { -1.0f / 6.0f, 1.0f / 120.0f, -1.0f / 5040.0f, 1.0f / 362880.0f, -1.0f / 39916800.0f };
+
+
+//
+//static functions
+//
+//the scalar blends share the SIMD kernels' approach: weight the two ends, then normalize, so both paths give the same answers
+static Quaternion const BlendShortestArc(Quaternion const& start, Quaternion const& end, float fraction, bool isSlerp)
+{
+	float cosAngle = (start.v.x * end.v.x) + (start.v.y * end.v.y) + (start.v.z * end.v.z) + (start.s * end.s);
+	Quaternion shortestEnd = (cosAngle < 0.0f) ? -end : end;
+	cosAngle = fabsf(cosAngle);
+
+	float startWeight = 1.0f - fraction;
+	float endWeight = fraction;
+	if (isSlerp && cosAngle <= SLERP_NLERP_COSINE_THRESHOLD)
+	{
+		//dividing by sin(angle) isn't needed since the result gets normalized
+		float angle = acosf(cosAngle);
+		startWeight = sinf((1.0f - fraction) * angle);
+		endWeight = sinf(fraction * angle);
+	}
+
+	Quaternion blended = (start * startWeight) + (shortestEnd * endWeight);
+	blended.Normalize();
+	return blended;
+}
+
+
+#if defined(ENGINE_SIMD_X86)
+static inline void NormalizeLanes_SSE2(__m128& vx, __m128& vy, __m128& vz, __m128& s)
+{
+	//full sqrt and divide rather than rsqrt, so results match Quaternion::Normalize
+	__m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(vx, vx), _mm_mul_ps(vy, vy)), _mm_add_ps(_mm_mul_ps(vz, vz), _mm_mul_ps(s, s))));
+	__m128 isNonZero = _mm_cmpneq_ps(length, _mm_setzero_ps());
+
+	//zero-length lanes keep their original values instead of the divide's NaNs
+	vx = _mm_or_ps(_mm_and_ps(isNonZero, _mm_div_ps(vx, length)), _mm_andnot_ps(isNonZero, vx));
+	vy = _mm_or_ps(_mm_and_ps(isNonZero, _mm_div_ps(vy, length)), _mm_andnot_ps(isNonZero, vy));
+	vz = _mm_or_ps(_mm_and_ps(isNonZero, _mm_div_ps(vz, length)), _mm_andnot_ps(isNonZero, vz));
+	s = _mm_or_ps(_mm_and_ps(isNonZero, _mm_div_ps(s, length)), _mm_andnot_ps(isNonZero, s));
+}
+
+
+SIMD_AVX2_FUNCTION static inline void NormalizeLanes_AVX2(__m256& vx, __m256& vy, __m256& vz, __m256& s)
+{
+	__m256 length = _mm256_sqrt_ps(_mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_fmadd_ps(vz, vz, _mm256_mul_ps(s, s)))));
+	__m256 isNonZero = _mm256_cmp_ps(length, _mm256_setzero_ps(), _CMP_NEQ_UQ);
+
+	vx = _mm256_blendv_ps(vx, _mm256_div_ps(vx, length), isNonZero);
+	vy = _mm256_blendv_ps(vy, _mm256_div_ps(vy, length), isNonZero);
+	vz = _mm256_blendv_ps(vz, _mm256_div_ps(vz, length), isNonZero);
+	s = _mm256_blendv_ps(s, _mm256_div_ps(s, length), isNonZero);
+}
+
+
+//each kernel runs from firstIndex to the end of the stream, AVX2 hands its leftovers to SSE2 and SSE2 to the scalar code
+static void NormalizeStream_SSE2(QuaternionStream& stream, int firstIndex)
+{
+	int numElements = stream.GetSize();
+	int elementIndex = firstIndex;
+	for (; elementIndex + 4 <= numElements; elementIndex += 4)
+	{
+		__m128 vx = _mm_loadu_ps(&stream.m_vxs[elementIndex]);
+		__m128 vy = _mm_loadu_ps(&stream.m_vys[elementIndex]);
+		__m128 vz = _mm_loadu_ps(&stream.m_vzs[elementIndex]);
+		__m128 s = _mm_loadu_ps(&stream.m_ss[elementIndex]);
+		NormalizeLanes_SSE2(vx, vy, vz, s);
+
+		_mm_storeu_ps(&stream.m_vxs[elementIndex], vx);
+		_mm_storeu_ps(&stream.m_vys[elementIndex], vy);
+		_mm_storeu_ps(&stream.m_vzs[elementIndex], vz);
+		_mm_storeu_ps(&stream.m_ss[elementIndex], s);
+	}
+
+	for (; elementIndex < numElements; elementIndex++)
+	{
+		Quaternion quaternion = stream.GetElement(elementIndex);
+		quaternion.Normalize();
+		stream.SetElement(elementIndex, quaternion);
+	}
+}
+
+
+SIMD_AVX2_FUNCTION static void NormalizeStream_AVX2(QuaternionStream& stream)
+{
+	int numElements = stream.GetSize();
+	int elementIndex = 0;
+	for (; elementIndex + 8 <= numElements; elementIndex += 8)
+	{
+		__m256 vx = _mm256_loadu_ps(&stream.m_vxs[elementIndex]);
+		__m256 vy = _mm256_loadu_ps(&stream.m_vys[elementIndex]);
+		__m256 vz = _mm256_loadu_ps(&stream.m_vzs[elementIndex]);
+		__m256 s = _mm256_loadu_ps(&stream.m_ss[elementIndex]);
+		NormalizeLanes_AVX2(vx, vy, vz, s);
+
+		_mm256_storeu_ps(&stream.m_vxs[elementIndex], vx);
+		_mm256_storeu_ps(&stream.m_vys[elementIndex], vy);
+		_mm256_storeu_ps(&stream.m_vzs[elementIndex], vz);
+		_mm256_storeu_ps(&stream.m_ss[elementIndex], s);
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	NormalizeStream_SSE2(stream, elementIndex);
+}
+
+
+static void MultiplyStreams_SSE2(QuaternionStream const& streamA, QuaternionStream const& streamB, QuaternionStream& out_products, int firstIndex)
+{
+	int numElements = streamA.GetSize();
+	int elementIndex = firstIndex;
+	for (; elementIndex + 4 <= numElements; elementIndex += 4)
+	{
+		__m128 xA = _mm_loadu_ps(&streamA.m_vxs[elementIndex]);
+		__m128 yA = _mm_loadu_ps(&streamA.m_vys[elementIndex]);
+		__m128 zA = _mm_loadu_ps(&streamA.m_vzs[elementIndex]);
+		__m128 sA = _mm_loadu_ps(&streamA.m_ss[elementIndex]);
+		__m128 xB = _mm_loadu_ps(&streamB.m_vxs[elementIndex]);
+		__m128 yB = _mm_loadu_ps(&streamB.m_vys[elementIndex]);
+		__m128 zB = _mm_loadu_ps(&streamB.m_vzs[elementIndex]);
+		__m128 sB = _mm_loadu_ps(&streamB.m_ss[elementIndex]);
+
+		//s = sA sB - vA . vB, v = vA sB + vB sA + vA x vB
+		__m128 s = _mm_sub_ps(_mm_mul_ps(sA, sB), _mm_add_ps(_mm_add_ps(_mm_mul_ps(xA, xB), _mm_mul_ps(yA, yB)), _mm_mul_ps(zA, zB)));
+		__m128 x = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xA, sB), _mm_mul_ps(xB, sA)), _mm_sub_ps(_mm_mul_ps(yA, zB), _mm_mul_ps(zA, yB)));
+		__m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(yA, sB), _mm_mul_ps(yB, sA)), _mm_sub_ps(_mm_mul_ps(zA, xB), _mm_mul_ps(xA, zB)));
+		__m128 z = _mm_add_ps(_mm_add_ps(_mm_mul_ps(zA, sB), _mm_mul_ps(zB, sA)), _mm_sub_ps(_mm_mul_ps(xA, yB), _mm_mul_ps(yA, xB)));
+
+		_mm_storeu_ps(&out_products.m_vxs[elementIndex], x);
+		_mm_storeu_ps(&out_products.m_vys[elementIndex], y);
+		_mm_storeu_ps(&out_products.m_vzs[elementIndex], z);
+		_mm_storeu_ps(&out_products.m_ss[elementIndex], s);
+	}
+
+	for (; elementIndex < numElements; elementIndex++)
+	{
+		out_products.SetElement(elementIndex, streamA.GetElement(elementIndex) * streamB.GetElement(elementIndex));
+	}
+}
+
+
+SIMD_AVX2_FUNCTION static void MultiplyStreams_AVX2(QuaternionStream const& streamA, QuaternionStream const& streamB, QuaternionStream& out_products)
+{
+	int numElements = streamA.GetSize();
+	int elementIndex = 0;
+	for (; elementIndex + 8 <= numElements; elementIndex += 8)
+	{
+		__m256 xA = _mm256_loadu_ps(&streamA.m_vxs[elementIndex]);
+		__m256 yA = _mm256_loadu_ps(&streamA.m_vys[elementIndex]);
+		__m256 zA = _mm256_loadu_ps(&streamA.m_vzs[elementIndex]);
+		__m256 sA = _mm256_loadu_ps(&streamA.m_ss[elementIndex]);
+		__m256 xB = _mm256_loadu_ps(&streamB.m_vxs[elementIndex]);
+		__m256 yB = _mm256_loadu_ps(&streamB.m_vys[elementIndex]);
+		__m256 zB = _mm256_loadu_ps(&streamB.m_vzs[elementIndex]);
+		__m256 sB = _mm256_loadu_ps(&streamB.m_ss[elementIndex]);
+
+		__m256 s = _mm256_fmsub_ps(sA, sB, _mm256_fmadd_ps(xA, xB, _mm256_fmadd_ps(yA, yB, _mm256_mul_ps(zA, zB))));
+		__m256 x = _mm256_fmadd_ps(xA, sB, _mm256_fmadd_ps(xB, sA, _mm256_fmsub_ps(yA, zB, _mm256_mul_ps(zA, yB))));
+		__m256 y = _mm256_fmadd_ps(yA, sB, _mm256_fmadd_ps(yB, sA, _mm256_fmsub_ps(zA, xB, _mm256_mul_ps(xA, zB))));
+		__m256 z = _mm256_fmadd_ps(zA, sB, _mm256_fmadd_ps(zB, sA, _mm256_fmsub_ps(xA, yB, _mm256_mul_ps(yA, xB))));
+
+		_mm256_storeu_ps(&out_products.m_vxs[elementIndex], x);
+		_mm256_storeu_ps(&out_products.m_vys[elementIndex], y);
+		_mm256_storeu_ps(&out_products.m_vzs[elementIndex], z);
+		_mm256_storeu_ps(&out_products.m_ss[elementIndex], s);
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	MultiplyStreams_SSE2(streamA, streamB, out_products, elementIndex);
+}
+
+
+static void BlendStreams_SSE2(QuaternionStream const& startStream, QuaternionStream const& endStream, float fraction, bool isSlerp, QuaternionStream& out_blended, int firstIndex)
+{
+	__m128 signBit = _mm_set1_ps(-0.0f);
+	__m128 fractionLanes = _mm_set1_ps(fraction);
+	__m128 oneMinusFractionLanes = _mm_set1_ps(1.0f - fraction);
+
+	int numElements = startStream.GetSize();
+	int elementIndex = firstIndex;
+	for (; elementIndex + 4 <= numElements; elementIndex += 4)
+	{
+		__m128 xStart = _mm_loadu_ps(&startStream.m_vxs[elementIndex]);
+		__m128 yStart = _mm_loadu_ps(&startStream.m_vys[elementIndex]);
+		__m128 zStart = _mm_loadu_ps(&startStream.m_vzs[elementIndex]);
+		__m128 sStart = _mm_loadu_ps(&startStream.m_ss[elementIndex]);
+		__m128 xEnd = _mm_loadu_ps(&endStream.m_vxs[elementIndex]);
+		__m128 yEnd = _mm_loadu_ps(&endStream.m_vys[elementIndex]);
+		__m128 zEnd = _mm_loadu_ps(&endStream.m_vzs[elementIndex]);
+		__m128 sEnd = _mm_loadu_ps(&endStream.m_ss[elementIndex]);
+
+		//flip end where the dot product is negative to take the shorter arc
+		__m128 cosAngle = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xStart, xEnd), _mm_mul_ps(yStart, yEnd)), _mm_add_ps(_mm_mul_ps(zStart, zEnd), _mm_mul_ps(sStart, sEnd)));
+		__m128 endSign = _mm_and_ps(cosAngle, signBit);
+		cosAngle = _mm_xor_ps(cosAngle, endSign);
+		xEnd = _mm_xor_ps(xEnd, endSign);
+		yEnd = _mm_xor_ps(yEnd, endSign);
+		zEnd = _mm_xor_ps(zEnd, endSign);
+		sEnd = _mm_xor_ps(sEnd, endSign);
+
+		__m128 startWeight = oneMinusFractionLanes;
+		__m128 endWeight = fractionLanes;
+		if (isSlerp)
+		{
+			__m128 clampedCosine = _mm_min_ps(cosAngle, _mm_set1_ps(1.0f));
+			__m128 acosPolynomial = _mm_set1_ps(SLERP_ACOS_COEFFICIENTS[7]);
+			for (int coefficientIndex = 6; coefficientIndex >= 0; coefficientIndex--)
+			{
+				acosPolynomial = _mm_add_ps(_mm_mul_ps(acosPolynomial, clampedCosine), _mm_set1_ps(SLERP_ACOS_COEFFICIENTS[coefficientIndex]));
+			}
+			__m128 angle = _mm_mul_ps(_mm_sqrt_ps(_mm_sub_ps(_mm_set1_ps(1.0f), clampedCosine)), acosPolynomial);
+
+			//both partial angles are in [0, pi/2], where the sine series converges fast
+			__m128 startAngle = _mm_mul_ps(oneMinusFractionLanes, angle);
+			__m128 endAngle = _mm_mul_ps(fractionLanes, angle);
+			__m128 startAngleSquared = _mm_mul_ps(startAngle, startAngle);
+			__m128 endAngleSquared = _mm_mul_ps(endAngle, endAngle);
+			__m128 startSine = _mm_set1_ps(SLERP_SINE_COEFFICIENTS[4]);
+			__m128 endSine = startSine;
+			for (int coefficientIndex = 3; coefficientIndex >= 0; coefficientIndex--)
+			{
+				startSine = _mm_add_ps(_mm_mul_ps(startSine, startAngleSquared), _mm_set1_ps(SLERP_SINE_COEFFICIENTS[coefficientIndex]));
+				endSine = _mm_add_ps(_mm_mul_ps(endSine, endAngleSquared), _mm_set1_ps(SLERP_SINE_COEFFICIENTS[coefficientIndex]));
+			}
+			startSine = _mm_add_ps(startAngle, _mm_mul_ps(_mm_mul_ps(startAngle, startAngleSquared), startSine));
+			endSine = _mm_add_ps(endAngle, _mm_mul_ps(_mm_mul_ps(endAngle, endAngleSquared), endSine));
+
+			__m128 isFarApart = _mm_cmple_ps(cosAngle, _mm_set1_ps(SLERP_NLERP_COSINE_THRESHOLD));
+			startWeight = _mm_or_ps(_mm_and_ps(isFarApart, startSine), _mm_andnot_ps(isFarApart, startWeight));
+			endWeight = _mm_or_ps(_mm_and_ps(isFarApart, endSine), _mm_andnot_ps(isFarApart, endWeight));
+		}
+
+		__m128 x = _mm_add_ps(_mm_mul_ps(xStart, startWeight), _mm_mul_ps(xEnd, endWeight));
+		__m128 y = _mm_add_ps(_mm_mul_ps(yStart, startWeight), _mm_mul_ps(yEnd, endWeight));
+		__m128 z = _mm_add_ps(_mm_mul_ps(zStart, startWeight), _mm_mul_ps(zEnd, endWeight));
+		__m128 s = _mm_add_ps(_mm_mul_ps(sStart, startWeight), _mm_mul_ps(sEnd, endWeight));
+		NormalizeLanes_SSE2(x, y, z, s);
+
+		_mm_storeu_ps(&out_blended.m_vxs[elementIndex], x);
+		_mm_storeu_ps(&out_blended.m_vys[elementIndex], y);
+		_mm_storeu_ps(&out_blended.m_vzs[elementIndex], z);
+		_mm_storeu_ps(&out_blended.m_ss[elementIndex], s);
+	}
+
+	for (; elementIndex < numElements; elementIndex++)
+	{
+		out_blended.SetElement(elementIndex, BlendShortestArc(startStream.GetElement(elementIndex), endStream.GetElement(elementIndex), fraction, isSlerp));
+	}
+}
+
+
+SIMD_AVX2_FUNCTION static void BlendStreams_AVX2(QuaternionStream const& startStream, QuaternionStream const& endStream, float fraction, bool isSlerp, QuaternionStream& out_blended)
+{
+	__m256 signBit = _mm256_set1_ps(-0.0f);
+	__m256 fractionLanes = _mm256_set1_ps(fraction);
+	__m256 oneMinusFractionLanes = _mm256_set1_ps(1.0f - fraction);
+
+	int numElements = startStream.GetSize();
+	int elementIndex = 0;
+	for (; elementIndex + 8 <= numElements; elementIndex += 8)
+	{
+		__m256 xStart = _mm256_loadu_ps(&startStream.m_vxs[elementIndex]);
+		__m256 yStart = _mm256_loadu_ps(&startStream.m_vys[elementIndex]);
+		__m256 zStart = _mm256_loadu_ps(&startStream.m_vzs[elementIndex]);
+		__m256 sStart = _mm256_loadu_ps(&startStream.m_ss[elementIndex]);
+		__m256 xEnd = _mm256_loadu_ps(&endStream.m_vxs[elementIndex]);
+		__m256 yEnd = _mm256_loadu_ps(&endStream.m_vys[elementIndex]);
+		__m256 zEnd = _mm256_loadu_ps(&endStream.m_vzs[elementIndex]);
+		__m256 sEnd = _mm256_loadu_ps(&endStream.m_ss[elementIndex]);
+
+		__m256 cosAngle = _mm256_fmadd_ps(xStart, xEnd, _mm256_fmadd_ps(yStart, yEnd, _mm256_fmadd_ps(zStart, zEnd, _mm256_mul_ps(sStart, sEnd))));
+		__m256 endSign = _mm256_and_ps(cosAngle, signBit);
+		cosAngle = _mm256_xor_ps(cosAngle, endSign);
+		xEnd = _mm256_xor_ps(xEnd, endSign);
+		yEnd = _mm256_xor_ps(yEnd, endSign);
+		zEnd = _mm256_xor_ps(zEnd, endSign);
+		sEnd = _mm256_xor_ps(sEnd, endSign);
+
+		__m256 startWeight = oneMinusFractionLanes;
+		__m256 endWeight = fractionLanes;
+		if (isSlerp)
+		{
+			__m256 clampedCosine = _mm256_min_ps(cosAngle, _mm256_set1_ps(1.0f));
+			__m256 acosPolynomial = _mm256_set1_ps(SLERP_ACOS_COEFFICIENTS[7]);
+			for (int coefficientIndex = 6; coefficientIndex >= 0; coefficientIndex--)
+			{
+				acosPolynomial = _mm256_fmadd_ps(acosPolynomial, clampedCosine, _mm256_set1_ps(SLERP_ACOS_COEFFICIENTS[coefficientIndex]));
+			}
+			__m256 angle = _mm256_mul_ps(_mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0f), clampedCosine)), acosPolynomial);
+
+			__m256 startAngle = _mm256_mul_ps(oneMinusFractionLanes, angle);
+			__m256 endAngle = _mm256_mul_ps(fractionLanes, angle);
+			__m256 startAngleSquared = _mm256_mul_ps(startAngle, startAngle);
+			__m256 endAngleSquared = _mm256_mul_ps(endAngle, endAngle);
+			__m256 startSine = _mm256_set1_ps(SLERP_SINE_COEFFICIENTS[4]);
+			__m256 endSine = startSine;
+			for (int coefficientIndex = 3; coefficientIndex >= 0; coefficientIndex--)
+			{
+				startSine = _mm256_fmadd_ps(startSine, startAngleSquared, _mm256_set1_ps(SLERP_SINE_COEFFICIENTS[coefficientIndex]));
+				endSine = _mm256_fmadd_ps(endSine, endAngleSquared, _mm256_set1_ps(SLERP_SINE_COEFFICIENTS[coefficientIndex]));
+			}
+			startSine = _mm256_fmadd_ps(_mm256_mul_ps(startAngle, startAngleSquared), startSine, startAngle);
+			endSine = _mm256_fmadd_ps(_mm256_mul_ps(endAngle, endAngleSquared), endSine, endAngle);
+
+			__m256 isFarApart = _mm256_cmp_ps(cosAngle, _mm256_set1_ps(SLERP_NLERP_COSINE_THRESHOLD), _CMP_LE_OQ);
+			startWeight = _mm256_blendv_ps(startWeight, startSine, isFarApart);
+			endWeight = _mm256_blendv_ps(endWeight, endSine, isFarApart);
+		}
+
+		__m256 x = _mm256_fmadd_ps(xStart, startWeight, _mm256_mul_ps(xEnd, endWeight));
+		__m256 y = _mm256_fmadd_ps(yStart, startWeight, _mm256_mul_ps(yEnd, endWeight));
+		__m256 z = _mm256_fmadd_ps(zStart, startWeight, _mm256_mul_ps(zEnd, endWeight));
+		__m256 s = _mm256_fmadd_ps(sStart, startWeight, _mm256_mul_ps(sEnd, endWeight));
+		NormalizeLanes_AVX2(x, y, z, s);
+
+		_mm256_storeu_ps(&out_blended.m_vxs[elementIndex], x);
+		_mm256_storeu_ps(&out_blended.m_vys[elementIndex], y);
+		_mm256_storeu_ps(&out_blended.m_vzs[elementIndex], z);
+		_mm256_storeu_ps(&out_blended.m_ss[elementIndex], s);
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	BlendStreams_SSE2(startStream, endStream, fraction, isSlerp, out_blended, elementIndex);
+}
+
+
+//four lanes' 3x3 rotations, one register per matrix entry, go out through transposes so each store writes one matrix column
+static inline void StoreRotMatrices_SSE2(__m128 const* entries, Mat44* out_matrices)
+{
+	__m128 zero = _mm_setzero_ps();
+	for (int basisIndex = 0; basisIndex < 3; basisIndex++)
+	{
+		__m128 xs = entries[basisIndex * 3];
+		__m128 ys = entries[basisIndex * 3 + 1];
+		__m128 zs = entries[basisIndex * 3 + 2];
+		__m128 ws = zero;
+		_MM_TRANSPOSE4_PS(xs, ys, zs, ws);
+
+		_mm_storeu_ps(&out_matrices[0].m_values[basisIndex * 4], xs);
+		_mm_storeu_ps(&out_matrices[1].m_values[basisIndex * 4], ys);
+		_mm_storeu_ps(&out_matrices[2].m_values[basisIndex * 4], zs);
+		_mm_storeu_ps(&out_matrices[3].m_values[basisIndex * 4], ws);
+	}
+
+	__m128 translation = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+	for (int laneIndex = 0; laneIndex < 4; laneIndex++)
+	{
+		_mm_storeu_ps(&out_matrices[laneIndex].m_values[Mat44::Tx], translation);
+	}
+}
+
+
+static void GetRotMatrices_SSE2(QuaternionStream const& stream, Mat44* out_matrices, int firstIndex)
+{
+	__m128 one = _mm_set1_ps(1.0f);
+	__m128 two = _mm_set1_ps(2.0f);
+
+	int numElements = stream.GetSize();
+	int elementIndex = firstIndex;
+	for (; elementIndex + 4 <= numElements; elementIndex += 4)
+	{
+		__m128 x = _mm_loadu_ps(&stream.m_vxs[elementIndex]);
+		__m128 y = _mm_loadu_ps(&stream.m_vys[elementIndex]);
+		__m128 z = _mm_loadu_ps(&stream.m_vzs[elementIndex]);
+		__m128 s = _mm_loadu_ps(&stream.m_ss[elementIndex]);
+
+		__m128 xx = _mm_mul_ps(two, _mm_mul_ps(x, x));
+		__m128 yy = _mm_mul_ps(two, _mm_mul_ps(y, y));
+		__m128 zz = _mm_mul_ps(two, _mm_mul_ps(z, z));
+		__m128 xy = _mm_mul_ps(two, _mm_mul_ps(x, y));
+		__m128 xz = _mm_mul_ps(two, _mm_mul_ps(x, z));
+		__m128 yz = _mm_mul_ps(two, _mm_mul_ps(y, z));
+		__m128 xs = _mm_mul_ps(two, _mm_mul_ps(x, s));
+		__m128 ys = _mm_mul_ps(two, _mm_mul_ps(y, s));
+		__m128 zs = _mm_mul_ps(two, _mm_mul_ps(z, s));
+
+		__m128 entries[9] = {
+			_mm_sub_ps(_mm_sub_ps(one, yy), zz),	_mm_add_ps(xy, zs),						_mm_sub_ps(xz, ys),
+			_mm_sub_ps(xy, zs),						_mm_sub_ps(_mm_sub_ps(one, xx), zz),	_mm_add_ps(yz, xs),
+			_mm_add_ps(xz, ys),						_mm_sub_ps(yz, xs),						_mm_sub_ps(_mm_sub_ps(one, xx), yy) };
+		StoreRotMatrices_SSE2(entries, &out_matrices[elementIndex]);
+	}
+
+	for (; elementIndex < numElements; elementIndex++)
+	{
+		out_matrices[elementIndex] = stream.GetElement(elementIndex).GetAsRotMatrix();
+	}
+}
+
+
+SIMD_AVX2_FUNCTION static void GetRotMatrices_AVX2(QuaternionStream const& stream, Mat44* out_matrices)
+{
+	__m256 one = _mm256_set1_ps(1.0f);
+	__m256 two = _mm256_set1_ps(2.0f);
+
+	int numElements = stream.GetSize();
+	int elementIndex = 0;
+	for (; elementIndex + 8 <= numElements; elementIndex += 8)
+	{
+		__m256 x = _mm256_loadu_ps(&stream.m_vxs[elementIndex]);
+		__m256 y = _mm256_loadu_ps(&stream.m_vys[elementIndex]);
+		__m256 z = _mm256_loadu_ps(&stream.m_vzs[elementIndex]);
+		__m256 s = _mm256_loadu_ps(&stream.m_ss[elementIndex]);
+
+		__m256 twoX = _mm256_mul_ps(two, x);
+		__m256 twoY = _mm256_mul_ps(two, y);
+		__m256 twoZ = _mm256_mul_ps(two, z);
+		__m256 xx = _mm256_mul_ps(twoX, x);
+		__m256 yy = _mm256_mul_ps(twoY, y);
+		__m256 zz = _mm256_mul_ps(twoZ, z);
+		__m256 xy = _mm256_mul_ps(twoX, y);
+		__m256 xz = _mm256_mul_ps(twoX, z);
+		__m256 yz = _mm256_mul_ps(twoY, z);
+		__m256 xs = _mm256_mul_ps(twoX, s);
+		__m256 ys = _mm256_mul_ps(twoY, s);
+		__m256 zs = _mm256_mul_ps(twoZ, s);
+
+		__m256 entries[9] = {
+			_mm256_sub_ps(_mm256_sub_ps(one, yy), zz),	_mm256_add_ps(xy, zs),						_mm256_sub_ps(xz, ys),
+			_mm256_sub_ps(xy, zs),						_mm256_sub_ps(_mm256_sub_ps(one, xx), zz),	_mm256_add_ps(yz, xs),
+			_mm256_add_ps(xz, ys),						_mm256_sub_ps(yz, xs),						_mm256_sub_ps(_mm256_sub_ps(one, xx), yy) };
+
+		//the transposes work on 4 lanes, so split each 8 lane register into its halves
+		__m128 lowEntries[9];
+		__m128 highEntries[9];
+		for (int entryIndex = 0; entryIndex < 9; entryIndex++)
+		{
+			lowEntries[entryIndex] = _mm256_castps256_ps128(entries[entryIndex]);
+			highEntries[entryIndex] = _mm256_extractf128_ps(entries[entryIndex], 1);
+		}
+		StoreRotMatrices_SSE2(lowEntries, &out_matrices[elementIndex]);
+		StoreRotMatrices_SSE2(highEntries, &out_matrices[elementIndex + 4]);
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	GetRotMatrices_SSE2(stream, out_matrices, elementIndex);
+}
+#endif
+
+
+//
+//constructors
+//
+QuaternionStream::QuaternionStream(int numElements)
+{
+	Resize(numElements);
+}
+
+
+QuaternionStream::QuaternionStream(std::vector<Quaternion> const& quaternions)
+{
+	SetFromQuaternions(quaternions);
+}
+
+
+//
+//accessors
+//
+void QuaternionStream::GetAsRotMatrices(Mat44* out_matrices) const
+{
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		GetRotMatrices_AVX2(*this, out_matrices);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		GetRotMatrices_SSE2(*this, out_matrices, 0);
+		return;
+	}
+#endif
+
+	for (int elementIndex = 0; elementIndex < GetSize(); elementIndex++)
+	{
+		out_matrices[elementIndex] = GetElement(elementIndex).GetAsRotMatrix();
+	}
+}
+
+
+//
+//mutators
+//
+void QuaternionStream::Resize(int numElements)
+{
+	m_vxs.resize(numElements);
+	m_vys.resize(numElements);
+	m_vzs.resize(numElements);
+	m_ss.resize(numElements);
+}
+
+
+void QuaternionStream::Reserve(int numElements)
+{
+	m_vxs.reserve(numElements);
+	m_vys.reserve(numElements);
+	m_vzs.reserve(numElements);
+	m_ss.reserve(numElements);
+}
+
+
+void QuaternionStream::Clear()
+{
+	m_vxs.clear();
+	m_vys.clear();
+	m_vzs.clear();
+	m_ss.clear();
+}
+
+
+void QuaternionStream::SetElement(int elementIndex, Quaternion const& quaternion)
+{
+	m_vxs[elementIndex] = quaternion.v.x;
+	m_vys[elementIndex] = quaternion.v.y;
+	m_vzs[elementIndex] = quaternion.v.z;
+	m_ss[elementIndex] = quaternion.s;
+}
+
+
+void QuaternionStream::PushBack(Quaternion const& quaternion)
+{
+	m_vxs.push_back(quaternion.v.x);
+	m_vys.push_back(quaternion.v.y);
+	m_vzs.push_back(quaternion.v.z);
+	m_ss.push_back(quaternion.s);
+}
+
+
+//
+//bulk math functions
+//
+void QuaternionStream::Normalize()
+{
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		NormalizeStream_AVX2(*this);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		NormalizeStream_SSE2(*this, 0);
+		return;
+	}
+#endif
+
+	for (int elementIndex = 0; elementIndex < GetSize(); elementIndex++)
+	{
+		Quaternion quaternion = GetElement(elementIndex);
+		quaternion.Normalize();
+		SetElement(elementIndex, quaternion);
+	}
+}
+
+
+//
+//static bulk math functions
+//
+void QuaternionStream::Multiply(QuaternionStream const& streamA, QuaternionStream const& streamB, QuaternionStream& out_products)
+{
+	GUARANTEE_OR_DIE(streamA.GetSize() == streamB.GetSize(), "Tried to multiply QuaternionStreams of different sizes!");
+	out_products.Resize(streamA.GetSize());
+
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		MultiplyStreams_AVX2(streamA, streamB, out_products);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		MultiplyStreams_SSE2(streamA, streamB, out_products, 0);
+		return;
+	}
+#endif
+
+	for (int elementIndex = 0; elementIndex < streamA.GetSize(); elementIndex++)
+	{
+		out_products.SetElement(elementIndex, streamA.GetElement(elementIndex) * streamB.GetElement(elementIndex));
+	}
+}
+
+
+void QuaternionStream::Nlerp(QuaternionStream const& startStream, QuaternionStream const& endStream, float fraction, QuaternionStream& out_blended)
+{
+	GUARANTEE_OR_DIE(startStream.GetSize() == endStream.GetSize(), "Tried to nlerp QuaternionStreams of different sizes!");
+	out_blended.Resize(startStream.GetSize());
+
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		BlendStreams_AVX2(startStream, endStream, fraction, false, out_blended);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		BlendStreams_SSE2(startStream, endStream, fraction, false, out_blended, 0);
+		return;
+	}
+#endif
+
+	for (int elementIndex = 0; elementIndex < startStream.GetSize(); elementIndex++)
+	{
+		out_blended.SetElement(elementIndex, BlendShortestArc(startStream.GetElement(elementIndex), endStream.GetElement(elementIndex), fraction, false));
+	}
+}
+
+
+void QuaternionStream::Slerp(QuaternionStream const& startStream, QuaternionStream const& endStream, float fraction, QuaternionStream& out_blended)
+{
+	GUARANTEE_OR_DIE(startStream.GetSize() == endStream.GetSize(), "Tried to slerp QuaternionStreams of different sizes!");
+	out_blended.Resize(startStream.GetSize());
+
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		BlendStreams_AVX2(startStream, endStream, fraction, true, out_blended);
+		return;
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		BlendStreams_SSE2(startStream, endStream, fraction, true, out_blended, 0);
+		return;
+	}
+#endif
+
+	for (int elementIndex = 0; elementIndex < startStream.GetSize(); elementIndex++)
+	{
+		out_blended.SetElement(elementIndex, BlendShortestArc(startStream.GetElement(elementIndex), endStream.GetElement(elementIndex), fraction, true));
+	}
+}
+
+
+//
+//conversion functions
+//
+void QuaternionStream::SetFromQuaternions(std::vector<Quaternion> const& quaternions)
+{
+	Resize(static_cast<int>(quaternions.size()));
+	for (int elementIndex = 0; elementIndex < GetSize(); elementIndex++)
+	{
+		SetElement(elementIndex, quaternions[elementIndex]);
+	}
+}
+
+
+void QuaternionStream::CopyToQuaternions(std::vector<Quaternion>& out_quaternions) const
+{
+	out_quaternions.resize(GetSize());
+	for (int elementIndex = 0; elementIndex < GetSize(); elementIndex++)
+	{
+		out_quaternions[elementIndex] = GetElement(elementIndex);
+	}
+}
@@ -0,0 +1,52 @@
+#pragma once
+#include "Engine/Math/Quaternion.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//forward declarations
+struct Mat44;
+
+
+//structure-of-arrays list of Quaternions, each component lives in its own array so bulk math runs 4 (SSE2) or 8 (AVX2) quaternions per instruction
+//meant for animation work over whole skeletons (e.g. blending two poses' bone rotations), see SIMDUtils for how kernels are picked
+class QuaternionStream
+{
+//public member functions
+public:
+	//constructors
+	QuaternionStream() {}
+	explicit QuaternionStream(int numElements);
+	explicit QuaternionStream(std::vector<Quaternion> const& quaternions);
+
+	//accessors
+	int				 GetSize() const { return static_cast<int>(m_ss.size()); }
+	Quaternion const GetElement(int elementIndex) const { return Quaternion(m_vxs[elementIndex], m_vys[elementIndex], m_vzs[elementIndex], m_ss[elementIndex]); }
+	void			 GetAsRotMatrices(Mat44* out_matrices) const;	//one per element, same as Quaternion::GetAsRotMatrix
+
+	//mutators
+	void Resize(int numElements);
+	void Reserve(int numElements);
+	void Clear();
+	void SetElement(int elementIndex, Quaternion const& quaternion);
+	void PushBack(Quaternion const& quaternion);
+
+	//bulk math functions
+	void Normalize();	//zero-length elements are left as they are, same as Quaternion::Normalize
+
+	//static bulk math functions, streams used together must be the same size, the output is resized and may be one of the inputs
+	//the blends go the short way around (negating end where the dot product is negative), so they expect unit quaternions
+	static void Multiply(QuaternionStream const& streamA, QuaternionStream const& streamB, QuaternionStream& out_products);	//A * B element by element
+	static void Nlerp(QuaternionStream const& startStream, QuaternionStream const& endStream, float fraction, QuaternionStream& out_blended);
+	static void Slerp(QuaternionStream const& startStream, QuaternionStream const& endStream, float fraction, QuaternionStream& out_blended);	//nlerps nearly equal pairs
+
+	//conversion functions
+	void SetFromQuaternions(std::vector<Quaternion> const& quaternions);
+	void CopyToQuaternions(std::vector<Quaternion>& out_quaternions) const;
+
+//public member variables
+public:
+	std::vector<float> m_vxs;
+	std::vector<float> m_vys;
+	std::vector<float> m_vzs;
+	std::vector<float> m_ss;
+};
@@ -1,65 +1,350 @@
-#include "Engine/Math/RandomNumberGenerator.hpp"
-#include "ThirdParty/Squirrel/RawNoise.hpp"
-#include <time.h>
-
-
-//
-//random integer functions
-//
-int RandomNumberGenerator::RollRandomIntLessThan(int maxNotInclusive)
-{
-	//return rand() % maxNotInclusive;
-
-	unsigned int randomInt = Get1dNoiseUint(m_position, m_seed);
-	m_position++;
-	return randomInt % maxNotInclusive;
-}
-
-
-int RandomNumberGenerator::RollRandomIntInRange(int minInclusive, int maxInclusive)
-{
-	int possibilities = 1 + (maxInclusive - minInclusive);
-	return RollRandomIntLessThan(possibilities) + minInclusive;
-}
-
-
-//
-//random float functions
-//
-float RandomNumberGenerator::RollRandomFloatZeroToOne()
-{
-	//return float(rand()) / float(RAND_MAX);
-	
-	float randomFloat = Get1dNoiseZeroToOne(m_position, m_seed);
-	m_position++;
-	
-	return randomFloat;
-}
-
-
-float RandomNumberGenerator::RollRandomFloatInRange(float minInclusive, float maxInclusive)
-{
-	float range = maxInclusive - minInclusive;
-	return minInclusive + RollRandomFloatZeroToOne() * range;
-}
-
-
-//
-//seeding functions
-//
-void RandomNumberGenerator::SeedRNGWithTime()
-{
-	/*int currentTime = static_cast<int>(time(NULL));
-
-	srand(currentTime);*/
-
-	m_seed = static_cast<int>(time(NULL));
-}
-
-
-void RandomNumberGenerator::SeedRNG(unsigned int seed)
-{
-	//srand(seed);
-
-	m_seed = seed;
-}
+#include "Engine/Math/RandomNumberGenerator.hpp"
+#include "Engine/Math/RawNoiseSIMD.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include "ThirdParty/Squirrel/RawNoise.hpp"
+#include <stdint.h>
+#include <time.h>
+
+
+//substream seeds come from hashing the stream index at this y, well away from the small y values redraws use
+constexpr int RNG_SUBSTREAM_NOISE_Y = -1;
+
+
+//
+//static functions
+//
+//positions wrap around like unsigned ints instead of overflowing
+static int GetPositionAfter(int position, int numSteps)
+{
+	return static_cast<int>(static_cast<unsigned int>(position) + static_cast<unsigned int>(numSteps));
+}
+
+
+//maps a draw onto [0, range) with Lemire's multiply-shift, rejecting the few low draws that would make some results more likely than others
+//rejected draws are redrawn at the same position with the next y in the 2D hash (y = 0 is the 1D draw), so every value still uses exactly one position
+//a range of 0 means all 2^32 values
+static unsigned int GetUnbiasedUintLessThan(int position, unsigned int seed, unsigned int range)
+{
+	unsigned int randomUint = Get1dNoiseUint(position, seed);
+	if (range == 0)
+	{
+		return randomUint;
+	}
+
+	uint64_t product = static_cast<uint64_t>(randomUint) * range;
+	unsigned int productLow = static_cast<unsigned int>(product);
+	if (productLow < range)
+	{
+		unsigned int rejectionThreshold = (0u - range) % range;
+		for (int redrawIndex = 1; productLow < rejectionThreshold; redrawIndex++)
+		{
+			randomUint = Get2dNoiseUint(position, redrawIndex, seed);
+			product = static_cast<uint64_t>(randomUint) * range;
+			productLow = static_cast<unsigned int>(product);
+		}
+	}
+
+	return static_cast<unsigned int>(product >> 32);
+}
+
+
+static void FillFloatsInRange_Scalar(unsigned int seed, int firstPosition, float minInclusive, float range, int numValues, float* out_values, int firstIndex)
+{
+	for (int valueIndex = firstIndex; valueIndex < numValues; valueIndex++)
+	{
+		out_values[valueIndex] = minInclusive + Get1dNoiseZeroToOne(GetPositionAfter(firstPosition, valueIndex), seed) * range;
+	}
+}
+
+
+static void FillIntsInRange_Scalar(unsigned int seed, int firstPosition, int minInclusive, unsigned int range, int numValues, int* out_values, int firstIndex)
+{
+	for (int valueIndex = firstIndex; valueIndex < numValues; valueIndex++)
+	{
+		unsigned int offset = GetUnbiasedUintLessThan(GetPositionAfter(firstPosition, valueIndex), seed, range);
+		out_values[valueIndex] = static_cast<int>(static_cast<unsigned int>(minInclusive) + offset);
+	}
+}
+
+
+#if defined(ENGINE_SIMD_X86)
+//each kernel runs from firstIndex to the end of the list, AVX2 hands its leftovers to SSE2 and SSE2 to the scalar code
+static void FillFloatsInRange_SSE2(unsigned int seed, int firstPosition, float minInclusive, float range, int numValues, float* out_values, int firstIndex)
+{
+	__m128i seedLanes = _mm_set1_epi32(static_cast<int>(seed));
+	__m128i laneOffsets = _mm_setr_epi32(0, 1, 2, 3);
+	__m128 minLanes = _mm_set1_ps(minInclusive);
+	__m128 rangeLanes = _mm_set1_ps(range);
+
+	int valueIndex = firstIndex;
+	for (; valueIndex + 4 <= numValues; valueIndex += 4)
+	{
+		__m128i positions = _mm_add_epi32(_mm_set1_epi32(GetPositionAfter(firstPosition, valueIndex)), laneOffsets);
+		__m128 zeroToOnes = GetNoiseZeroToOne_SSE2(GetNoiseUints_SSE2(positions, seedLanes));
+		_mm_storeu_ps(&out_values[valueIndex], _mm_add_ps(minLanes, _mm_mul_ps(zeroToOnes, rangeLanes)));
+	}
+
+	FillFloatsInRange_Scalar(seed, firstPosition, minInclusive, range, numValues, out_values, valueIndex);
+}
+
+
+static void FillIntsInRange_SSE2(unsigned int seed, int firstPosition, int minInclusive, unsigned int range, int numValues, int* out_values, int firstIndex)
+{
+	__m128i seedLanes = _mm_set1_epi32(static_cast<int>(seed));
+	__m128i laneOffsets = _mm_setr_epi32(0, 1, 2, 3);
+	__m128i minLanes = _mm_set1_epi32(minInclusive);
+	__m128i rangeLanes = _mm_set1_epi32(static_cast<int>(range));
+
+	//flipping the top bit lets the signed compare order unsigned ints
+	__m128i signBit = _mm_set1_epi32(static_cast<int>(0x80000000));
+	__m128i offsetThreshold = _mm_xor_si128(_mm_set1_epi32(static_cast<int>((0u - range) % range)), signBit);
+
+	int valueIndex = firstIndex;
+	for (; valueIndex + 4 <= numValues; valueIndex += 4)
+	{
+		__m128i positions = _mm_add_epi32(_mm_set1_epi32(GetPositionAfter(firstPosition, valueIndex)), laneOffsets);
+		__m128i randomUints = GetNoiseUints_SSE2(positions, seedLanes);
+
+		//64 bit products of the even and odd lanes, split back into their high and low halves
+		__m128i evenProducts = _mm_mul_epu32(randomUints, rangeLanes);
+		__m128i oddProducts = _mm_mul_epu32(_mm_srli_epi64(randomUints, 32), rangeLanes);
+		__m128i productHighs = _mm_unpacklo_epi32(_mm_shuffle_epi32(evenProducts, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_epi32(oddProducts, _MM_SHUFFLE(3, 1, 3, 1)));
+		__m128i productLows = _mm_unpacklo_epi32(_mm_shuffle_epi32(evenProducts, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_epi32(oddProducts, _MM_SHUFFLE(2, 0, 2, 0)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(&out_values[valueIndex]), _mm_add_epi32(minLanes, productHighs));
+
+		//rejections are rare (under range / 2^32 per value), so just redo the whole group
+		__m128i isRejected = _mm_cmpgt_epi32(offsetThreshold, _mm_xor_si128(productLows, signBit));
+		if (_mm_movemask_epi8(isRejected) != 0)
+		{
+			FillIntsInRange_Scalar(seed, firstPosition, minInclusive, range, valueIndex + 4, out_values, valueIndex);
+		}
+	}
+
+	FillIntsInRange_Scalar(seed, firstPosition, minInclusive, range, numValues, out_values, valueIndex);
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static void FillFloatsInRange_AVX2(unsigned int seed, int firstPosition, float minInclusive, float range, int numValues, float* out_values)
+{
+	__m256i seedLanes = _mm256_set1_epi32(static_cast<int>(seed));
+	__m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256 minLanes = _mm256_set1_ps(minInclusive);
+	__m256 rangeLanes = _mm256_set1_ps(range);
+
+	int valueIndex = 0;
+	for (; valueIndex + 8 <= numValues; valueIndex += 8)
+	{
+		//multiply then add rather than FMA, to match the scalar rolls exactly
+		__m256i positions = _mm256_add_epi32(_mm256_set1_epi32(GetPositionAfter(firstPosition, valueIndex)), laneOffsets);
+		__m256 zeroToOnes = GetNoiseZeroToOne_AVX2(GetNoiseUints_AVX2(positions, seedLanes));
+		_mm256_storeu_ps(&out_values[valueIndex], _mm256_add_ps(minLanes, _mm256_mul_ps(zeroToOnes, rangeLanes)));
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	FillFloatsInRange_SSE2(seed, firstPosition, minInclusive, range, numValues, out_values, valueIndex);
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION static void FillIntsInRange_AVX2(unsigned int seed, int firstPosition, int minInclusive, unsigned int range, int numValues, int* out_values)
+{
+	__m256i seedLanes = _mm256_set1_epi32(static_cast<int>(seed));
+	__m256i laneOffsets = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+	__m256i minLanes = _mm256_set1_epi32(minInclusive);
+	__m256i rangeLanes = _mm256_set1_epi32(static_cast<int>(range));
+	__m256i signBit = _mm256_set1_epi32(static_cast<int>(0x80000000));
+	__m256i offsetThreshold = _mm256_xor_si256(_mm256_set1_epi32(static_cast<int>((0u - range) % range)), signBit);
+
+	int valueIndex = 0;
+	for (; valueIndex + 8 <= numValues; valueIndex += 8)
+	{
+		__m256i positions = _mm256_add_epi32(_mm256_set1_epi32(GetPositionAfter(firstPosition, valueIndex)), laneOffsets);
+		__m256i randomUints = GetNoiseUints_AVX2(positions, seedLanes);
+
+		//odd lane products already have their high halves in the odd lanes, so blends put the halves back together
+		__m256i evenProducts = _mm256_mul_epu32(randomUints, rangeLanes);
+		__m256i oddProducts = _mm256_mul_epu32(_mm256_srli_epi64(randomUints, 32), rangeLanes);
+		__m256i productHighs = _mm256_blend_epi32(_mm256_srli_epi64(evenProducts, 32), oddProducts, 0xAA);
+		__m256i productLows = _mm256_blend_epi32(evenProducts, _mm256_slli_epi64(oddProducts, 32), 0xAA);
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(&out_values[valueIndex]), _mm256_add_epi32(minLanes, productHighs));
+
+		__m256i isRejected = _mm256_cmpgt_epi32(offsetThreshold, _mm256_xor_si256(productLows, signBit));
+		if (_mm256_movemask_epi8(isRejected) != 0)
+		{
+			FillIntsInRange_Scalar(seed, firstPosition, minInclusive, range, valueIndex + 8, out_values, valueIndex);
+		}
+	}
+
+	//avoid SSE/AVX transition stalls in whatever runs next
+	_mm256_zeroupper();
+
+	FillIntsInRange_SSE2(seed, firstPosition, minInclusive, range, numValues, out_values, valueIndex);
+}
+#endif
+
+
+//
+//constructors
+//
+RandomNumberGenerator::RandomNumberGenerator(unsigned int seed, int position)
+	: m_seed(seed)
+	, m_position(position)
+{
+}
+
+
+//
+//random integer functions
+//
+int RandomNumberGenerator::RollRandomIntLessThan(int maxNotInclusive)
+{
+	GUARANTEE_OR_DIE(maxNotInclusive > 0, "Tried to roll a random int less than a number that isn't positive!");
+
+	unsigned int randomInt = GetUnbiasedUintLessThan(m_position, m_seed, static_cast<unsigned int>(maxNotInclusive));
+	m_position++;
+	return static_cast<int>(randomInt);
+}
+
+
+int RandomNumberGenerator::RollRandomIntInRange(int minInclusive, int maxInclusive)
+{
+	int randomInt = GetRandomIntInRangeAtPosition(m_position, minInclusive, maxInclusive);
+	m_position++;
+	return randomInt;
+}
+
+
+//
+//random float functions
+//
+float RandomNumberGenerator::RollRandomFloatZeroToOne()
+{
+	float randomFloat = Get1dNoiseZeroToOne(m_position, m_seed);
+	m_position++;
+	
+	return randomFloat;
+}
+
+
+float RandomNumberGenerator::RollRandomFloatInRange(float minInclusive, float maxInclusive)
+{
+	float range = maxInclusive - minInclusive;
+	return minInclusive + RollRandomFloatZeroToOne() * range;
+}
+
+
+//
+//bulk functions
+//
+void RandomNumberGenerator::FillFloatsZeroToOne(int numValues, float* out_values)
+{
+	//0 + value * 1 is exactly the value, so this matches RollRandomFloatZeroToOne too
+	FillFloatsInRange(numValues, 0.0f, 1.0f, out_values);
+}
+
+
+void RandomNumberGenerator::FillFloatsInRange(int numValues, float minInclusive, float maxInclusive, float* out_values)
+{
+	float range = maxInclusive - minInclusive;
+
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		FillFloatsInRange_AVX2(m_seed, m_position, minInclusive, range, numValues, out_values);
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		FillFloatsInRange_SSE2(m_seed, m_position, minInclusive, range, numValues, out_values, 0);
+	}
+	else
+#endif
+	{
+		FillFloatsInRange_Scalar(m_seed, m_position, minInclusive, range, numValues, out_values, 0);
+	}
+
+	m_position = GetPositionAfter(m_position, numValues);
+}
+
+
+void RandomNumberGenerator::FillIntsInRange(int numValues, int minInclusive, int maxInclusive, int* out_values)
+{
+	GUARANTEE_OR_DIE(minInclusive <= maxInclusive, "Tried to fill random ints in a range whose min is above its max!");
+
+	//a range of 0 means every int, the SIMD kernels leave that rare case to the scalar code
+	unsigned int range = static_cast<unsigned int>(maxInclusive) - static_cast<unsigned int>(minInclusive) + 1u;
+
+#if defined(ENGINE_SIMD_X86)
+	SIMDLevel simdLevel = (range == 0) ? SIMDLevel::SCALAR : GetSIMDLevel();
+	if (simdLevel == SIMDLevel::AVX2)
+	{
+		FillIntsInRange_AVX2(m_seed, m_position, minInclusive, range, numValues, out_values);
+	}
+	else if (simdLevel == SIMDLevel::SSE2)
+	{
+		FillIntsInRange_SSE2(m_seed, m_position, minInclusive, range, numValues, out_values, 0);
+	}
+	else
+#endif
+	{
+		FillIntsInRange_Scalar(m_seed, m_position, minInclusive, range, numValues, out_values, 0);
+	}
+
+	m_position = GetPositionAfter(m_position, numValues);
+}
+
+
+//
+//random access functions
+//
+unsigned int RandomNumberGenerator::GetRandomUintAtPosition(int position) const
+{
+	return Get1dNoiseUint(position, m_seed);
+}
+
+
+float RandomNumberGenerator::GetRandomFloatZeroToOneAtPosition(int position) const
+{
+	return Get1dNoiseZeroToOne(position, m_seed);
+}
+
+
+int RandomNumberGenerator::GetRandomIntInRangeAtPosition(int position, int minInclusive, int maxInclusive) const
+{
+	GUARANTEE_OR_DIE(minInclusive <= maxInclusive, "Tried to roll a random int in a range whose min is above its max!");
+
+	unsigned int range = static_cast<unsigned int>(maxInclusive) - static_cast<unsigned int>(minInclusive) + 1u;
+	unsigned int offset = GetUnbiasedUintLessThan(position, m_seed, range);
+	return static_cast<int>(static_cast<unsigned int>(minInclusive) + offset);
+}
+
+
+//
+//substream functions
+//
+RandomNumberGenerator const RandomNumberGenerator::GetSubstream(unsigned int streamIndex) const
+{
+	return RandomNumberGenerator(Get2dNoiseUint(static_cast<int>(streamIndex), RNG_SUBSTREAM_NOISE_Y, m_seed));
+}
+
+
+//
+//seeding functions
+//
+void RandomNumberGenerator::SeedRNGWithTime()
+{
+	/*int currentTime = static_cast<int>(time(NULL));
+
+	srand(currentTime);*/
+
+	m_seed = static_cast<int>(time(NULL));
+}
+
+
+void RandomNumberGenerator::SeedRNG(unsigned int seed)
+{
+	//srand(seed);
+
+	m_seed = seed;
+}
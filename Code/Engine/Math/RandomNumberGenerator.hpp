@@ -1,23 +1,44 @@
-#pragma once
-
-class RandomNumberGenerator
-{
-//public member functions
-public:
-	//random integer functions
-	int RollRandomIntLessThan(int maxNotInclusive);
-	int RollRandomIntInRange(int minInclusive, int maxInclusive);
-
-	//random float functions
-	float RollRandomFloatZeroToOne();
-	float RollRandomFloatInRange(float minInclusive, float maxInclusive);
-
-	//seeding functions
-	void SeedRNGWithTime();
-	void SeedRNG(unsigned int seed);
-
-//public member variables
-public:
-	unsigned int m_seed = 0;
-	int m_position = 0;
-};
+#pragma once
+
+//rolls are counter based, value n of a stream is just a hash of (n, seed), so any value can be had without generating the ones before it
+class RandomNumberGenerator
+{
+//public member functions
+public:
+	//constructors
+	RandomNumberGenerator() {}
+	explicit RandomNumberGenerator(unsigned int seed, int position = 0);
+
+	//random integer functions, every value in the range is equally likely
+	int RollRandomIntLessThan(int maxNotInclusive);
+	int RollRandomIntInRange(int minInclusive, int maxInclusive);
+
+	//random float functions
+	float RollRandomFloatZeroToOne();
+	float RollRandomFloatInRange(float minInclusive, float maxInclusive);
+
+	//bulk functions, the same values (and the same m_position afterwards) as numValues calls to the matching roll function
+	//generated 4 (SSE2) or 8 (AVX2) at a time
+	void FillFloatsZeroToOne(int numValues, float* out_values);
+	void FillFloatsInRange(int numValues, float minInclusive, float maxInclusive, float* out_values);
+	void FillIntsInRange(int numValues, int minInclusive, int maxInclusive, int* out_values);
+
+	//random access functions, the value a roll at that position would give without moving m_position, safe to call from several threads at once
+	unsigned int GetRandomUintAtPosition(int position) const;
+	float		 GetRandomFloatZeroToOneAtPosition(int position) const;
+	int			 GetRandomIntInRangeAtPosition(int position, int minInclusive, int maxInclusive) const;
+
+	//substream functions
+	//an independent generator for a worker, entity, chunk etc. that depends only on m_seed and streamIndex
+	//key parallel work's substreams by task or entity index rather than thread index and the results won't depend on the thread count
+	RandomNumberGenerator const GetSubstream(unsigned int streamIndex) const;
+
+	//seeding functions
+	void SeedRNGWithTime();
+	void SeedRNG(unsigned int seed);
+
+//public member variables
+public:
+	unsigned int m_seed = 0;
+	int m_position = 0;
+};
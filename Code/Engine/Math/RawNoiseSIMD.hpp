@@ -0,0 +1,73 @@
+#pragma once
+#include "Engine/Math/SIMDUtils.hpp"
+
+
+//SSE2 and AVX2 versions of Squirrel's raw noise (RawNoise.hpp), shared by the kernels that hash many positions at once
+//they give exactly the same bits as Get1dNoiseUint and Get1dNoiseZeroToOne, so SIMD and scalar paths can be mixed freely
+#if defined(ENGINE_SIMD_X86)
+//these mirror RawNoise.hpp
+constexpr unsigned int RAW_NOISE_BIT_NOISE1 = 0xd2a80a23;
+constexpr unsigned int RAW_NOISE_BIT_NOISE2 = 0xa884f197;
+constexpr unsigned int RAW_NOISE_BIT_NOISE3 = 0x1b56c4e9;
+constexpr double	   RAW_NOISE_ONE_OVER_MAX_UINT = (1.0 / (double)0xFFFFFFFF);
+
+
+inline __m128i MultiplyUints_SSE2(__m128i a, __m128i b)
+{
+	//SSE2 has no 32 bit low multiply, so multiply the even and odd lanes as 64 bit products and keep the low halves
+	__m128i evenProducts = _mm_mul_epu32(a, b);
+	__m128i oddProducts = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+	return _mm_unpacklo_epi32(_mm_shuffle_epi32(evenProducts, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(oddProducts, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+
+//Get1dNoiseUint for 4 positions at once
+inline __m128i GetNoiseUints_SSE2(__m128i positions, __m128i seed)
+{
+	__m128i mangledBits = MultiplyUints_SSE2(positions, _mm_set1_epi32(static_cast<int>(RAW_NOISE_BIT_NOISE1)));
+	mangledBits = _mm_add_epi32(mangledBits, seed);
+	mangledBits = _mm_xor_si128(mangledBits, _mm_srli_epi32(mangledBits, 7));
+	mangledBits = _mm_add_epi32(mangledBits, _mm_set1_epi32(static_cast<int>(RAW_NOISE_BIT_NOISE2)));
+	mangledBits = _mm_xor_si128(mangledBits, _mm_srli_epi32(mangledBits, 8));
+	mangledBits = MultiplyUints_SSE2(mangledBits, _mm_set1_epi32(static_cast<int>(RAW_NOISE_BIT_NOISE3)));
+	mangledBits = _mm_xor_si128(mangledBits, _mm_srli_epi32(mangledBits, 11));
+	return mangledBits;
+}
+
+
+//Get1dNoiseZeroToOne from the uints, bit-identical to the scalar version
+inline __m128 GetNoiseZeroToOne_SSE2(__m128i noiseUints)
+{
+	//scaled in double precision like Get1dNoiseZeroToOne, flipping the top bit turns the uints into ints 2^31 lower
+	__m128i offsetNoise = _mm_xor_si128(noiseUints, _mm_set1_epi32(static_cast<int>(0x80000000)));
+	__m128d uintOffset = _mm_set1_pd(2147483648.0);
+	__m128d noiseScale = _mm_set1_pd(RAW_NOISE_ONE_OVER_MAX_UINT);
+	__m128d lowValues = _mm_mul_pd(_mm_add_pd(_mm_cvtepi32_pd(offsetNoise), uintOffset), noiseScale);
+	__m128d highValues = _mm_mul_pd(_mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(offsetNoise, _MM_SHUFFLE(3, 2, 3, 2))), uintOffset), noiseScale);
+	return _mm_movelh_ps(_mm_cvtpd_ps(lowValues), _mm_cvtpd_ps(highValues));
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION inline __m256i GetNoiseUints_AVX2(__m256i positions, __m256i seed)
+{
+	__m256i mangledBits = _mm256_mullo_epi32(positions, _mm256_set1_epi32(static_cast<int>(RAW_NOISE_BIT_NOISE1)));
+	mangledBits = _mm256_add_epi32(mangledBits, seed);
+	mangledBits = _mm256_xor_si256(mangledBits, _mm256_srli_epi32(mangledBits, 7));
+	mangledBits = _mm256_add_epi32(mangledBits, _mm256_set1_epi32(static_cast<int>(RAW_NOISE_BIT_NOISE2)));
+	mangledBits = _mm256_xor_si256(mangledBits, _mm256_srli_epi32(mangledBits, 8));
+	mangledBits = _mm256_mullo_epi32(mangledBits, _mm256_set1_epi32(static_cast<int>(RAW_NOISE_BIT_NOISE3)));
+	mangledBits = _mm256_xor_si256(mangledBits, _mm256_srli_epi32(mangledBits, 11));
+	return mangledBits;
+}
+
+
+SIMD_AVX2_EXACT_FUNCTION inline __m256 GetNoiseZeroToOne_AVX2(__m256i noiseUints)
+{
+	__m256i offsetNoise = _mm256_xor_si256(noiseUints, _mm256_set1_epi32(static_cast<int>(0x80000000)));
+	__m256d uintOffset = _mm256_set1_pd(2147483648.0);
+	__m256d noiseScale = _mm256_set1_pd(RAW_NOISE_ONE_OVER_MAX_UINT);
+	__m256d lowValues = _mm256_mul_pd(_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(offsetNoise)), uintOffset), noiseScale);
+	__m256d highValues = _mm256_mul_pd(_mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(offsetNoise, 1)), uintOffset), noiseScale);
+	return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(lowValues)), _mm256_cvtpd_ps(highValues), 1);
+}
+#endif
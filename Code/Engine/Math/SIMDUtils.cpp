@@ -0,0 +1,60 @@
+#include "Engine/Math/SIMDUtils.hpp"
+#if defined(_MSC_VER)
+	#include <intrin.h>
+#endif
+
+
+//static variable declarations
+static SIMDLevel s_maxSIMDLevel = SIMDLevel::AVX2;
+
+
+//
+//static functions
+//
+static SIMDLevel DetectSIMDLevel()
+{
+#if !defined(ENGINE_SIMD_X86)
+	return SIMDLevel::SCALAR;
+#elif defined(_MSC_VER)
+	int cpuInfo[4] = {};
+	__cpuid(cpuInfo, 0);
+	int maxFunctionID = cpuInfo[0];
+
+	__cpuid(cpuInfo, 1);
+	bool hasFMA = (cpuInfo[2] & (1 << 12)) != 0;
+	bool hasOSXSave = (cpuInfo[2] & (1 << 27)) != 0;
+	bool hasAVX = (cpuInfo[2] & (1 << 28)) != 0;
+
+	//the OS also has to save the upper halves of the ymm registers on context switches
+	bool doesOSSupportAVX = hasOSXSave && hasAVX && (_xgetbv(0) & 0x6) == 0x6;
+
+	bool hasAVX2 = false;
+	if (maxFunctionID >= 7)
+	{
+		__cpuidex(cpuInfo, 7, 0);
+		hasAVX2 = (cpuInfo[1] & (1 << 5)) != 0;
+	}
+
+	return (doesOSSupportAVX && hasAVX2 && hasFMA) ? SIMDLevel::AVX2 : SIMDLevel::SSE2;
+#else
+	__builtin_cpu_init();
+	return (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) ? SIMDLevel::AVX2 : SIMDLevel::SSE2;
+#endif
+}
+
+
+//
+//dispatch functions
+//
+SIMDLevel GetSIMDLevel()
+{
+	static SIMDLevel const s_detectedSIMDLevel = DetectSIMDLevel();
+
+	return ((int)s_detectedSIMDLevel < (int)s_maxSIMDLevel) ? s_detectedSIMDLevel : s_maxSIMDLevel;
+}
+
+
+void SetMaxSIMDLevel(SIMDLevel maxSIMDLevel)
+{
+	s_maxSIMDLevel = maxSIMDLevel;
+}
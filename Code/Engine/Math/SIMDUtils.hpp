@@ -0,0 +1,35 @@
+#pragma once
+
+
+//x86 builds always have SSE2 (x64 baseline, /arch:SSE2 default on Win32), anything else falls back to the scalar paths
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+	#define ENGINE_SIMD_X86
+	#include <immintrin.h>
+#endif
+
+//AVX2 kernels live in ordinary translation units and only run after GetSIMDLevel says the CPU has AVX2
+//MSVC allows the intrinsics without /arch:AVX2, other compilers need the function tagged
+//kernels that must match the scalar code bit for bit use SIMD_AVX2_EXACT_FUNCTION, which leaves FMA out so GCC and Clang
+//can't contract their multiply-adds (MSVC doesn't contract without /fp:contract)
+#if defined(_MSC_VER)
+	#define SIMD_AVX2_FUNCTION
+	#define SIMD_AVX2_EXACT_FUNCTION
+#else
+	#define SIMD_AVX2_FUNCTION __attribute__((target("avx2,fma")))
+	#define SIMD_AVX2_EXACT_FUNCTION __attribute__((target("avx2")))
+#endif
+
+
+//enums
+enum class SIMDLevel
+{
+	SCALAR,
+	SSE2,
+	AVX2,	//AVX2 plus FMA3, both are required for the 8-wide kernels
+	COUNT
+};
+
+
+//dispatch functions
+SIMDLevel GetSIMDLevel();							//best level the CPU supports, capped by SetMaxSIMDLevel
+void	  SetMaxSIMDLevel(SIMDLevel maxSIMDLevel);	//e.g. force SCALAR to compare kernels against the reference path
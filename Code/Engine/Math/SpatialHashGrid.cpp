@@ -0,0 +1,402 @@
+#include "Engine/Math/SpatialHashGrid.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include <math.h>
+
+
+//
+//static functions
+//
+//21 bits per axis, cells more than a million cells from the origin wrap onto each other
+static uint64_t GetCellKey(IntVec3 const& cellCoords)
+{
+	uint64_t keyX = static_cast<uint64_t>(cellCoords.x) & 0x1fffff;
+	uint64_t keyY = static_cast<uint64_t>(cellCoords.y) & 0x1fffff;
+	uint64_t keyZ = static_cast<uint64_t>(cellCoords.z) & 0x1fffff;
+
+	return keyX | (keyY << 21) | (keyZ << 42);
+}
+
+
+static bool IsCellInRange(IntVec3 const& cellCoords, IntVec3 const& minCell, IntVec3 const& maxCell)
+{
+	return cellCoords.x >= minCell.x && cellCoords.x <= maxCell.x && cellCoords.y >= minCell.y && cellCoords.y <= maxCell.y && cellCoords.z >= minCell.z && cellCoords.z <= maxCell.z;
+}
+
+
+static AABB3 const GetAABB3ForAABB2(AABB2 const& bounds)
+{
+	return AABB3(bounds.m_mins.x, bounds.m_mins.y, 0.0f, bounds.m_maxs.x, bounds.m_maxs.y, 0.0f);
+}
+
+
+static float GetDistanceSquaredToAABB3(Vec3 const& point, AABB3 const& bounds)
+{
+	Vec3 nearestPoint = GetNearestPointOnAABB3D(point, bounds);
+	return GetDistanceSquared3D(point, nearestPoint);
+}
+
+
+//
+//constructors
+//
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+	: m_cellSize(cellSize)
+	, m_inverseCellSize(1.0f / cellSize)
+{
+	GUARANTEE_OR_DIE(cellSize > 0.0f, "SpatialHashGrid cell size must be positive");
+}
+
+
+//
+//proxy functions
+//
+int SpatialHashGrid::AddProxy(AABB3 const& bounds, void* userData)
+{
+	int proxyHandle = m_firstFreeProxy;
+	if (proxyHandle != INVALID_SPATIAL_HASH_PROXY)
+	{
+		m_firstFreeProxy = m_proxies[proxyHandle].m_nextFreeProxy;
+	}
+	else
+	{
+		proxyHandle = static_cast<int>(m_proxies.size());
+		m_proxies.emplace_back();
+	}
+
+	SpatialHashProxy& proxy = m_proxies[proxyHandle];
+	proxy.m_bounds = bounds;
+	proxy.m_minCell = GetCellCoordsForPoint(bounds.m_mins);
+	proxy.m_maxCell = GetCellCoordsForPoint(bounds.m_maxs);
+	proxy.m_userData = userData;
+	proxy.m_nextFreeProxy = INVALID_SPATIAL_HASH_PROXY;
+	proxy.m_isInUse = true;
+	m_numProxies++;
+
+	for (int cellZ = proxy.m_minCell.z; cellZ <= proxy.m_maxCell.z; cellZ++)
+	{
+		for (int cellY = proxy.m_minCell.y; cellY <= proxy.m_maxCell.y; cellY++)
+		{
+			for (int cellX = proxy.m_minCell.x; cellX <= proxy.m_maxCell.x; cellX++)
+			{
+				AddProxyToCell(proxyHandle, IntVec3(cellX, cellY, cellZ));
+			}
+		}
+	}
+
+	return proxyHandle;
+}
+
+
+int SpatialHashGrid::AddProxy(AABB2 const& bounds, void* userData)
+{
+	return AddProxy(GetAABB3ForAABB2(bounds), userData);
+}
+
+
+//only the cells the proxy enters or leaves are touched, moving within the same cells just updates the bounds
+void SpatialHashGrid::MoveProxy(int proxyHandle, AABB3 const& newBounds)
+{
+	GUARANTEE_OR_DIE(proxyHandle >= 0 && proxyHandle < static_cast<int>(m_proxies.size()) && m_proxies[proxyHandle].m_isInUse, "SpatialHashGrid tried to move an invalid proxy");
+
+	SpatialHashProxy& proxy = m_proxies[proxyHandle];
+	IntVec3 oldMinCell = proxy.m_minCell;
+	IntVec3 oldMaxCell = proxy.m_maxCell;
+	IntVec3 newMinCell = GetCellCoordsForPoint(newBounds.m_mins);
+	IntVec3 newMaxCell = GetCellCoordsForPoint(newBounds.m_maxs);
+
+	proxy.m_bounds = newBounds;
+	proxy.m_minCell = newMinCell;
+	proxy.m_maxCell = newMaxCell;
+
+	for (int cellZ = oldMinCell.z; cellZ <= oldMaxCell.z; cellZ++)
+	{
+		for (int cellY = oldMinCell.y; cellY <= oldMaxCell.y; cellY++)
+		{
+			for (int cellX = oldMinCell.x; cellX <= oldMaxCell.x; cellX++)
+			{
+				IntVec3 cellCoords(cellX, cellY, cellZ);
+				if (!IsCellInRange(cellCoords, newMinCell, newMaxCell))
+				{
+					RemoveProxyFromCell(proxyHandle, cellCoords);
+				}
+			}
+		}
+	}
+
+	for (int cellZ = newMinCell.z; cellZ <= newMaxCell.z; cellZ++)
+	{
+		for (int cellY = newMinCell.y; cellY <= newMaxCell.y; cellY++)
+		{
+			for (int cellX = newMinCell.x; cellX <= newMaxCell.x; cellX++)
+			{
+				IntVec3 cellCoords(cellX, cellY, cellZ);
+				if (!IsCellInRange(cellCoords, oldMinCell, oldMaxCell))
+				{
+					AddProxyToCell(proxyHandle, cellCoords);
+				}
+			}
+		}
+	}
+}
+
+
+void SpatialHashGrid::MoveProxy(int proxyHandle, AABB2 const& newBounds)
+{
+	MoveProxy(proxyHandle, GetAABB3ForAABB2(newBounds));
+}
+
+
+void SpatialHashGrid::RemoveProxy(int proxyHandle)
+{
+	GUARANTEE_OR_DIE(proxyHandle >= 0 && proxyHandle < static_cast<int>(m_proxies.size()) && m_proxies[proxyHandle].m_isInUse, "SpatialHashGrid tried to remove an invalid proxy");
+
+	SpatialHashProxy& proxy = m_proxies[proxyHandle];
+	for (int cellZ = proxy.m_minCell.z; cellZ <= proxy.m_maxCell.z; cellZ++)
+	{
+		for (int cellY = proxy.m_minCell.y; cellY <= proxy.m_maxCell.y; cellY++)
+		{
+			for (int cellX = proxy.m_minCell.x; cellX <= proxy.m_maxCell.x; cellX++)
+			{
+				RemoveProxyFromCell(proxyHandle, IntVec3(cellX, cellY, cellZ));
+			}
+		}
+	}
+
+	proxy.m_userData = nullptr;
+	proxy.m_isInUse = false;
+	proxy.m_nextFreeProxy = m_firstFreeProxy;
+	m_firstFreeProxy = proxyHandle;
+	m_numProxies--;
+}
+
+
+void SpatialHashGrid::Clear()
+{
+	m_proxies.clear();
+	m_cells.clear();
+	m_firstFreeProxy = INVALID_SPATIAL_HASH_PROXY;
+	m_numProxies = 0;
+}
+
+
+//
+//accessors
+//
+void* SpatialHashGrid::GetUserData(int proxyHandle) const
+{
+	return m_proxies[proxyHandle].m_userData;
+}
+
+
+AABB3 const SpatialHashGrid::GetProxyBounds(int proxyHandle) const
+{
+	return m_proxies[proxyHandle].m_bounds;
+}
+
+
+//
+//queries
+//
+int SpatialHashGrid::GetProxiesOverlappingAABB3(AABB3 const& bounds, std::vector<int>& out_proxyHandles) const
+{
+	int numProxiesFound = 0;
+	unsigned int queryStamp = GetNextQueryStamp();
+	IntVec3 minCell = GetCellCoordsForPoint(bounds.m_mins);
+	IntVec3 maxCell = GetCellCoordsForPoint(bounds.m_maxs);
+
+	//a query bigger than the occupied part of the grid walks the occupied cells instead of every cell in range
+	int64_t numCellsInRange = static_cast<int64_t>(maxCell.x - minCell.x + 1) * static_cast<int64_t>(maxCell.y - minCell.y + 1) * static_cast<int64_t>(maxCell.z - minCell.z + 1);
+	if (numCellsInRange > static_cast<int64_t>(m_cells.size()))
+	{
+		for (auto cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
+		{
+			SpatialHashCell const& cell = cellIter->second;
+			if (!IsCellInRange(cell.m_coords, minCell, maxCell))
+			{
+				continue;
+			}
+
+			for (int cellProxyIndex = 0; cellProxyIndex < static_cast<int>(cell.m_proxies.size()); cellProxyIndex++)
+			{
+				SpatialHashProxy const& proxy = m_proxies[cell.m_proxies[cellProxyIndex]];
+				if (proxy.m_lastQueryStamp != queryStamp && DoAABB3sOverlap(proxy.m_bounds, bounds))
+				{
+					proxy.m_lastQueryStamp = queryStamp;
+					out_proxyHandles.push_back(cell.m_proxies[cellProxyIndex]);
+					numProxiesFound++;
+				}
+			}
+		}
+
+		return numProxiesFound;
+	}
+
+	for (int cellZ = minCell.z; cellZ <= maxCell.z; cellZ++)
+	{
+		for (int cellY = minCell.y; cellY <= maxCell.y; cellY++)
+		{
+			for (int cellX = minCell.x; cellX <= maxCell.x; cellX++)
+			{
+				auto cellIter = m_cells.find(GetCellKey(IntVec3(cellX, cellY, cellZ)));
+				if (cellIter == m_cells.end())
+				{
+					continue;
+				}
+
+				std::vector<int> const& cellProxies = cellIter->second.m_proxies;
+				for (int cellProxyIndex = 0; cellProxyIndex < static_cast<int>(cellProxies.size()); cellProxyIndex++)
+				{
+					SpatialHashProxy const& proxy = m_proxies[cellProxies[cellProxyIndex]];
+					if (proxy.m_lastQueryStamp != queryStamp && DoAABB3sOverlap(proxy.m_bounds, bounds))
+					{
+						proxy.m_lastQueryStamp = queryStamp;
+						out_proxyHandles.push_back(cellProxies[cellProxyIndex]);
+						numProxiesFound++;
+					}
+				}
+			}
+		}
+	}
+
+	return numProxiesFound;
+}
+
+
+int SpatialHashGrid::GetProxiesOverlappingAABB2(AABB2 const& bounds, std::vector<int>& out_proxyHandles) const
+{
+	return GetProxiesOverlappingAABB3(GetAABB3ForAABB2(bounds), out_proxyHandles);
+}
+
+
+int SpatialHashGrid::GetProxiesOverlappingSphere(Vec3 const& sphereCenter, float sphereRadius, std::vector<int>& out_proxyHandles) const
+{
+	//gather by the sphere's bounds, then drop the proxies only the corners of those bounds reached
+	int firstCandidateIndex = static_cast<int>(out_proxyHandles.size());
+	Vec3 radiusVector(sphereRadius, sphereRadius, sphereRadius);
+	GetProxiesOverlappingAABB3(AABB3(sphereCenter - radiusVector, sphereCenter + radiusVector), out_proxyHandles);
+
+	float radiusSquared = sphereRadius * sphereRadius;
+	int numProxiesKept = 0;
+	for (int candidateIndex = firstCandidateIndex; candidateIndex < static_cast<int>(out_proxyHandles.size()); candidateIndex++)
+	{
+		int proxyHandle = out_proxyHandles[candidateIndex];
+		if (GetDistanceSquaredToAABB3(sphereCenter, m_proxies[proxyHandle].m_bounds) <= radiusSquared)
+		{
+			out_proxyHandles[firstCandidateIndex + numProxiesKept] = proxyHandle;
+			numProxiesKept++;
+		}
+	}
+
+	out_proxyHandles.resize(firstCandidateIndex + numProxiesKept);
+	return numProxiesKept;
+}
+
+
+int SpatialHashGrid::GetProxiesOverlappingDisc(Vec2 const& discCenter, float discRadius, std::vector<int>& out_proxyHandles) const
+{
+	return GetProxiesOverlappingSphere(Vec3(discCenter.x, discCenter.y, 0.0f), discRadius, out_proxyHandles);
+}
+
+
+//a pair sharing several cells is only reported from the lowest cell both proxies touch
+int SpatialHashGrid::GetOverlappingProxyPairs(std::vector<SpatialHashPair>& out_pairs) const
+{
+	int numPairsFound = 0;
+	for (auto cellIter = m_cells.begin(); cellIter != m_cells.end(); ++cellIter)
+	{
+		SpatialHashCell const& cell = cellIter->second;
+		int numCellProxies = static_cast<int>(cell.m_proxies.size());
+		for (int firstIndex = 0; firstIndex < numCellProxies - 1; firstIndex++)
+		{
+			int proxyHandleA = cell.m_proxies[firstIndex];
+			SpatialHashProxy const& proxyA = m_proxies[proxyHandleA];
+			for (int secondIndex = firstIndex + 1; secondIndex < numCellProxies; secondIndex++)
+			{
+				int proxyHandleB = cell.m_proxies[secondIndex];
+				SpatialHashProxy const& proxyB = m_proxies[proxyHandleB];
+
+				int sharedMinCellX = (proxyA.m_minCell.x > proxyB.m_minCell.x) ? proxyA.m_minCell.x : proxyB.m_minCell.x;
+				int sharedMinCellY = (proxyA.m_minCell.y > proxyB.m_minCell.y) ? proxyA.m_minCell.y : proxyB.m_minCell.y;
+				int sharedMinCellZ = (proxyA.m_minCell.z > proxyB.m_minCell.z) ? proxyA.m_minCell.z : proxyB.m_minCell.z;
+				if (sharedMinCellX != cell.m_coords.x || sharedMinCellY != cell.m_coords.y || sharedMinCellZ != cell.m_coords.z)
+				{
+					continue;
+				}
+
+				if (DoAABB3sOverlap(proxyA.m_bounds, proxyB.m_bounds))
+				{
+					SpatialHashPair pair;
+					pair.m_proxyA = (proxyHandleA < proxyHandleB) ? proxyHandleA : proxyHandleB;
+					pair.m_proxyB = (proxyHandleA < proxyHandleB) ? proxyHandleB : proxyHandleA;
+					out_pairs.push_back(pair);
+					numPairsFound++;
+				}
+			}
+		}
+	}
+
+	return numPairsFound;
+}
+
+
+//
+//private member functions
+//
+IntVec3 const SpatialHashGrid::GetCellCoordsForPoint(Vec3 const& point) const
+{
+	return IntVec3(RoundDownToInt(point.x * m_inverseCellSize), RoundDownToInt(point.y * m_inverseCellSize), RoundDownToInt(point.z * m_inverseCellSize));
+}
+
+
+void SpatialHashGrid::AddProxyToCell(int proxyHandle, IntVec3 const& cellCoords)
+{
+	SpatialHashCell& cell = m_cells[GetCellKey(cellCoords)];
+	cell.m_coords = cellCoords;
+	cell.m_proxies.push_back(proxyHandle);
+}
+
+
+void SpatialHashGrid::RemoveProxyFromCell(int proxyHandle, IntVec3 const& cellCoords)
+{
+	auto cellIter = m_cells.find(GetCellKey(cellCoords));
+	if (cellIter == m_cells.end())
+	{
+		return;
+	}
+
+	std::vector<int>& cellProxies = cellIter->second.m_proxies;
+	for (int cellProxyIndex = 0; cellProxyIndex < static_cast<int>(cellProxies.size()); cellProxyIndex++)
+	{
+		if (cellProxies[cellProxyIndex] == proxyHandle)
+		{
+			cellProxies[cellProxyIndex] = cellProxies.back();
+			cellProxies.pop_back();
+			break;
+		}
+	}
+
+	//empty cells are dropped so the map only grows with the occupied area, not with everywhere proxies have been
+	if (cellProxies.empty())
+	{
+		m_cells.erase(cellIter);
+	}
+}
+
+
+unsigned int SpatialHashGrid::GetNextQueryStamp() const
+{
+	m_queryStamp++;
+
+	//on wraparound old stamps could match again, so wipe them
+	if (m_queryStamp == 0)
+	{
+		for (int proxyIndex = 0; proxyIndex < static_cast<int>(m_proxies.size()); proxyIndex++)
+		{
+			m_proxies[proxyIndex].m_lastQueryStamp = 0;
+		}
+
+		m_queryStamp = 1;
+	}
+
+	return m_queryStamp;
+}
@@ -0,0 +1,94 @@
+#pragma once
+#include "Engine/Math/AABB2.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/IntVec3.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+#include <unordered_map>
+
+
+//constants
+constexpr int INVALID_SPATIAL_HASH_PROXY = -1;
+
+
+struct SpatialHashProxy
+{
+//public member variables
+public:
+	AABB3	m_bounds;
+	IntVec3	m_minCell;
+	IntVec3	m_maxCell;
+	void*	m_userData = nullptr;
+	int		m_nextFreeProxy = INVALID_SPATIAL_HASH_PROXY;
+	bool	m_isInUse = false;
+	mutable unsigned int m_lastQueryStamp = 0;	//stops a proxy covering several cells from being reported more than once per query
+};
+
+
+struct SpatialHashCell
+{
+//public member variables
+public:
+	IntVec3			 m_coords;
+	std::vector<int> m_proxies;
+};
+
+
+struct SpatialHashPair
+{
+//public member variables
+public:
+	int m_proxyA = INVALID_SPATIAL_HASH_PROXY;
+	int m_proxyB = INVALID_SPATIAL_HASH_PROXY;
+};
+
+
+//broadphase uniform grid, proxies are hashed into every cell their bounds touch and only cells that hold something exist
+//pick a cell size around the size of a typical proxy, big proxies touch many cells and tiny cells cost memory
+//2D proxies live in the z = 0 layer, so keep each grid all 2D or all 3D
+//queries are const but stamp the proxies they visit, so don't query one grid from several threads at once
+class SpatialHashGrid
+{
+//public member functions
+public:
+	//constructors
+	explicit SpatialHashGrid(float cellSize);
+
+	//proxy functions, handles stay valid until the proxy is removed and are reused afterwards
+	int	 AddProxy(AABB3 const& bounds, void* userData = nullptr);
+	int	 AddProxy(AABB2 const& bounds, void* userData = nullptr);
+	void MoveProxy(int proxyHandle, AABB3 const& newBounds);
+	void MoveProxy(int proxyHandle, AABB2 const& newBounds);
+	void RemoveProxy(int proxyHandle);
+	void Clear();
+
+	//accessors
+	float		GetCellSize() const { return m_cellSize; }
+	int			GetNumProxies() const { return m_numProxies; }
+	int			GetNumOccupiedCells() const { return static_cast<int>(m_cells.size()); }
+	void*		GetUserData(int proxyHandle) const;
+	AABB3 const GetProxyBounds(int proxyHandle) const;
+
+	//queries append proxy handles to the list and return how many were added
+	int GetProxiesOverlappingAABB3(AABB3 const& bounds, std::vector<int>& out_proxyHandles) const;
+	int GetProxiesOverlappingAABB2(AABB2 const& bounds, std::vector<int>& out_proxyHandles) const;
+	int GetProxiesOverlappingSphere(Vec3 const& sphereCenter, float sphereRadius, std::vector<int>& out_proxyHandles) const;
+	int GetProxiesOverlappingDisc(Vec2 const& discCenter, float discRadius, std::vector<int>& out_proxyHandles) const;
+	int GetOverlappingProxyPairs(std::vector<SpatialHashPair>& out_pairs) const;	//every pair with overlapping bounds, each pair once
+
+//private member functions
+private:
+	IntVec3 const GetCellCoordsForPoint(Vec3 const& point) const;
+	void		  AddProxyToCell(int proxyHandle, IntVec3 const& cellCoords);
+	void		  RemoveProxyFromCell(int proxyHandle, IntVec3 const& cellCoords);
+	unsigned int  GetNextQueryStamp() const;
+
+//private member variables
+private:
+	float										  m_cellSize = 1.0f;
+	float										  m_inverseCellSize = 1.0f;
+	std::vector<SpatialHashProxy>				  m_proxies;
+	int											  m_firstFreeProxy = INVALID_SPATIAL_HASH_PROXY;
+	int											  m_numProxies = 0;
+	std::unordered_map<uint64_t, SpatialHashCell> m_cells;
+	mutable unsigned int						  m_queryStamp = 0;
+};
@@ -0,0 +1,774 @@
+#include "Engine/Math/TriangleBVH.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Renderer/CPUMesh.hpp"
+#include <algorithm>
+#include <math.h>
+
+
+//constants
+constexpr int	NUM_SAH_BINS = 16;
+constexpr int	MAX_LEAF_TRIANGLES = 16;	//past this a leaf is split even when the heuristic says splitting costs more
+constexpr int	MAX_BUILD_DEPTH = 48;		//keeps the fixed size traversal stacks below safe
+constexpr int	TRAVERSAL_STACK_SIZE = 64;
+constexpr float RAY_INVERSE_LIMIT = 1e30f;	//stands in for 1/0 so flat rays never compute 0 * inf in the slab test
+
+
+//structure declarations
+struct BVHBuildTask
+{
+	int m_nodeIndex = 0;
+	int m_firstTriangle = 0;
+	int m_endTriangle = 0;
+	int m_depth = 0;
+};
+
+
+struct SAHBin
+{
+	AABB3 m_bounds = AABB3(FLT_MAX, FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX, -FLT_MAX);
+	int	  m_numTriangles = 0;
+};
+
+
+//
+//static functions
+//
+static float GetAxisValue(Vec3 const& vec, int axis)
+{
+	return (axis == 0) ? vec.x : ((axis == 1) ? vec.y : vec.z);
+}
+
+
+static void StretchToIncludeBounds(AABB3& bounds, AABB3 const& boundsToInclude)
+{
+	bounds.m_mins.x = std::min(bounds.m_mins.x, boundsToInclude.m_mins.x);
+	bounds.m_mins.y = std::min(bounds.m_mins.y, boundsToInclude.m_mins.y);
+	bounds.m_mins.z = std::min(bounds.m_mins.z, boundsToInclude.m_mins.z);
+	bounds.m_maxs.x = std::max(bounds.m_maxs.x, boundsToInclude.m_maxs.x);
+	bounds.m_maxs.y = std::max(bounds.m_maxs.y, boundsToInclude.m_maxs.y);
+	bounds.m_maxs.z = std::max(bounds.m_maxs.z, boundsToInclude.m_maxs.z);
+}
+
+
+static void StretchToIncludePoint(AABB3& bounds, Vec3 const& point)
+{
+	StretchToIncludeBounds(bounds, AABB3(point, point));
+}
+
+
+//half the surface area, only ever compared against other areas
+static float GetHalfSurfaceArea(AABB3 const& bounds)
+{
+	Vec3 dimensions = bounds.m_maxs - bounds.m_mins;
+	return (dimensions.x * dimensions.y) + (dimensions.y * dimensions.z) + (dimensions.z * dimensions.x);
+}
+
+
+static float GetSafeInverse(float value)
+{
+	if (value > -1e-30f && value < 1e-30f)
+	{
+		return (value < 0.0f) ? -RAY_INVERSE_LIMIT : RAY_INVERSE_LIMIT;
+	}
+
+	return 1.0f / value;
+}
+
+
+static bool DoesRayHitBounds(AABB3 const& bounds, Vec3 const& startPosition, Vec3 const& inverseDirection, float maxDistance)
+{
+	float tX1 = (bounds.m_mins.x - startPosition.x) * inverseDirection.x;
+	float tX2 = (bounds.m_maxs.x - startPosition.x) * inverseDirection.x;
+	float tY1 = (bounds.m_mins.y - startPosition.y) * inverseDirection.y;
+	float tY2 = (bounds.m_maxs.y - startPosition.y) * inverseDirection.y;
+	float tZ1 = (bounds.m_mins.z - startPosition.z) * inverseDirection.z;
+	float tZ2 = (bounds.m_maxs.z - startPosition.z) * inverseDirection.z;
+
+	float entryDist = std::max(std::max(std::min(tX1, tX2), std::min(tY1, tY2)), std::max(std::min(tZ1, tZ2), 0.0f));
+	float exitDist = std::min(std::min(std::max(tX1, tX2), std::max(tY1, tY2)), std::min(std::max(tZ1, tZ2), maxDistance));
+
+	return entryDist <= exitDist;
+}
+
+
+static float GetDistanceSquaredToBounds(Vec3 const& point, AABB3 const& bounds)
+{
+	float xDist = std::max(std::max(bounds.m_mins.x - point.x, point.x - bounds.m_maxs.x), 0.0f);
+	float yDist = std::max(std::max(bounds.m_mins.y - point.y, point.y - bounds.m_maxs.y), 0.0f);
+	float zDist = std::max(std::max(bounds.m_mins.z - point.z, point.z - bounds.m_maxs.z), 0.0f);
+
+	return (xDist * xDist) + (yDist * yDist) + (zDist * zDist);
+}
+
+
+//triangle corners are relative to the box center
+static bool IsSeparatingAxis(Vec3 const& axis, Vec3 const& cornerA, Vec3 const& cornerB, Vec3 const& cornerC, Vec3 const& boxHalfDimensions)
+{
+	float projectionA = DotProduct3D(axis, cornerA);
+	float projectionB = DotProduct3D(axis, cornerB);
+	float projectionC = DotProduct3D(axis, cornerC);
+	float boxRadius = (boxHalfDimensions.x * fabsf(axis.x)) + (boxHalfDimensions.y * fabsf(axis.y)) + (boxHalfDimensions.z * fabsf(axis.z));
+
+	return std::min(std::min(projectionA, projectionB), projectionC) > boxRadius || std::max(std::max(projectionA, projectionB), projectionC) < -boxRadius;
+}
+
+
+//separating axis test with the box's three axes, the triangle normal, and the nine edge cross products
+static bool DoesTriangleOverlapAABB3(Vec3 const& pointA, Vec3 const& pointB, Vec3 const& pointC, AABB3 const& bounds)
+{
+	Vec3 boxCenter = bounds.GetCenter();
+	Vec3 boxHalfDimensions = (bounds.m_maxs - bounds.m_mins) * 0.5f;
+	Vec3 cornerA = pointA - boxCenter;
+	Vec3 cornerB = pointB - boxCenter;
+	Vec3 cornerC = pointC - boxCenter;
+
+	if (IsSeparatingAxis(Vec3(1.0f, 0.0f, 0.0f), cornerA, cornerB, cornerC, boxHalfDimensions) ||
+		IsSeparatingAxis(Vec3(0.0f, 1.0f, 0.0f), cornerA, cornerB, cornerC, boxHalfDimensions) ||
+		IsSeparatingAxis(Vec3(0.0f, 0.0f, 1.0f), cornerA, cornerB, cornerC, boxHalfDimensions))
+	{
+		return false;
+	}
+
+	Vec3 edges[3] = { cornerB - cornerA, cornerC - cornerB, cornerA - cornerC };
+	if (IsSeparatingAxis(CrossProduct3D(edges[0], edges[1]), cornerA, cornerB, cornerC, boxHalfDimensions))
+	{
+		return false;
+	}
+
+	for (int edgeIndex = 0; edgeIndex < 3; edgeIndex++)
+	{
+		Vec3 const& edge = edges[edgeIndex];
+		if (IsSeparatingAxis(Vec3(0.0f, -edge.z, edge.y), cornerA, cornerB, cornerC, boxHalfDimensions) ||
+			IsSeparatingAxis(Vec3(edge.z, 0.0f, -edge.x), cornerA, cornerB, cornerC, boxHalfDimensions) ||
+			IsSeparatingAxis(Vec3(-edge.y, edge.x, 0.0f), cornerA, cornerB, cornerC, boxHalfDimensions))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+//
+//constructors
+//
+TriangleBVH::TriangleBVH(CPUMesh const& mesh, int maxTrianglesPerLeaf)
+{
+	Build(mesh, maxTrianglesPerLeaf);
+}
+
+
+//
+//build functions
+//
+void TriangleBVH::Build(CPUMesh const& mesh, int maxTrianglesPerLeaf)
+{
+	std::vector<Vec3> positions;
+	positions.reserve(mesh.m_vertexes.size());
+	for (int vertIndex = 0; vertIndex < static_cast<int>(mesh.m_vertexes.size()); vertIndex++)
+	{
+		positions.push_back(mesh.m_vertexes[vertIndex].m_position);
+	}
+
+	Build(positions, mesh.m_indexes, maxTrianglesPerLeaf);
+}
+
+
+void TriangleBVH::Build(std::vector<Vec3> const& positions, std::vector<int> const& indexes, int maxTrianglesPerLeaf)
+{
+	Clear();
+
+	bool isIndexed = !indexes.empty();
+	int numTriangles = isIndexed ? static_cast<int>(indexes.size()) / 3 : static_cast<int>(positions.size()) / 3;
+	if (numTriangles == 0)
+	{
+		return;
+	}
+
+	if (maxTrianglesPerLeaf < 1)
+	{
+		maxTrianglesPerLeaf = 1;
+	}
+
+	//gather each triangle's corners, bounds, and centroid
+	std::vector<Vec3> corners;
+	std::vector<AABB3> triangleBounds;
+	std::vector<Vec3> centroids;
+	corners.reserve(numTriangles * 3);
+	triangleBounds.reserve(numTriangles);
+	centroids.reserve(numTriangles);
+	for (int triIndex = 0; triIndex < numTriangles; triIndex++)
+	{
+		for (int cornerIndex = 0; cornerIndex < 3; cornerIndex++)
+		{
+			int vertIndex = isIndexed ? indexes[(triIndex * 3) + cornerIndex] : (triIndex * 3) + cornerIndex;
+			GUARANTEE_OR_DIE(vertIndex >= 0 && vertIndex < static_cast<int>(positions.size()), "TriangleBVH index is out of range of the vertex list");
+			corners.push_back(positions[vertIndex]);
+		}
+
+		Vec3 const& pointA = corners[(triIndex * 3)];
+		Vec3 const& pointB = corners[(triIndex * 3) + 1];
+		Vec3 const& pointC = corners[(triIndex * 3) + 2];
+		AABB3 bounds(pointA, pointA);
+		StretchToIncludePoint(bounds, pointB);
+		StretchToIncludePoint(bounds, pointC);
+		triangleBounds.push_back(bounds);
+		centroids.push_back((pointA + pointB + pointC) * (1.0f / 3.0f));
+	}
+
+	//the build partitions this list in place, leaves end up owning contiguous ranges of it
+	m_triangleIndexes.resize(numTriangles);
+	for (int triIndex = 0; triIndex < numTriangles; triIndex++)
+	{
+		m_triangleIndexes[triIndex] = triIndex;
+	}
+
+	//a binary tree with one triangle per leaf is the most nodes the build can make, reserving keeps node references stable
+	m_nodes.reserve((numTriangles * 2) - 1);
+	m_nodes.emplace_back();
+
+	std::vector<BVHBuildTask> buildTasks;
+	buildTasks.push_back(BVHBuildTask{ 0, 0, numTriangles, 0 });
+	while (!buildTasks.empty())
+	{
+		BVHBuildTask task = buildTasks.back();
+		buildTasks.pop_back();
+
+		TriangleBVHNode& node = m_nodes[task.m_nodeIndex];
+		int numNodeTriangles = task.m_endTriangle - task.m_firstTriangle;
+
+		AABB3 nodeBounds = triangleBounds[m_triangleIndexes[task.m_firstTriangle]];
+		AABB3 centroidBounds(centroids[m_triangleIndexes[task.m_firstTriangle]], centroids[m_triangleIndexes[task.m_firstTriangle]]);
+		for (int orderIndex = task.m_firstTriangle + 1; orderIndex < task.m_endTriangle; orderIndex++)
+		{
+			StretchToIncludeBounds(nodeBounds, triangleBounds[m_triangleIndexes[orderIndex]]);
+			StretchToIncludePoint(centroidBounds, centroids[m_triangleIndexes[orderIndex]]);
+		}
+
+		node.m_bounds = nodeBounds;
+		node.m_firstIndex = task.m_firstTriangle;
+		node.m_numTriangles = numNodeTriangles;
+
+		if (numNodeTriangles <= maxTrianglesPerLeaf || task.m_depth >= MAX_BUILD_DEPTH)
+		{
+			continue;
+		}
+
+		//bin centroids along each axis and find the cheapest split plane by surface area heuristic
+		int bestAxis = -1;
+		int bestSplitBin = 0;
+		float bestCost = FLT_MAX;
+		for (int axis = 0; axis < 3; axis++)
+		{
+			float centroidMin = GetAxisValue(centroidBounds.m_mins, axis);
+			float centroidExtent = GetAxisValue(centroidBounds.m_maxs, axis) - centroidMin;
+			if (centroidExtent <= 0.0f)
+			{
+				continue;
+			}
+
+			SAHBin bins[NUM_SAH_BINS];
+			float binScale = static_cast<float>(NUM_SAH_BINS) / centroidExtent;
+			for (int orderIndex = task.m_firstTriangle; orderIndex < task.m_endTriangle; orderIndex++)
+			{
+				int triIndex = m_triangleIndexes[orderIndex];
+				int binIndex = std::min(static_cast<int>((GetAxisValue(centroids[triIndex], axis) - centroidMin) * binScale), NUM_SAH_BINS - 1);
+				StretchToIncludeBounds(bins[binIndex].m_bounds, triangleBounds[triIndex]);
+				bins[binIndex].m_numTriangles++;
+			}
+
+			//sweep from the right to get the cost of everything above each split, then from the left to finish it
+			float rightCosts[NUM_SAH_BINS] = {};
+			AABB3 rightBounds = bins[NUM_SAH_BINS - 1].m_bounds;
+			int numRightTriangles = 0;
+			for (int binIndex = NUM_SAH_BINS - 1; binIndex > 0; binIndex--)
+			{
+				StretchToIncludeBounds(rightBounds, bins[binIndex].m_bounds);
+				numRightTriangles += bins[binIndex].m_numTriangles;
+				rightCosts[binIndex - 1] = (numRightTriangles > 0) ? GetHalfSurfaceArea(rightBounds) * static_cast<float>(numRightTriangles) : -1.0f;
+			}
+
+			AABB3 leftBounds = bins[0].m_bounds;
+			int numLeftTriangles = 0;
+			for (int binIndex = 0; binIndex < NUM_SAH_BINS - 1; binIndex++)
+			{
+				StretchToIncludeBounds(leftBounds, bins[binIndex].m_bounds);
+				numLeftTriangles += bins[binIndex].m_numTriangles;
+				if (numLeftTriangles == 0 || rightCosts[binIndex] < 0.0f)
+				{
+					continue;
+				}
+
+				float cost = (GetHalfSurfaceArea(leftBounds) * static_cast<float>(numLeftTriangles)) + rightCosts[binIndex];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestSplitBin = binIndex;
+				}
+			}
+		}
+
+		//every centroid is in the same spot, nothing to split on
+		if (bestAxis < 0)
+		{
+			continue;
+		}
+
+		//one traversal step plus the children's intersection tests vs testing everything here
+		float leafCost = GetHalfSurfaceArea(nodeBounds) * static_cast<float>(numNodeTriangles);
+		float splitCost = GetHalfSurfaceArea(nodeBounds) + bestCost;
+		if (splitCost >= leafCost && numNodeTriangles <= MAX_LEAF_TRIANGLES)
+		{
+			continue;
+		}
+
+		float centroidMin = GetAxisValue(centroidBounds.m_mins, bestAxis);
+		float binScale = static_cast<float>(NUM_SAH_BINS) / (GetAxisValue(centroidBounds.m_maxs, bestAxis) - centroidMin);
+		int* firstTriangle = m_triangleIndexes.data() + task.m_firstTriangle;
+		int* endTriangle = m_triangleIndexes.data() + task.m_endTriangle;
+		int* splitTriangle = std::partition(firstTriangle, endTriangle, [&](int triIndex)
+		{
+			int binIndex = std::min(static_cast<int>((GetAxisValue(centroids[triIndex], bestAxis) - centroidMin) * binScale), NUM_SAH_BINS - 1);
+			return binIndex <= bestSplitBin;
+		});
+		int splitIndex = static_cast<int>(splitTriangle - m_triangleIndexes.data());
+
+		int firstChildIndex = static_cast<int>(m_nodes.size());
+		node.m_firstIndex = firstChildIndex;
+		node.m_numTriangles = 0;
+		node.m_splitAxis = bestAxis;
+		m_nodes.emplace_back();
+		m_nodes.emplace_back();
+
+		buildTasks.push_back(BVHBuildTask{ firstChildIndex, task.m_firstTriangle, splitIndex, task.m_depth + 1 });
+		buildTasks.push_back(BVHBuildTask{ firstChildIndex + 1, splitIndex, task.m_endTriangle, task.m_depth + 1 });
+	}
+
+	m_nodes.shrink_to_fit();
+
+	//store corners in leaf order so each leaf reads one contiguous block
+	m_triangleCorners.resize(numTriangles * 3);
+	for (int orderIndex = 0; orderIndex < numTriangles; orderIndex++)
+	{
+		int triIndex = m_triangleIndexes[orderIndex];
+		m_triangleCorners[(orderIndex * 3)] = corners[(triIndex * 3)];
+		m_triangleCorners[(orderIndex * 3) + 1] = corners[(triIndex * 3) + 1];
+		m_triangleCorners[(orderIndex * 3) + 2] = corners[(triIndex * 3) + 2];
+	}
+}
+
+
+void TriangleBVH::Clear()
+{
+	m_nodes.clear();
+	m_triangleCorners.clear();
+	m_triangleIndexes.clear();
+}
+
+
+//
+//accessors
+//
+AABB3 const TriangleBVH::GetBounds() const
+{
+	if (m_nodes.empty())
+	{
+		return AABB3();
+	}
+
+	return m_nodes[0].m_bounds;
+}
+
+
+//
+//raycast queries
+//
+RaycastResult3D TriangleBVH::Raycast(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance, int* out_triangleIndex) const
+{
+	RaycastResult3D closestResult;
+	closestResult.m_rayStartPosition = startPosition;
+	closestResult.m_rayDirection = directionNormal;
+	closestResult.m_rayLength = maxDistance;
+
+	int closestOrderIndex = -1;
+	float closestDist = maxDistance;
+	Vec3 inverseDirection(GetSafeInverse(directionNormal.x), GetSafeInverse(directionNormal.y), GetSafeInverse(directionNormal.z));
+
+	int nodeStack[TRAVERSAL_STACK_SIZE];
+	int stackSize = 0;
+	if (!m_nodes.empty())
+	{
+		nodeStack[stackSize++] = 0;
+	}
+
+	while (stackSize > 0)
+	{
+		TriangleBVHNode const& node = m_nodes[nodeStack[--stackSize]];
+		if (!DoesRayHitBounds(node.m_bounds, startPosition, inverseDirection, closestDist))
+		{
+			continue;
+		}
+
+		if (node.m_numTriangles > 0)
+		{
+			for (int orderIndex = node.m_firstIndex; orderIndex < node.m_firstIndex + node.m_numTriangles; orderIndex++)
+			{
+				Vec3 const* corners = &m_triangleCorners[orderIndex * 3];
+				RaycastResult3D triangleResult = RaycastVsTriangle3D(startPosition, directionNormal, closestDist, corners[0], corners[1], corners[2]);
+				if (triangleResult.m_didImpact && (closestOrderIndex < 0 || triangleResult.m_impactDist < closestDist))
+				{
+					closestResult = triangleResult;
+					closestDist = triangleResult.m_impactDist;
+					closestOrderIndex = orderIndex;
+				}
+			}
+		}
+		else
+		{
+			//push the far child first so the near one is popped next and shrinks closestDist sooner
+			bool isNearChildSecond = GetAxisValue(directionNormal, node.m_splitAxis) < 0.0f;
+			nodeStack[stackSize++] = isNearChildSecond ? node.m_firstIndex : node.m_firstIndex + 1;
+			nodeStack[stackSize++] = isNearChildSecond ? node.m_firstIndex + 1 : node.m_firstIndex;
+		}
+	}
+
+	//triangle results carry the shortened ray they were tested with
+	closestResult.m_rayLength = maxDistance;
+	if (out_triangleIndex)
+	{
+		*out_triangleIndex = (closestOrderIndex >= 0) ? m_triangleIndexes[closestOrderIndex] : -1;
+	}
+
+	return closestResult;
+}
+
+
+bool TriangleBVH::IsRayBlocked(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance) const
+{
+	Vec3 inverseDirection(GetSafeInverse(directionNormal.x), GetSafeInverse(directionNormal.y), GetSafeInverse(directionNormal.z));
+
+	int nodeStack[TRAVERSAL_STACK_SIZE];
+	int stackSize = 0;
+	if (!m_nodes.empty())
+	{
+		nodeStack[stackSize++] = 0;
+	}
+
+	while (stackSize > 0)
+	{
+		TriangleBVHNode const& node = m_nodes[nodeStack[--stackSize]];
+		if (!DoesRayHitBounds(node.m_bounds, startPosition, inverseDirection, maxDistance))
+		{
+			continue;
+		}
+
+		if (node.m_numTriangles > 0)
+		{
+			for (int orderIndex = node.m_firstIndex; orderIndex < node.m_firstIndex + node.m_numTriangles; orderIndex++)
+			{
+				Vec3 const* corners = &m_triangleCorners[orderIndex * 3];
+				if (RaycastVsTriangle3D(startPosition, directionNormal, maxDistance, corners[0], corners[1], corners[2]).m_didImpact)
+				{
+					return true;
+				}
+			}
+		}
+		else
+		{
+			nodeStack[stackSize++] = node.m_firstIndex;
+			nodeStack[stackSize++] = node.m_firstIndex + 1;
+		}
+	}
+
+	return false;
+}
+
+
+void TriangleBVH::RaycastPacket(int numRays, Vec3 const* startPositions, Vec3 const* directionNormals, float maxDistance, RaycastResult3D* out_results,
+	int* out_triangleIndexes) const
+{
+	if (GetSIMDLevel() == SIMDLevel::SCALAR)
+	{
+		for (int rayIndex = 0; rayIndex < numRays; rayIndex++)
+		{
+			out_results[rayIndex] = Raycast(startPositions[rayIndex], directionNormals[rayIndex], maxDistance, out_triangleIndexes ? &out_triangleIndexes[rayIndex] : nullptr);
+		}
+
+		return;
+	}
+
+	for (int firstRayIndex = 0; firstRayIndex < numRays; firstRayIndex += 4)
+	{
+		RaycastPacketOfFour(std::min(numRays - firstRayIndex, 4), &startPositions[firstRayIndex], &directionNormals[firstRayIndex], maxDistance, &out_results[firstRayIndex],
+			out_triangleIndexes ? &out_triangleIndexes[firstRayIndex] : nullptr);
+	}
+}
+
+
+//walks the tree once for up to four rays, a node is entered if any ray in the packet still hits it
+void TriangleBVH::RaycastPacketOfFour(int numRays, Vec3 const* startPositions, Vec3 const* directionNormals, float maxDistance, RaycastResult3D* out_results,
+	int* out_triangleIndexes) const
+{
+#if defined(ENGINE_SIMD_X86)
+	alignas(16) float startXs[4] = {};
+	alignas(16) float startYs[4] = {};
+	alignas(16) float startZs[4] = {};
+	alignas(16) float directionXs[4] = {};
+	alignas(16) float directionYs[4] = {};
+	alignas(16) float directionZs[4] = {};
+	alignas(16) float inverseXs[4] = {};
+	alignas(16) float inverseYs[4] = {};
+	alignas(16) float inverseZs[4] = {};
+	alignas(16) float closestDists[4] = { -1.0f, -1.0f, -1.0f, -1.0f };	//unused lanes can never hit anything
+	int closestOrderIndexes[4] = { -1, -1, -1, -1 };
+	for (int rayIndex = 0; rayIndex < numRays; rayIndex++)
+	{
+		startXs[rayIndex] = startPositions[rayIndex].x;
+		startYs[rayIndex] = startPositions[rayIndex].y;
+		startZs[rayIndex] = startPositions[rayIndex].z;
+		directionXs[rayIndex] = directionNormals[rayIndex].x;
+		directionYs[rayIndex] = directionNormals[rayIndex].y;
+		directionZs[rayIndex] = directionNormals[rayIndex].z;
+		inverseXs[rayIndex] = GetSafeInverse(directionNormals[rayIndex].x);
+		inverseYs[rayIndex] = GetSafeInverse(directionNormals[rayIndex].y);
+		inverseZs[rayIndex] = GetSafeInverse(directionNormals[rayIndex].z);
+		closestDists[rayIndex] = maxDistance;
+	}
+
+	__m128 startX = _mm_load_ps(startXs);
+	__m128 startY = _mm_load_ps(startYs);
+	__m128 startZ = _mm_load_ps(startZs);
+	__m128 directionX = _mm_load_ps(directionXs);
+	__m128 directionY = _mm_load_ps(directionYs);
+	__m128 directionZ = _mm_load_ps(directionZs);
+	__m128 inverseX = _mm_load_ps(inverseXs);
+	__m128 inverseY = _mm_load_ps(inverseYs);
+	__m128 inverseZ = _mm_load_ps(inverseZs);
+	__m128 closestDist = _mm_load_ps(closestDists);
+	__m128 zero = _mm_setzero_ps();
+	__m128 one = _mm_set1_ps(1.0f);
+	__m128 determinantEpsilon = _mm_set1_ps(0.0000001f);
+	__m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+	int nodeStack[TRAVERSAL_STACK_SIZE];
+	int stackSize = 0;
+	if (!m_nodes.empty())
+	{
+		nodeStack[stackSize++] = 0;
+	}
+
+	while (stackSize > 0)
+	{
+		TriangleBVHNode const& node = m_nodes[nodeStack[--stackSize]];
+
+		//slab test all four rays against the node bounds
+		__m128 tX1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_bounds.m_mins.x), startX), inverseX);
+		__m128 tX2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_bounds.m_maxs.x), startX), inverseX);
+		__m128 tY1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_bounds.m_mins.y), startY), inverseY);
+		__m128 tY2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_bounds.m_maxs.y), startY), inverseY);
+		__m128 tZ1 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_bounds.m_mins.z), startZ), inverseZ);
+		__m128 tZ2 = _mm_mul_ps(_mm_sub_ps(_mm_set1_ps(node.m_bounds.m_maxs.z), startZ), inverseZ);
+		__m128 entryDist = _mm_max_ps(_mm_max_ps(_mm_min_ps(tX1, tX2), _mm_min_ps(tY1, tY2)), _mm_max_ps(_mm_min_ps(tZ1, tZ2), zero));
+		__m128 exitDist = _mm_min_ps(_mm_min_ps(_mm_max_ps(tX1, tX2), _mm_max_ps(tY1, tY2)), _mm_min_ps(_mm_max_ps(tZ1, tZ2), closestDist));
+		if (_mm_movemask_ps(_mm_cmple_ps(entryDist, exitDist)) == 0)
+		{
+			continue;
+		}
+
+		if (node.m_numTriangles == 0)
+		{
+			//the first ray picks the visiting order for the whole packet
+			bool isNearChildSecond = GetAxisValue(directionNormals[0], node.m_splitAxis) < 0.0f;
+			nodeStack[stackSize++] = isNearChildSecond ? node.m_firstIndex : node.m_firstIndex + 1;
+			nodeStack[stackSize++] = isNearChildSecond ? node.m_firstIndex + 1 : node.m_firstIndex;
+			continue;
+		}
+
+		//Moller-Trumbore for all four rays against each triangle in the leaf, same math as RaycastVsTriangle3D
+		for (int orderIndex = node.m_firstIndex; orderIndex < node.m_firstIndex + node.m_numTriangles; orderIndex++)
+		{
+			Vec3 const* corners = &m_triangleCorners[orderIndex * 3];
+			Vec3 aToB = corners[1] - corners[0];
+			Vec3 aToC = corners[2] - corners[0];
+			__m128 aToBX = _mm_set1_ps(aToB.x);
+			__m128 aToBY = _mm_set1_ps(aToB.y);
+			__m128 aToBZ = _mm_set1_ps(aToB.z);
+			__m128 aToCX = _mm_set1_ps(aToC.x);
+			__m128 aToCY = _mm_set1_ps(aToC.y);
+			__m128 aToCZ = _mm_set1_ps(aToC.z);
+
+			__m128 dirCrossAToCX = _mm_sub_ps(_mm_mul_ps(directionY, aToCZ), _mm_mul_ps(directionZ, aToCY));
+			__m128 dirCrossAToCY = _mm_sub_ps(_mm_mul_ps(directionZ, aToCX), _mm_mul_ps(directionX, aToCZ));
+			__m128 dirCrossAToCZ = _mm_sub_ps(_mm_mul_ps(directionX, aToCY), _mm_mul_ps(directionY, aToCX));
+			__m128 determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(aToBX, dirCrossAToCX), _mm_mul_ps(aToBY, dirCrossAToCY)), _mm_mul_ps(aToBZ, dirCrossAToCZ));
+			__m128 inverseDeterminant = _mm_div_ps(one, determinant);
+
+			__m128 aToStartX = _mm_sub_ps(startX, _mm_set1_ps(corners[0].x));
+			__m128 aToStartY = _mm_sub_ps(startY, _mm_set1_ps(corners[0].y));
+			__m128 aToStartZ = _mm_sub_ps(startZ, _mm_set1_ps(corners[0].z));
+			__m128 u = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aToStartX, dirCrossAToCX), _mm_mul_ps(aToStartY, dirCrossAToCY)), _mm_mul_ps(aToStartZ, dirCrossAToCZ)),
+				inverseDeterminant);
+
+			__m128 startCrossAToBX = _mm_sub_ps(_mm_mul_ps(aToStartY, aToBZ), _mm_mul_ps(aToStartZ, aToBY));
+			__m128 startCrossAToBY = _mm_sub_ps(_mm_mul_ps(aToStartZ, aToBX), _mm_mul_ps(aToStartX, aToBZ));
+			__m128 startCrossAToBZ = _mm_sub_ps(_mm_mul_ps(aToStartX, aToBY), _mm_mul_ps(aToStartY, aToBX));
+			__m128 v = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(directionX, startCrossAToBX), _mm_mul_ps(directionY, startCrossAToBY)), _mm_mul_ps(directionZ, startCrossAToBZ)),
+				inverseDeterminant);
+			__m128 impactDist = _mm_mul_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(aToCX, startCrossAToBX), _mm_mul_ps(aToCY, startCrossAToBY)), _mm_mul_ps(aToCZ, startCrossAToBZ)),
+				inverseDeterminant);
+
+			__m128 didHit = _mm_cmpge_ps(_mm_and_ps(determinant, absMask), determinantEpsilon);
+			didHit = _mm_and_ps(didHit, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+			didHit = _mm_and_ps(didHit, _mm_and_ps(_mm_cmpge_ps(v, zero), _mm_cmple_ps(_mm_add_ps(u, v), one)));
+			didHit = _mm_and_ps(didHit, _mm_and_ps(_mm_cmpge_ps(impactDist, zero), _mm_cmplt_ps(impactDist, closestDist)));
+
+			int hitLanes = _mm_movemask_ps(didHit);
+			if (hitLanes != 0)
+			{
+				closestDist = _mm_or_ps(_mm_and_ps(didHit, impactDist), _mm_andnot_ps(didHit, closestDist));
+				for (int rayIndex = 0; rayIndex < 4; rayIndex++)
+				{
+					if (hitLanes & (1 << rayIndex))
+					{
+						closestOrderIndexes[rayIndex] = orderIndex;
+					}
+				}
+			}
+		}
+	}
+
+	_mm_store_ps(closestDists, closestDist);
+	for (int rayIndex = 0; rayIndex < numRays; rayIndex++)
+	{
+		RaycastResult3D& result = out_results[rayIndex];
+		result = RaycastResult3D();
+		result.m_rayStartPosition = startPositions[rayIndex];
+		result.m_rayDirection = directionNormals[rayIndex];
+		result.m_rayLength = maxDistance;
+
+		int orderIndex = closestOrderIndexes[rayIndex];
+		if (orderIndex >= 0)
+		{
+			Vec3 const* corners = &m_triangleCorners[orderIndex * 3];
+			Vec3 faceNormal = CrossProduct3D(corners[1] - corners[0], corners[2] - corners[0]).GetNormalized();
+			result.m_didImpact = true;
+			result.m_impactDist = closestDists[rayIndex];
+			result.m_impactPos = startPositions[rayIndex] + (directionNormals[rayIndex] * closestDists[rayIndex]);
+			result.m_impactNormal = (DotProduct3D(faceNormal, directionNormals[rayIndex]) < 0.0f) ? faceNormal : -faceNormal;
+		}
+
+		if (out_triangleIndexes)
+		{
+			out_triangleIndexes[rayIndex] = (orderIndex >= 0) ? m_triangleIndexes[orderIndex] : -1;
+		}
+	}
+#else
+	for (int rayIndex = 0; rayIndex < numRays; rayIndex++)
+	{
+		out_results[rayIndex] = Raycast(startPositions[rayIndex], directionNormals[rayIndex], maxDistance, out_triangleIndexes ? &out_triangleIndexes[rayIndex] : nullptr);
+	}
+#endif
+}
+
+
+//
+//proximity queries
+//
+Vec3 const TriangleBVH::GetNearestPoint(Vec3 const& referencePoint, int* out_triangleIndex) const
+{
+	Vec3 nearestPoint = referencePoint;
+	int nearestOrderIndex = -1;
+	float nearestDistSquared = FLT_MAX;
+
+	int nodeStack[TRAVERSAL_STACK_SIZE];
+	int stackSize = 0;
+	if (!m_nodes.empty())
+	{
+		nodeStack[stackSize++] = 0;
+	}
+
+	while (stackSize > 0)
+	{
+		TriangleBVHNode const& node = m_nodes[nodeStack[--stackSize]];
+		if (GetDistanceSquaredToBounds(referencePoint, node.m_bounds) >= nearestDistSquared)
+		{
+			continue;
+		}
+
+		if (node.m_numTriangles > 0)
+		{
+			for (int orderIndex = node.m_firstIndex; orderIndex < node.m_firstIndex + node.m_numTriangles; orderIndex++)
+			{
+				Vec3 const* corners = &m_triangleCorners[orderIndex * 3];
+				Vec3 pointOnTriangle = GetNearestPointOnTriangle3D(referencePoint, corners[0], corners[1], corners[2]);
+				float distSquared = GetDistanceSquared3D(referencePoint, pointOnTriangle);
+				if (distSquared < nearestDistSquared)
+				{
+					nearestDistSquared = distSquared;
+					nearestPoint = pointOnTriangle;
+					nearestOrderIndex = orderIndex;
+				}
+			}
+		}
+		else
+		{
+			//visit the closer child first so the farther one is more likely to be culled
+			float firstChildDistSquared = GetDistanceSquaredToBounds(referencePoint, m_nodes[node.m_firstIndex].m_bounds);
+			float secondChildDistSquared = GetDistanceSquaredToBounds(referencePoint, m_nodes[node.m_firstIndex + 1].m_bounds);
+			bool isSecondChildNearer = secondChildDistSquared < firstChildDistSquared;
+			nodeStack[stackSize++] = isSecondChildNearer ? node.m_firstIndex : node.m_firstIndex + 1;
+			nodeStack[stackSize++] = isSecondChildNearer ? node.m_firstIndex + 1 : node.m_firstIndex;
+		}
+	}
+
+	if (out_triangleIndex)
+	{
+		*out_triangleIndex = (nearestOrderIndex >= 0) ? m_triangleIndexes[nearestOrderIndex] : -1;
+	}
+
+	return nearestPoint;
+}
+
+
+int TriangleBVH::GetTrianglesOverlappingAABB3(AABB3 const& bounds, std::vector<int>& out_triangleIndexes) const
+{
+	int numTrianglesFound = 0;
+
+	int nodeStack[TRAVERSAL_STACK_SIZE];
+	int stackSize = 0;
+	if (!m_nodes.empty())
+	{
+		nodeStack[stackSize++] = 0;
+	}
+
+	while (stackSize > 0)
+	{
+		TriangleBVHNode const& node = m_nodes[nodeStack[--stackSize]];
+		if (!DoAABB3sOverlap(node.m_bounds, bounds))
+		{
+			continue;
+		}
+
+		if (node.m_numTriangles > 0)
+		{
+			for (int orderIndex = node.m_firstIndex; orderIndex < node.m_firstIndex + node.m_numTriangles; orderIndex++)
+			{
+				Vec3 const* corners = &m_triangleCorners[orderIndex * 3];
+				if (DoesTriangleOverlapAABB3(corners[0], corners[1], corners[2], bounds))
+				{
+					out_triangleIndexes.push_back(m_triangleIndexes[orderIndex]);
+					numTrianglesFound++;
+				}
+			}
+		}
+		else
+		{
+			nodeStack[stackSize++] = node.m_firstIndex;
+			nodeStack[stackSize++] = node.m_firstIndex + 1;
+		}
+	}
+
+	return numTrianglesFound;
+}
@@ -0,0 +1,64 @@
+#pragma once
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/MathUtils.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//forward declarations
+class CPUMesh;
+
+
+struct TriangleBVHNode
+{
+//public member variables
+public:
+	AABB3 m_bounds;
+	int	  m_firstIndex = 0;		//first child for interior nodes (the second child always follows it), first triangle for leaves
+	int	  m_numTriangles = 0;	//0 for interior nodes
+	int	  m_splitAxis = 0;		//0, 1, 2 for x, y, z, rays visit the child on their own side of the split first
+};
+
+
+//bounding volume hierarchy over a triangle mesh, built with the surface area heuristic
+//triangle indexes passed in and out are the mesh's triangle numbers (index list position / 3), not the BVH's internal order
+//the BVH copies the triangle corners, so rebuild it if the mesh moves or changes
+class TriangleBVH
+{
+//public member functions
+public:
+	//constructors
+	TriangleBVH() {}
+	explicit TriangleBVH(CPUMesh const& mesh, int maxTrianglesPerLeaf = 4);
+
+	//build functions, triangles come from the index list or, without indexes, from every three vertexes
+	void Build(CPUMesh const& mesh, int maxTrianglesPerLeaf = 4);
+	void Build(std::vector<Vec3> const& positions, std::vector<int> const& indexes, int maxTrianglesPerLeaf = 4);
+	void Clear();
+
+	//accessors
+	bool		IsEmpty() const { return m_nodes.empty(); }
+	int			GetNumTriangles() const { return static_cast<int>(m_triangleIndexes.size()); }
+	int			GetNumNodes() const { return static_cast<int>(m_nodes.size()); }
+	AABB3 const GetBounds() const;
+
+	//raycast queries
+	RaycastResult3D Raycast(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance, int* out_triangleIndex = nullptr) const;
+	bool			IsRayBlocked(Vec3 const& startPosition, Vec3 const& directionNormal, float maxDistance) const;	//stops at the first hit found, for line of sight
+	void			RaycastPacket(int numRays, Vec3 const* startPositions, Vec3 const* directionNormals, float maxDistance, RaycastResult3D* out_results,
+						int* out_triangleIndexes = nullptr) const;	//rays are walked down the tree four at a time, coherent rays (e.g. picking, shadows) benefit most
+
+	//proximity queries
+	Vec3 const GetNearestPoint(Vec3 const& referencePoint, int* out_triangleIndex = nullptr) const;	//returns referencePoint (and -1) if the BVH is empty
+	int		   GetTrianglesOverlappingAABB3(AABB3 const& bounds, std::vector<int>& out_triangleIndexes) const;	//appends to the list, returns how many were added
+
+//private member functions
+private:
+	void RaycastPacketOfFour(int numRays, Vec3 const* startPositions, Vec3 const* directionNormals, float maxDistance, RaycastResult3D* out_results,
+			int* out_triangleIndexes) const;
+
+//private member variables
+private:
+	std::vector<TriangleBVHNode> m_nodes;
+	std::vector<Vec3>			 m_triangleCorners;	//three per triangle, in leaf order so each leaf's triangles are contiguous
+	std::vector<int>			 m_triangleIndexes;	//leaf order to mesh triangle number
+};
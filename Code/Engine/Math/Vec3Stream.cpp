@@ -0,0 +1,618 @@
+#include "Engine/Math/Vec3Stream.hpp"
+#include "Engine/Math/AABB3.hpp"
+#include "Engine/Math/SIMDUtils.hpp"
+#include "Engine/Core/Vertex_PCU.hpp"
+#include "Engine/Core/Vertex_PCUTBN.hpp"
+#include <math.h>
+
+
+//
+//static functions
+//
+//how many leading elements the 4-wide loops handle, the scalar loops pick up the rest (or everything without SSE)
+static int GetNumSIMDElements(int numElements)
+{
+#if defined(ENGINE_SIMD_X86)
+	if (GetSIMDLevel() != SIMDLevel::SCALAR)
+	{
+		return numElements & ~3;
+	}
+#endif
+
+	return 0;
+}
+
+
+//
+//constructors
+//
+Vec3Stream::Vec3Stream(int numElements)
+{
+	Resize(numElements);
+}
+
+
+Vec3Stream::Vec3Stream(std::vector<Vec3> const& vecs)
+{
+	SetFromVec3s(vecs);
+}
+
+
+//
+//accessors
+//
+AABB3 const Vec3Stream::GetBounds() const
+{
+	int numElements = GetSize();
+	if (numElements == 0)
+	{
+		return AABB3();
+	}
+
+	float const* xs = m_xs.data();
+	float const* ys = m_ys.data();
+	float const* zs = m_zs.data();
+
+	Vec3 mins = GetElement(0);
+	Vec3 maxs = mins;
+	int numSIMDElements = GetNumSIMDElements(numElements);
+
+#if defined(ENGINE_SIMD_X86)
+	if (numSIMDElements > 0)
+	{
+		__m128 minXs = _mm_loadu_ps(xs);
+		__m128 minYs = _mm_loadu_ps(ys);
+		__m128 minZs = _mm_loadu_ps(zs);
+		__m128 maxXs = minXs;
+		__m128 maxYs = minYs;
+		__m128 maxZs = minZs;
+
+		for (int elementIndex = 4; elementIndex < numSIMDElements; elementIndex += 4)
+		{
+			__m128 x = _mm_loadu_ps(&xs[elementIndex]);
+			__m128 y = _mm_loadu_ps(&ys[elementIndex]);
+			__m128 z = _mm_loadu_ps(&zs[elementIndex]);
+
+			minXs = _mm_min_ps(minXs, x);
+			minYs = _mm_min_ps(minYs, y);
+			minZs = _mm_min_ps(minZs, z);
+			maxXs = _mm_max_ps(maxXs, x);
+			maxYs = _mm_max_ps(maxYs, y);
+			maxZs = _mm_max_ps(maxZs, z);
+		}
+
+		//fold the four lanes down to one
+		float laneMinXs[4];
+		float laneMinYs[4];
+		float laneMinZs[4];
+		float laneMaxXs[4];
+		float laneMaxYs[4];
+		float laneMaxZs[4];
+		_mm_storeu_ps(laneMinXs, minXs);
+		_mm_storeu_ps(laneMinYs, minYs);
+		_mm_storeu_ps(laneMinZs, minZs);
+		_mm_storeu_ps(laneMaxXs, maxXs);
+		_mm_storeu_ps(laneMaxYs, maxYs);
+		_mm_storeu_ps(laneMaxZs, maxZs);
+
+		for (int laneIndex = 0; laneIndex < 4; laneIndex++)
+		{
+			mins.x = (laneMinXs[laneIndex] < mins.x) ? laneMinXs[laneIndex] : mins.x;
+			mins.y = (laneMinYs[laneIndex] < mins.y) ? laneMinYs[laneIndex] : mins.y;
+			mins.z = (laneMinZs[laneIndex] < mins.z) ? laneMinZs[laneIndex] : mins.z;
+			maxs.x = (laneMaxXs[laneIndex] > maxs.x) ? laneMaxXs[laneIndex] : maxs.x;
+			maxs.y = (laneMaxYs[laneIndex] > maxs.y) ? laneMaxYs[laneIndex] : maxs.y;
+			maxs.z = (laneMaxZs[laneIndex] > maxs.z) ? laneMaxZs[laneIndex] : maxs.z;
+		}
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		mins.x = (xs[elementIndex] < mins.x) ? xs[elementIndex] : mins.x;
+		mins.y = (ys[elementIndex] < mins.y) ? ys[elementIndex] : mins.y;
+		mins.z = (zs[elementIndex] < mins.z) ? zs[elementIndex] : mins.z;
+		maxs.x = (xs[elementIndex] > maxs.x) ? xs[elementIndex] : maxs.x;
+		maxs.y = (ys[elementIndex] > maxs.y) ? ys[elementIndex] : maxs.y;
+		maxs.z = (zs[elementIndex] > maxs.z) ? zs[elementIndex] : maxs.z;
+	}
+
+	return AABB3(mins, maxs);
+}
+
+
+void Vec3Stream::GetDistancesSquared(Vec3 const& point, float* out_distancesSquared) const
+{
+	int numElements = GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float const* xs = m_xs.data();
+	float const* ys = m_ys.data();
+	float const* zs = m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	__m128 pointX = _mm_set1_ps(point.x);
+	__m128 pointY = _mm_set1_ps(point.y);
+	__m128 pointZ = _mm_set1_ps(point.z);
+
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		__m128 dispX = _mm_sub_ps(_mm_loadu_ps(&xs[elementIndex]), pointX);
+		__m128 dispY = _mm_sub_ps(_mm_loadu_ps(&ys[elementIndex]), pointY);
+		__m128 dispZ = _mm_sub_ps(_mm_loadu_ps(&zs[elementIndex]), pointZ);
+
+		__m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dispX, dispX), _mm_mul_ps(dispY, dispY)), _mm_mul_ps(dispZ, dispZ));
+		_mm_storeu_ps(&out_distancesSquared[elementIndex], distanceSquared);
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		float dispX = xs[elementIndex] - point.x;
+		float dispY = ys[elementIndex] - point.y;
+		float dispZ = zs[elementIndex] - point.z;
+
+		out_distancesSquared[elementIndex] = dispX * dispX + dispY * dispY + dispZ * dispZ;
+	}
+}
+
+
+//
+//mutators
+//
+void Vec3Stream::Resize(int numElements)
+{
+	m_xs.resize(numElements);
+	m_ys.resize(numElements);
+	m_zs.resize(numElements);
+}
+
+
+void Vec3Stream::Reserve(int numElements)
+{
+	m_xs.reserve(numElements);
+	m_ys.reserve(numElements);
+	m_zs.reserve(numElements);
+}
+
+
+void Vec3Stream::Clear()
+{
+	m_xs.clear();
+	m_ys.clear();
+	m_zs.clear();
+}
+
+
+void Vec3Stream::SetElement(int elementIndex, Vec3 const& vec)
+{
+	m_xs[elementIndex] = vec.x;
+	m_ys[elementIndex] = vec.y;
+	m_zs[elementIndex] = vec.z;
+}
+
+
+void Vec3Stream::PushBack(Vec3 const& vec)
+{
+	m_xs.push_back(vec.x);
+	m_ys.push_back(vec.y);
+	m_zs.push_back(vec.z);
+}
+
+
+//
+//bulk math functions
+//
+void Vec3Stream::Add(Vec3Stream const& streamToAdd)
+{
+	GUARANTEE_OR_DIE(streamToAdd.GetSize() == GetSize(), "Tried to add Vec3Streams of different sizes!");
+
+	int numElements = GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float* xs = m_xs.data();
+	float* ys = m_ys.data();
+	float* zs = m_zs.data();
+	float const* xsToAdd = streamToAdd.m_xs.data();
+	float const* ysToAdd = streamToAdd.m_ys.data();
+	float const* zsToAdd = streamToAdd.m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		_mm_storeu_ps(&xs[elementIndex], _mm_add_ps(_mm_loadu_ps(&xs[elementIndex]), _mm_loadu_ps(&xsToAdd[elementIndex])));
+		_mm_storeu_ps(&ys[elementIndex], _mm_add_ps(_mm_loadu_ps(&ys[elementIndex]), _mm_loadu_ps(&ysToAdd[elementIndex])));
+		_mm_storeu_ps(&zs[elementIndex], _mm_add_ps(_mm_loadu_ps(&zs[elementIndex]), _mm_loadu_ps(&zsToAdd[elementIndex])));
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		xs[elementIndex] += xsToAdd[elementIndex];
+		ys[elementIndex] += ysToAdd[elementIndex];
+		zs[elementIndex] += zsToAdd[elementIndex];
+	}
+}
+
+
+void Vec3Stream::Subtract(Vec3Stream const& streamToSubtract)
+{
+	GUARANTEE_OR_DIE(streamToSubtract.GetSize() == GetSize(), "Tried to subtract Vec3Streams of different sizes!");
+
+	int numElements = GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float* xs = m_xs.data();
+	float* ys = m_ys.data();
+	float* zs = m_zs.data();
+	float const* xsToSubtract = streamToSubtract.m_xs.data();
+	float const* ysToSubtract = streamToSubtract.m_ys.data();
+	float const* zsToSubtract = streamToSubtract.m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		_mm_storeu_ps(&xs[elementIndex], _mm_sub_ps(_mm_loadu_ps(&xs[elementIndex]), _mm_loadu_ps(&xsToSubtract[elementIndex])));
+		_mm_storeu_ps(&ys[elementIndex], _mm_sub_ps(_mm_loadu_ps(&ys[elementIndex]), _mm_loadu_ps(&ysToSubtract[elementIndex])));
+		_mm_storeu_ps(&zs[elementIndex], _mm_sub_ps(_mm_loadu_ps(&zs[elementIndex]), _mm_loadu_ps(&zsToSubtract[elementIndex])));
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		xs[elementIndex] -= xsToSubtract[elementIndex];
+		ys[elementIndex] -= ysToSubtract[elementIndex];
+		zs[elementIndex] -= zsToSubtract[elementIndex];
+	}
+}
+
+
+void Vec3Stream::Translate(Vec3 const& translation)
+{
+	int numElements = GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float* xs = m_xs.data();
+	float* ys = m_ys.data();
+	float* zs = m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	__m128 translationX = _mm_set1_ps(translation.x);
+	__m128 translationY = _mm_set1_ps(translation.y);
+	__m128 translationZ = _mm_set1_ps(translation.z);
+
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		_mm_storeu_ps(&xs[elementIndex], _mm_add_ps(_mm_loadu_ps(&xs[elementIndex]), translationX));
+		_mm_storeu_ps(&ys[elementIndex], _mm_add_ps(_mm_loadu_ps(&ys[elementIndex]), translationY));
+		_mm_storeu_ps(&zs[elementIndex], _mm_add_ps(_mm_loadu_ps(&zs[elementIndex]), translationZ));
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		xs[elementIndex] += translation.x;
+		ys[elementIndex] += translation.y;
+		zs[elementIndex] += translation.z;
+	}
+}
+
+
+void Vec3Stream::Scale(float uniformScale)
+{
+	int numElements = GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float* xs = m_xs.data();
+	float* ys = m_ys.data();
+	float* zs = m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	__m128 scale = _mm_set1_ps(uniformScale);
+
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		_mm_storeu_ps(&xs[elementIndex], _mm_mul_ps(_mm_loadu_ps(&xs[elementIndex]), scale));
+		_mm_storeu_ps(&ys[elementIndex], _mm_mul_ps(_mm_loadu_ps(&ys[elementIndex]), scale));
+		_mm_storeu_ps(&zs[elementIndex], _mm_mul_ps(_mm_loadu_ps(&zs[elementIndex]), scale));
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		xs[elementIndex] *= uniformScale;
+		ys[elementIndex] *= uniformScale;
+		zs[elementIndex] *= uniformScale;
+	}
+}
+
+
+void Vec3Stream::Normalize()
+{
+	int numElements = GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float* xs = m_xs.data();
+	float* ys = m_ys.data();
+	float* zs = m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	__m128 zero = _mm_setzero_ps();
+
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		__m128 x = _mm_loadu_ps(&xs[elementIndex]);
+		__m128 y = _mm_loadu_ps(&ys[elementIndex]);
+		__m128 z = _mm_loadu_ps(&zs[elementIndex]);
+
+		//full sqrt and divide rather than rsqrt, so results match Vec3::Normalize
+		__m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+		__m128 isNonZero = _mm_cmpneq_ps(length, zero);
+
+		//zero-length lanes keep their original values instead of the divide's NaNs
+		_mm_storeu_ps(&xs[elementIndex], _mm_or_ps(_mm_and_ps(isNonZero, _mm_div_ps(x, length)), _mm_andnot_ps(isNonZero, x)));
+		_mm_storeu_ps(&ys[elementIndex], _mm_or_ps(_mm_and_ps(isNonZero, _mm_div_ps(y, length)), _mm_andnot_ps(isNonZero, y)));
+		_mm_storeu_ps(&zs[elementIndex], _mm_or_ps(_mm_and_ps(isNonZero, _mm_div_ps(z, length)), _mm_andnot_ps(isNonZero, z)));
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		float length = sqrtf(xs[elementIndex] * xs[elementIndex] + ys[elementIndex] * ys[elementIndex] + zs[elementIndex] * zs[elementIndex]);
+		if (length == 0.0f)
+		{
+			continue;
+		}
+
+		xs[elementIndex] /= length;
+		ys[elementIndex] /= length;
+		zs[elementIndex] /= length;
+	}
+}
+
+
+//
+//static bulk math functions
+//
+void Vec3Stream::GetDotProducts(Vec3Stream const& streamA, Vec3Stream const& streamB, float* out_dotProducts)
+{
+	GUARANTEE_OR_DIE(streamA.GetSize() == streamB.GetSize(), "Tried to dot Vec3Streams of different sizes!");
+
+	int numElements = streamA.GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float const* xsA = streamA.m_xs.data();
+	float const* ysA = streamA.m_ys.data();
+	float const* zsA = streamA.m_zs.data();
+	float const* xsB = streamB.m_xs.data();
+	float const* ysB = streamB.m_ys.data();
+	float const* zsB = streamB.m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		__m128 dotProduct = _mm_mul_ps(_mm_loadu_ps(&xsA[elementIndex]), _mm_loadu_ps(&xsB[elementIndex]));
+		dotProduct = _mm_add_ps(dotProduct, _mm_mul_ps(_mm_loadu_ps(&ysA[elementIndex]), _mm_loadu_ps(&ysB[elementIndex])));
+		dotProduct = _mm_add_ps(dotProduct, _mm_mul_ps(_mm_loadu_ps(&zsA[elementIndex]), _mm_loadu_ps(&zsB[elementIndex])));
+
+		_mm_storeu_ps(&out_dotProducts[elementIndex], dotProduct);
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		out_dotProducts[elementIndex] = xsA[elementIndex] * xsB[elementIndex] + ysA[elementIndex] * ysB[elementIndex] + zsA[elementIndex] * zsB[elementIndex];
+	}
+}
+
+
+void Vec3Stream::GetCrossProducts(Vec3Stream const& streamA, Vec3Stream const& streamB, Vec3Stream& out_crossProducts)
+{
+	GUARANTEE_OR_DIE(streamA.GetSize() == streamB.GetSize(), "Tried to cross Vec3Streams of different sizes!");
+
+	int numElements = streamA.GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	out_crossProducts.Resize(numElements);
+
+	//the output may be one of the inputs, every element is read before it's written
+	float const* xsA = streamA.m_xs.data();
+	float const* ysA = streamA.m_ys.data();
+	float const* zsA = streamA.m_zs.data();
+	float const* xsB = streamB.m_xs.data();
+	float const* ysB = streamB.m_ys.data();
+	float const* zsB = streamB.m_zs.data();
+	float* xsOut = out_crossProducts.m_xs.data();
+	float* ysOut = out_crossProducts.m_ys.data();
+	float* zsOut = out_crossProducts.m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		__m128 xA = _mm_loadu_ps(&xsA[elementIndex]);
+		__m128 yA = _mm_loadu_ps(&ysA[elementIndex]);
+		__m128 zA = _mm_loadu_ps(&zsA[elementIndex]);
+		__m128 xB = _mm_loadu_ps(&xsB[elementIndex]);
+		__m128 yB = _mm_loadu_ps(&ysB[elementIndex]);
+		__m128 zB = _mm_loadu_ps(&zsB[elementIndex]);
+
+		_mm_storeu_ps(&xsOut[elementIndex], _mm_sub_ps(_mm_mul_ps(yA, zB), _mm_mul_ps(zA, yB)));
+		_mm_storeu_ps(&ysOut[elementIndex], _mm_sub_ps(_mm_mul_ps(zA, xB), _mm_mul_ps(xA, zB)));
+		_mm_storeu_ps(&zsOut[elementIndex], _mm_sub_ps(_mm_mul_ps(xA, yB), _mm_mul_ps(yA, xB)));
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		float xA = xsA[elementIndex];
+		float yA = ysA[elementIndex];
+		float zA = zsA[elementIndex];
+		float xB = xsB[elementIndex];
+		float yB = ysB[elementIndex];
+		float zB = zsB[elementIndex];
+
+		xsOut[elementIndex] = yA * zB - zA * yB;
+		ysOut[elementIndex] = zA * xB - xA * zB;
+		zsOut[elementIndex] = xA * yB - yA * xB;
+	}
+}
+
+
+void Vec3Stream::GetDistancesSquared(Vec3Stream const& streamA, Vec3Stream const& streamB, float* out_distancesSquared)
+{
+	GUARANTEE_OR_DIE(streamA.GetSize() == streamB.GetSize(), "Tried to get distances between Vec3Streams of different sizes!");
+
+	int numElements = streamA.GetSize();
+	int numSIMDElements = GetNumSIMDElements(numElements);
+	float const* xsA = streamA.m_xs.data();
+	float const* ysA = streamA.m_ys.data();
+	float const* zsA = streamA.m_zs.data();
+	float const* xsB = streamB.m_xs.data();
+	float const* ysB = streamB.m_ys.data();
+	float const* zsB = streamB.m_zs.data();
+
+#if defined(ENGINE_SIMD_X86)
+	for (int elementIndex = 0; elementIndex < numSIMDElements; elementIndex += 4)
+	{
+		__m128 dispX = _mm_sub_ps(_mm_loadu_ps(&xsB[elementIndex]), _mm_loadu_ps(&xsA[elementIndex]));
+		__m128 dispY = _mm_sub_ps(_mm_loadu_ps(&ysB[elementIndex]), _mm_loadu_ps(&ysA[elementIndex]));
+		__m128 dispZ = _mm_sub_ps(_mm_loadu_ps(&zsB[elementIndex]), _mm_loadu_ps(&zsA[elementIndex]));
+
+		__m128 distanceSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dispX, dispX), _mm_mul_ps(dispY, dispY)), _mm_mul_ps(dispZ, dispZ));
+		_mm_storeu_ps(&out_distancesSquared[elementIndex], distanceSquared);
+	}
+#endif
+
+	for (int elementIndex = numSIMDElements; elementIndex < numElements; elementIndex++)
+	{
+		float dispX = xsB[elementIndex] - xsA[elementIndex];
+		float dispY = ysB[elementIndex] - ysA[elementIndex];
+		float dispZ = zsB[elementIndex] - zsA[elementIndex];
+
+		out_distancesSquared[elementIndex] = dispX * dispX + dispY * dispY + dispZ * dispZ;
+	}
+}
+
+
+//
+//conversion functions
+//
+void Vec3Stream::SetFromVec3s(std::vector<Vec3> const& vecs)
+{
+	if (vecs.empty())
+	{
+		Clear();
+		return;
+	}
+
+	SetFromStrided(static_cast<int>(vecs.size()), &vecs[0], static_cast<int>(sizeof(Vec3)));
+}
+
+
+void Vec3Stream::CopyToVec3s(std::vector<Vec3>& out_vecs) const
+{
+	out_vecs.resize(GetSize());
+	if (out_vecs.empty())
+	{
+		return;
+	}
+
+	CopyToStrided(&out_vecs[0], static_cast<int>(sizeof(Vec3)));
+}
+
+
+void Vec3Stream::SetFromVertexPositions(std::vector<Vertex_PCU> const& verts)
+{
+	if (verts.empty())
+	{
+		Clear();
+		return;
+	}
+
+	SetFromStrided(static_cast<int>(verts.size()), &verts[0].m_position, static_cast<int>(sizeof(Vertex_PCU)));
+}
+
+
+void Vec3Stream::SetFromVertexPositions(std::vector<Vertex_PCUTBN> const& verts)
+{
+	if (verts.empty())
+	{
+		Clear();
+		return;
+	}
+
+	SetFromStrided(static_cast<int>(verts.size()), &verts[0].m_position, static_cast<int>(sizeof(Vertex_PCUTBN)));
+}
+
+
+void Vec3Stream::SetFromVertexNormals(std::vector<Vertex_PCUTBN> const& verts)
+{
+	if (verts.empty())
+	{
+		Clear();
+		return;
+	}
+
+	SetFromStrided(static_cast<int>(verts.size()), &verts[0].m_normal, static_cast<int>(sizeof(Vertex_PCUTBN)));
+}
+
+
+void Vec3Stream::CopyToVertexPositions(std::vector<Vertex_PCU>& verts) const
+{
+	GUARANTEE_OR_DIE(static_cast<int>(verts.size()) == GetSize(), "Vec3Stream and vertex array sizes don't match!");
+	if (verts.empty())
+	{
+		return;
+	}
+
+	CopyToStrided(&verts[0].m_position, static_cast<int>(sizeof(Vertex_PCU)));
+}
+
+
+void Vec3Stream::CopyToVertexPositions(std::vector<Vertex_PCUTBN>& verts) const
+{
+	GUARANTEE_OR_DIE(static_cast<int>(verts.size()) == GetSize(), "Vec3Stream and vertex array sizes don't match!");
+	if (verts.empty())
+	{
+		return;
+	}
+
+	CopyToStrided(&verts[0].m_position, static_cast<int>(sizeof(Vertex_PCUTBN)));
+}
+
+
+void Vec3Stream::CopyToVertexNormals(std::vector<Vertex_PCUTBN>& verts) const
+{
+	GUARANTEE_OR_DIE(static_cast<int>(verts.size()) == GetSize(), "Vec3Stream and vertex array sizes don't match!");
+	if (verts.empty())
+	{
+		return;
+	}
+
+	CopyToStrided(&verts[0].m_normal, static_cast<int>(sizeof(Vertex_PCUTBN)));
+}
+
+
+//
+//strided conversion functions
+//
+void Vec3Stream::SetFromStrided(int numElements, Vec3 const* firstVec, int strideBytes)
+{
+	Resize(numElements);
+
+	unsigned char const* vecBytes = reinterpret_cast<unsigned char const*>(firstVec);
+	for (int elementIndex = 0; elementIndex < numElements; elementIndex++)
+	{
+		Vec3 const& vec = *reinterpret_cast<Vec3 const*>(vecBytes + elementIndex * strideBytes);
+		m_xs[elementIndex] = vec.x;
+		m_ys[elementIndex] = vec.y;
+		m_zs[elementIndex] = vec.z;
+	}
+}
+
+
+void Vec3Stream::CopyToStrided(Vec3* firstVec, int strideBytes) const
+{
+	int numElements = GetSize();
+
+	unsigned char* vecBytes = reinterpret_cast<unsigned char*>(firstVec);
+	for (int elementIndex = 0; elementIndex < numElements; elementIndex++)
+	{
+		Vec3& vec = *reinterpret_cast<Vec3*>(vecBytes + elementIndex * strideBytes);
+		vec.x = m_xs[elementIndex];
+		vec.y = m_ys[elementIndex];
+		vec.z = m_zs[elementIndex];
+	}
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "Engine/Math/Vec3.hpp"
+#include "Engine/Core/EngineCommon.hpp"
+
+
+//forward declarations
+struct AABB3;
+struct Vertex_PCU;
+struct Vertex_PCUTBN;
+
+
+//structure-of-arrays list of Vec3s, x/y/z live in separate arrays so bulk math runs four elements per SSE instruction
+//convert in from std::vector<Vec3> or vertex arrays, do the bulk work here, then copy back out
+class Vec3Stream
+{
+//public member functions
+public:
+	//constructors
+	Vec3Stream() {}
+	explicit Vec3Stream(int numElements);
+	explicit Vec3Stream(std::vector<Vec3> const& vecs);
+
+	//accessors
+	int		   GetSize() const { return static_cast<int>(m_xs.size()); }
+	Vec3 const GetElement(int elementIndex) const { return Vec3(m_xs[elementIndex], m_ys[elementIndex], m_zs[elementIndex]); }
+	AABB3 const GetBounds() const;
+	void	   GetDistancesSquared(Vec3 const& point, float* out_distancesSquared) const;
+
+	//mutators
+	void Resize(int numElements);
+	void Reserve(int numElements);
+	void Clear();
+	void SetElement(int elementIndex, Vec3 const& vec);
+	void PushBack(Vec3 const& vec);
+
+	//bulk math functions, streams used together must be the same size
+	void Add(Vec3Stream const& streamToAdd);
+	void Subtract(Vec3Stream const& streamToSubtract);
+	void Translate(Vec3 const& translation);
+	void Scale(float uniformScale);
+	void Normalize();	//zero-length elements are left as they are, same as Vec3::Normalize
+
+	//static bulk math functions, output arrays/streams are sized by the caller (streams get resized)
+	static void GetDotProducts(Vec3Stream const& streamA, Vec3Stream const& streamB, float* out_dotProducts);
+	static void GetCrossProducts(Vec3Stream const& streamA, Vec3Stream const& streamB, Vec3Stream& out_crossProducts);
+	static void GetDistancesSquared(Vec3Stream const& streamA, Vec3Stream const& streamB, float* out_distancesSquared);
+
+	//conversion functions
+	void SetFromVec3s(std::vector<Vec3> const& vecs);
+	void CopyToVec3s(std::vector<Vec3>& out_vecs) const;
+	void SetFromVertexPositions(std::vector<Vertex_PCU> const& verts);
+	void SetFromVertexPositions(std::vector<Vertex_PCUTBN> const& verts);
+	void SetFromVertexNormals(std::vector<Vertex_PCUTBN> const& verts);
+	void CopyToVertexPositions(std::vector<Vertex_PCU>& verts) const;
+	void CopyToVertexPositions(std::vector<Vertex_PCUTBN>& verts) const;
+	void CopyToVertexNormals(std::vector<Vertex_PCUTBN>& verts) const;
+
+	//strided conversion functions, step strideBytes between Vec3s (e.g. to reach tangents in a vertex array)
+	void SetFromStrided(int numElements, Vec3 const* firstVec, int strideBytes);
+	void CopyToStrided(Vec3* firstVec, int strideBytes) const;
+
+//public member variables
+public:
+	std::vector<float> m_xs;
+	std::vector<float> m_ys;
+	std::vector<float> m_zs;
+};
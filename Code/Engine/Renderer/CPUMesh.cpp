@@ -1,4 +1,4 @@
-#include "Engine/Renderer/CPUMesh.hpp"
-
-
-
+#include "Engine/Renderer/CPUMesh.hpp"
+
+
+
@@ -1,23 +1,23 @@
-#include "Engine/Renderer/ConstantBuffer.hpp"
-#include "Engine/Renderer/Renderer.hpp"
-#include <d3d11.h>
-#include <dxgi.h>
-#include <d3dcompiler.h>
-#pragma comment (lib, "d3d11.lib")
-#pragma comment (lib, "dxgi.lib")
-#pragma comment (lib, "d3dcompiler.lib")
-
-
-//
-//constructor and destructor
-//
-ConstantBuffer::ConstantBuffer(size_t size)
-	: m_size(size)
-{
-}
-
-
-ConstantBuffer::~ConstantBuffer()
-{
-	DX_SAFE_RELEASE(m_buffer);
-}
+#include "Engine/Renderer/ConstantBuffer.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include <d3d11.h>
+#include <dxgi.h>
+#include <d3dcompiler.h>
+#pragma comment (lib, "d3d11.lib")
+#pragma comment (lib, "dxgi.lib")
+#pragma comment (lib, "d3dcompiler.lib")
+
+
+//
+//constructor and destructor
+//
+ConstantBuffer::ConstantBuffer(size_t size)
+	: m_size(size)
+{
+}
+
+
+ConstantBuffer::~ConstantBuffer()
+{
+	DX_SAFE_RELEASE(m_buffer);
+}
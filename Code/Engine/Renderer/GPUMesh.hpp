@@ -1,19 +1,19 @@
-#pragma once
-
-
-//forward declarations
-class VertexBuffer;
-class IndexBuffer;
-
-
-class GPUMesh
-{
-//public member functions
-public:
-	~GPUMesh();
-
-//public member variables
-public:
-	VertexBuffer* m_vertexBuffer = nullptr;
-	IndexBuffer*  m_indexBuffer = nullptr;
-};
+#pragma once
+
+
+//forward declarations
+class VertexBuffer;
+class IndexBuffer;
+
+
+class GPUMesh
+{
+//public member functions
+public:
+	~GPUMesh();
+
+//public member variables
+public:
+	VertexBuffer* m_vertexBuffer = nullptr;
+	IndexBuffer*  m_indexBuffer = nullptr;
+};
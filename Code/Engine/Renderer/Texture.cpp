@@ -1,23 +1,23 @@
-#include "Engine/Renderer/Texture.hpp"
-#include "Engine/Renderer/Renderer.hpp"
-#include <d3d11.h>
-#include <dxgi.h>
-#include <d3dcompiler.h>
-#pragma comment (lib, "d3d11.lib")
-#pragma comment (lib, "dxgi.lib")
-#pragma comment (lib, "d3dcompiler.lib")
-
-
-//
-//constructor and destructor
-//
-Texture::Texture()
-{
-}
-
-
-Texture::~Texture()
-{
-	DX_SAFE_RELEASE(m_texture);
-	DX_SAFE_RELEASE(m_shaderResourceView);
-}
+#include "Engine/Renderer/Texture.hpp"
+#include "Engine/Renderer/Renderer.hpp"
+#include <d3d11.h>
+#include <dxgi.h>
+#include <d3dcompiler.h>
+#pragma comment (lib, "d3d11.lib")
+#pragma comment (lib, "dxgi.lib")
+#pragma comment (lib, "d3dcompiler.lib")
+
+
+//
+//constructor and destructor
+//
+Texture::Texture()
+{
+}
+
+
+Texture::~Texture()
+{
+	DX_SAFE_RELEASE(m_texture);
+	DX_SAFE_RELEASE(m_shaderResourceView);
+}